@@ -0,0 +1,110 @@
+from __future__ import (print_function)
+
+'''
+EEZ PSU Firmware
+Copyright (C) 2018-present, Envox d.o.o.
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+'''
+
+'''
+This script RLE compresses bitmaps in the GUI document (eez_psu_sketch/gui_document.cpp).
+Execute it every time gui_document.cpp is generated again from psu.eez-project.
+Bitmaps that are already compressed are left as they are.
+
+Compressed pixel data is a sequence of packets, packet never crosses the end of a bitmap row.
+Packet starts with a header byte:
+    1nnnnnnn - run, n + 1 pixels of the same color follow as one RGB565 color (low byte first)
+    0nnnnnnn - literal, n + 1 RGB565 colors (low byte first) follow
+'''
+
+import os
+import re
+import sys
+
+MAX_PACKET_LENGTH = 128
+
+# repeated pixels shorter than this are stored inside literal packet
+MIN_RUN_LENGTH = 3
+
+def rle_encode(pixels, width, height):
+    result = []
+
+    def add_literal(literal):
+        while literal:
+            packet = literal[:MAX_PACKET_LENGTH]
+            literal = literal[MAX_PACKET_LENGTH:]
+            result.append(len(packet) - 1)
+            for color in packet:
+                result.extend((color & 0xFF, color >> 8))
+
+    for y in range(height):
+        row = pixels[y * width:(y + 1) * width]
+        literal = []
+        x = 0
+        while x < width:
+            run_length = 1
+            while x + run_length < width and row[x + run_length] == row[x] and run_length < MAX_PACKET_LENGTH:
+                run_length += 1
+
+            if run_length >= MIN_RUN_LENGTH:
+                add_literal(literal)
+                literal = []
+                result.extend((0x80 | (run_length - 1), row[x] & 0xFF, row[x] >> 8))
+            else:
+                literal.extend(row[x:x + run_length])
+
+            x += run_length
+
+        add_literal(literal)
+
+    return result
+
+def format_array(name, data):
+    lines = ['const uint8_t %s[%d] PROGMEM = {' % (name, len(data))]
+    for i in range(0, len(data), 16):
+        lines.append('    ' + ', '.join('0x%02X' % b for b in data[i:i + 16]) + (',' if i + 16 < len(data) else ''))
+    lines.append('};')
+    return '\n'.join(lines)
+
+def compress_gui_bitmaps(gui_document_file_path):
+    with open(gui_document_file_path) as f:
+        source = f.read()
+
+    bitmaps_table_re = re.compile(r'\{ (\d+), (\d+), (\w+)(, BITMAP_COMPRESSION_RLE)? \}')
+
+    for match in bitmaps_table_re.finditer(source):
+        width, height, name, compression = int(match.group(1)), int(match.group(2)), match.group(3), match.group(4)
+        if compression:
+            print('%s: already compressed' % name)
+            continue
+
+        array_re = re.compile(r'const uint8_t ' + name + r'\[\d+\] PROGMEM = \{([^}]*)\};')
+        array_match = array_re.search(source)
+        data = [int(b, 16) for b in array_match.group(1).replace(',', ' ').split()]
+        if len(data) != 2 * width * height:
+            sys.exit('%s: expected %d bytes, found %d' % (name, 2 * width * height, len(data)))
+
+        pixels = [data[2 * i] | (data[2 * i + 1] << 8) for i in range(width * height)]
+        compressed = rle_encode(pixels, width, height)
+
+        print('%s: %dx%d, %d -> %d bytes' % (name, width, height, len(data), len(compressed)))
+
+        source = source[:array_match.start()] + format_array(name, compressed) + source[array_match.end():]
+        source = source.replace(match.group(0), '{ %d, %d, %s, BITMAP_COMPRESSION_RLE }' % (width, height, name))
+
+    with open(gui_document_file_path, 'w') as f:
+        f.write(source)
+
+compress_gui_bitmaps(os.path.join(os.path.dirname(os.path.abspath(__file__)), 'eez_psu_sketch/gui_document.cpp'))
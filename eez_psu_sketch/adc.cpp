@@ -19,6 +19,7 @@
 #include "psu.h"
 #include "adc.h"
 #include "channel_dispatcher.h"
+#include "scheduler.h"
 
 namespace eez {
 namespace psu {
@@ -197,6 +198,20 @@ void AnalogDigitalConverter::tick(uint32_t tick_usec) {
 #endif
 }
 
+uint32_t AnalogDigitalConverter::getIdleTime(uint32_t tick_usec) {
+#if ADC_USE_INTERRUPTS
+    // conversion end is signaled by interrupt
+    return scheduler::IDLE_FOREVER;
+#else
+    if (!start_reg0) {
+        return scheduler::IDLE_FOREVER;
+    }
+    // tick reads the data when more than ADC_READ_TIME_US elapsed
+    int32_t diff = start_time + ADC_READ_TIME_US + 1 - tick_usec;
+    return diff > 0 ? diff : 0;
+#endif
+}
+
 void AnalogDigitalConverter::start(uint8_t reg0) {
     start_reg0 = reg0;
 
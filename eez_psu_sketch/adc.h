@@ -52,6 +52,9 @@ public:
 
     void tick(uint32_t tick_usec);
 
+    /// Time (in microseconds) until the conversion in progress is read, see scheduler::TaskIdleFunction.
+    uint32_t getIdleTime(uint32_t tick_usec);
+
     void start(uint8_t reg0);
     int16_t read();
 
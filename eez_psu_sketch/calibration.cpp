@@ -339,7 +339,7 @@ bool canSave(int16_t &scpiErr) {
     return true;
 }
 
-bool save() {
+void updateCalibrationConf() {
     uint8_t year;
     uint8_t month;
     uint8_t day;
@@ -419,7 +419,10 @@ bool save() {
     }
 
     resetChannelToZero();
+}
 
+bool save() {
+    updateCalibrationConf();
     return persist_conf::saveChannelCalibration(g_channel);
 }
 
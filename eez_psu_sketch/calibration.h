@@ -109,6 +109,10 @@ void setRemark(const char *value, size_t len);
 /// Are all calibration parameters entered?
 bool canSave(int16_t &scpiErr);
 
+/// Copy entered calibration parameters to the channel calibration configuration,
+/// without writing it to the EEPROM.
+void updateCalibrationConf();
+
 /// Save calibration parameters entered during calibration procedure.
 bool save();
 
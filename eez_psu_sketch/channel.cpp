@@ -679,7 +679,8 @@ void Channel::tick(uint32_t tick_usec) {
     // If channel output is off then test PWRGOOD here, otherwise it is tested in Channel::eventGpio method.
 #if !CONF_SKIP_PWRGOOD_TEST
     if (!isOutputEnabled() && psu::isPowerUp()) {
-        testPwrgood(ioexp.readGpio());
+        // GPIO was read (or found unchanged) by ioexp.tick above
+        testPwrgood(ioexp.getGpio());
     }
 #endif
 
@@ -1460,6 +1461,25 @@ bool Channel::isTripped() {
         temperature::isAnySensorTripped(this);
 }
 
+uint16_t Channel::getStateFlags() {
+    uint16_t stateFlags = 0;
+
+    if (isOk()) {
+        if (isOutputEnabled()) stateFlags |= CH_STATE_OUTPUT_ENABLED;
+        if (isCvMode()) stateFlags |= CH_STATE_CV_MODE;
+        if (isCcMode()) stateFlags |= CH_STATE_CC_MODE;
+    } else {
+        stateFlags |= CH_STATE_FAULT;
+    }
+
+    if (ovp.flags.tripped) stateFlags |= CH_STATE_OVP_TRIPPED;
+    if (ocp.flags.tripped) stateFlags |= CH_STATE_OCP_TRIPPED;
+    if (opp.flags.tripped) stateFlags |= CH_STATE_OPP_TRIPPED;
+    if (temperature::isAnySensorTripped(this)) stateFlags |= CH_STATE_OTP_TRIPPED;
+
+    return stateFlags;
+}
+
 void Channel::clearProtection() {
     event_queue::Event lastEvent;
     event_queue::getLastErrorEvent(&lastEvent);
@@ -1501,7 +1521,9 @@ void Channel::setQuesBits(int bit_mask, bool on) {
     reg_set_ques_isum_bit(&serial::scpi_context, this, bit_mask, on);
 #if OPTION_ETHERNET
     if (ethernet::g_testResult == psu::TEST_OK) {
-        reg_set_ques_isum_bit(&ethernet::scpi_context, this, bit_mask, on);
+        for (int i = 0; i < ETHERNET_MAX_SESSIONS; ++i) {
+            reg_set_ques_isum_bit(ethernet::getScpiContext(i), this, bit_mask, on);
+        }
     }
 #endif
 }
@@ -1510,7 +1532,9 @@ void Channel::setOperBits(int bit_mask, bool on) {
     reg_set_oper_isum_bit(&serial::scpi_context, this, bit_mask, on);
 #if OPTION_ETHERNET
     if (ethernet::g_testResult == psu::TEST_OK) {
-        reg_set_oper_isum_bit(&ethernet::scpi_context, this, bit_mask, on);
+        for (int i = 0; i < ETHERNET_MAX_SESSIONS; ++i) {
+            reg_set_oper_isum_bit(ethernet::getScpiContext(i), this, bit_mask, on);
+        }
     }
 #endif
 }
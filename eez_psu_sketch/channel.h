@@ -58,6 +58,18 @@ enum TriggerMode {
     TRIGGER_MODE_STEP
 };
 
+/// Channel state flags returned by Channel::getStateFlags (MEASure:ALL?, telemetry).
+enum ChannelStateFlags {
+    CH_STATE_OUTPUT_ENABLED = (1 << 0),
+    CH_STATE_CV_MODE = (1 << 1),
+    CH_STATE_CC_MODE = (1 << 2),
+    CH_STATE_OVP_TRIPPED = (1 << 3),
+    CH_STATE_OCP_TRIPPED = (1 << 4),
+    CH_STATE_OPP_TRIPPED = (1 << 5),
+    CH_STATE_OTP_TRIPPED = (1 << 6),
+    CH_STATE_FAULT = (1 << 7)
+};
+
 /// PSU channel.
 class Channel {
     friend class DigitalAnalogConverter;
@@ -452,6 +464,9 @@ public:
     /// Is OVP, OCP or OPP tripped?
     bool isTripped();
 
+    /// Returns combination of ChannelStateFlags.
+    uint16_t getStateFlags();
+
     /// Clear channel protection tripp state.
     void clearProtection();
 
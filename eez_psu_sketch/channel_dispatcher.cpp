@@ -265,6 +265,7 @@ float getUProtectionLevel(const Channel &channel) {
 }
 
 void setVoltage(Channel &channel, float voltage) {
+    DigitalAnalogConverter::hold();
     if (isSeries()) {
         Channel::get(0).setVoltage(voltage / 2);
         Channel::get(1).setVoltage(voltage / 2);
@@ -274,6 +275,7 @@ void setVoltage(Channel &channel, float voltage) {
     } else {
         channel.setVoltage(voltage);
     }
+    DigitalAnalogConverter::release();
 }
 
 void setVoltageLimit(Channel &channel, float limit) {
@@ -411,6 +413,7 @@ float getIMax(const Channel &channel) {
 }
 
 void setCurrent(Channel &channel, float current) {
+    DigitalAnalogConverter::hold();
     if (isParallel()) {
         Channel::get(0).setCurrent(current / 2);
         Channel::get(1).setCurrent(current / 2);
@@ -420,6 +423,7 @@ void setCurrent(Channel &channel, float current) {
     } else {
         channel.setCurrent(current);
     }
+    DigitalAnalogConverter::release();
 }
 
 void setCurrentLimit(Channel &channel, float limit) {
@@ -434,6 +438,13 @@ void setCurrentLimit(Channel &channel, float limit) {
     }
 }
 
+void setVoltageAndCurrent(Channel &channel, float voltage, float current) {
+    DigitalAnalogConverter::hold();
+    setVoltage(channel, voltage);
+    setCurrent(channel, current);
+    DigitalAnalogConverter::release();
+}
+
 void setOcpParameters(Channel &channel, int state, float delay) {
     if (isCoupled() || isTracked()) {
         Channel::get(0).prot_conf.flags.i_state = state;
@@ -77,6 +77,10 @@ void setOcpParameters(Channel &channel, int state, float delay);
 void setOcpState(Channel &channel, int state);
 void setOcpDelay(Channel &channel, float delay);
 
+/// Set voltage and current with one DAC update, so both (and in coupled mode
+/// both channels) change at the same time.
+void setVoltageAndCurrent(Channel &channel, float voltage, float current);
+
 float getPowerLimit(const Channel& channel);
 float getPowerMinLimit(const Channel& channel);
 float getPowerMaxLimit(const Channel& channel);
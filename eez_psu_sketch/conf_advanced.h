@@ -34,6 +34,61 @@
 /// SCPI TCP server port.
 #define TCP_PORT 5025
 
+/// Maximum number of simultaneously connected SCPI clients over the ethernet.
+/// Each session has its own SCPI context, input buffer and error queue.
+/// ENC28J60 (UIPEthernet) is configured for 2 TCP connections and W5500 has 8 sockets
+/// from which some must be left for DHCP. Simulator allows more clients for load testing.
+#if defined(EEZ_PSU_SIMULATOR)
+#define ETHERNET_MAX_SESSIONS 8
+#elif EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R1B9
+#define ETHERNET_MAX_SESSIONS 2
+#elif EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R3B4 || EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R5B12
+#define ETHERNET_MAX_SESSIONS 4
+#endif
+
+/// Maximum number of bytes read from one ethernet client during one tick,
+/// so that one chatty client can't starve other clients and the main loop.
+#if EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R1B9
+#define ETHERNET_MAX_INPUT_PER_TICK 48
+#elif EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R3B4 || EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R5B12
+#define ETHERNET_MAX_INPUT_PER_TICK 256
+#endif
+
+/// When no client has unread data ethernet is polled only every this many main loop ticks.
+/// Client with unread data is serviced in every tick.
+#define ETHERNET_IDLE_POLL_PERIOD 2
+
+/// Default destination UDP port of the telemetry datagrams (SYSTem:COMMunicate:LAN:TELemetry).
+#define TELEMETRY_DEFAULT_PORT 5030
+
+/// Default and maximum number of telemetry datagrams sent per second.
+#define TELEMETRY_DEFAULT_RATE 10
+#define TELEMETRY_MAX_RATE 50
+
+/// Telemetry datagram is not sent if list step on some channel is due in less than this many microseconds.
+#define TELEMETRY_LIST_GUARD_TIME 2000
+
+/// TCP port of the HTTP status server (GET /status), 0 if server is not included.
+/// ENC28J60 (UIPEthernet) can't afford another TCP connection, so it is left out on R1B9.
+#if EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R1B9
+#define HTTP_PORT 0
+#elif EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R3B4 || EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R5B12
+#define HTTP_PORT 8080
+#endif
+
+/// Size of the buffer in which the HTTP response body (JSON) is composed.
+#define HTTP_RESPONSE_BUFFER_SIZE 1024
+
+/// Max. length of the HTTP request line (method, path and version) that is accepted.
+#define HTTP_REQUEST_LINE_MAX_LENGTH 64
+
+/// Client is disconnected if complete HTTP request is not received in this many milliseconds.
+#define HTTP_REQUEST_TIMEOUT 2000
+
+/// Status snapshot is reused for this many milliseconds, so the requests arriving
+/// faster than the ADC refreshes the measurements are answered from the same snapshot.
+#define HTTP_SNAPSHOT_MAX_AGE 50
+
 /// Name of the DAC chip.
 #define DAC_NAME "DAC8552"
 
@@ -72,6 +127,23 @@
 /// Maximum number of attempts to recover from ADC timeout before giving up.
 #define MAX_ADC_TIMEOUT_RECOVERY_ATTEMPTS 3
 
+/// Use interrupt-on-change output of the IO expander to find out when CC, CV, PWRGOOD
+/// or RPOL input is changed, instead of reading the GPIO register every tick.
+/// INT output of the IO expander is not connected to the MCU on the existing boards,
+/// so this is enabled only in the simulator where it is emulated.
+#if defined(EEZ_PSU_SIMULATOR)
+#define IOEXP_USE_INTERRUPTS 1
+/// MCU pins connected to the INT output of the CH1 and CH2 IO expander.
+#define IOEXP_INT1 200
+#define IOEXP_INT2 201
+#else
+#define IOEXP_USE_INTERRUPTS 0
+#endif
+
+/// If IOEXP_USE_INTERRUPTS is enabled, GPIO register is still read
+/// after this many microseconds without interrupt, in case some change was missed.
+#define IOEXP_REFRESH_PERIOD 100000
+
 /// Password minimum length in number characters.
 #define PASSWORD_MIN_LENGTH 4
 
@@ -128,6 +200,24 @@
 /// Profile name maximum length in number of characters.
 #define PROFILE_NAME_MAX_LENGTH 32
 
+/// Number of user macros (MEMory:MACRo) stored in EEPROM.
+/// Compiled macros don't fit in R1B9 RAM, so macros are left out there.
+#if EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R1B9
+#define NUM_MACRO_LOCATIONS 0
+#elif EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R3B4 || EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R5B12
+#define NUM_MACRO_LOCATIONS 8
+#endif
+
+/// Macro name maximum length in number of characters.
+#define MACRO_NAME_MAX_LENGTH 12
+
+/// Macro definition (program message) maximum length in number of characters.
+/// Macro must fit in 256 bytes EEPROM block.
+#define MACRO_TEXT_MAX_LENGTH 200
+
+/// Size in bytes of the compiled (parsed once) macro kept in RAM for fast replay.
+#define MACRO_COMPILED_MAX_LENGTH 256
+
 /// Size in number characters of SCPI parser input buffer.
 #if EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R1B9
 #define SCPI_PARSER_INPUT_BUFFER_LENGTH 48
@@ -138,6 +228,15 @@
 /// Size of SCPI parser error queue.
 #define SCPI_PARSER_ERROR_QUEUE_SIZE 20
 
+/// Maximum number of SCPI commands (*SAV, CAL:SAVE, MMEM:STOR:LIST, ...)
+/// waiting for execution in the background.
+/// R1B9 can't afford the RAM for a queued job, there these commands are executed immediately.
+#if EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R1B9
+#define JOB_QUEUE_SIZE 0
+#elif EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R3B4 || EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R5B12
+#define JOB_QUEUE_SIZE 4
+#endif
+
 /// Since we are not using timer, but ADC interrupt for the OVP and
 /// OCP delay measuring there will be some error (size of which
 /// depends on ADC_SPS value). You can use the following value, which
@@ -270,6 +369,56 @@
 /// Time in seconds of SCPI inactivity to declare SCPI to be idle.
 #define SCPI_IDLE_TIMEOUT 30
 
+/// Status register change is pushed to the client (STATus:NOTify) after this many microseconds,
+/// so that changes which follow in quick succession are reported in a single message.
+#define SCPI_STATUS_NOTIFY_DELAY 20000
+
+/// Group of settings started with SYSTem:GROup:BEGin is committed automatically
+/// if SYSTem:GROup:COMMit is not received within this many milliseconds.
+#define SCPI_GROUP_TIMEOUT 1000
+
+/// Execution time profile of every scheduler task (DEBUG:PROFile?, profile page) with duration histograms.
+/// It takes about 2.5 KB of RAM, so it is left out on R1B9.
+#if EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R1B9
+#define DEBUG_PROFILING 0
+#elif EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R3B4 || EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R5B12
+#define DEBUG_PROFILING CONF_DEBUG
+#endif
+
+/// Max. number of tasks registered with the main loop scheduler (see psu::addTasks).
+#if EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R1B9
+#define SCHEDULER_MAX_TASKS 17
+#elif EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R3B4 || EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R5B12
+#define SCHEDULER_MAX_TASKS 20
+#endif
+
+/// Max. number of widgets in the draw list of the page and max. number of the draw list items
+/// in the hit test grid (one item is counted for every grid cell it covers).
+/// Page with more widgets is drawn by walking the document.
+/// One draw list item takes about 24 bytes of RAM.
+#if EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R1B9
+#define GUI_DRAW_LIST_SIZE 32
+#define GUI_HIT_GRID_SIZE 96
+#elif EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R3B4 || EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R5B12
+#define GUI_DRAW_LIST_SIZE 128
+#define GUI_HIT_GRID_SIZE 256
+#endif
+
+/// Width and height in pixels of the hit test grid cell and max. number of cells (display is 320x240).
+#define GUI_HIT_GRID_CELL_SIZE 40
+#define GUI_HIT_GRID_MAX_CELLS 64
+
+/// Minimal time in microseconds between the starts of two display frames.
+#define GUI_FRAME_PERIOD 5000
+
+/// Display frame is drawn in parts, each GUI tick draws widgets for at most
+/// this many microseconds and the rest of the frame is drawn in the next ticks.
+#define GUI_DRAW_TICK_BUDGET 500
+
+/// Minimal time in microseconds between two GUI ticks, i.e. between two parts of the frame,
+/// so the GUI takes at most half of the main loop time.
+#define GUI_TICK_PERIOD 1000
+
 /// Changed but not confirmed value will be reset to current one
 /// after this timeout in seconds.
 /// See https://github.com/eez-open/psu-firmware/issues/84
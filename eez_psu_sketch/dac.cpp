@@ -18,6 +18,7 @@
  
 #include "psu.h"
 #include "dac.h"
+#include "calibration.h"
 
 namespace eez {
 namespace psu {
@@ -32,8 +33,34 @@ static const uint16_t DAC_MAX = (1L << DAC_RES) - 1;
 
 ////////////////////////////////////////////////////////////////////////////////
 
+/// Number of hold() calls without matching release().
+static uint8_t g_holdCounter;
+/// Values are held only while this is true, see enableHold().
+static bool g_holdEnabled = true;
+
+static DigitalAnalogConverter::Statistics g_statistics;
+
+////////////////////////////////////////////////////////////////////////////////
+
 DigitalAnalogConverter::DigitalAnalogConverter(Channel &channel_) : channel(channel_) {
     g_testResult = psu::TEST_SKIPPED;
+    m_testing = false;
+    m_values[0] = m_values[1] = DAC_MIN;
+    m_heldMask = 0;
+}
+
+void DigitalAnalogConverter::write(uint8_t control, uint16_t value) {
+    ++g_statistics.numTransactions;
+
+    SPI_beginTransaction(DAC8552_SPI);
+    digitalWrite(channel.dac_pin, LOW);
+
+    SPI.transfer(control);
+    SPI.transfer(value >> 8); // send first byte
+    SPI.transfer(value & 0xFF);  // send second byte
+
+    digitalWrite(channel.dac_pin, HIGH); // Deselect DAC
+    SPI_endTransaction();
 }
 
 void DigitalAnalogConverter::set_value(uint8_t buffer, float value) {
@@ -48,15 +75,18 @@ void DigitalAnalogConverter::set_value(uint8_t buffer, float value) {
     }
 #endif
 
-    SPI_beginTransaction(DAC8552_SPI);
-    digitalWrite(channel.dac_pin, LOW);
+    ++g_statistics.numWrites;
 
-    SPI.transfer(buffer);
-    SPI.transfer(DAC_value >> 8); // send first byte
-    SPI.transfer(DAC_value & 0xFF);  // send second byte
+    int i = buffer == DATA_BUFFER_A ? 0 : 1;
+    m_values[i] = DAC_value;
 
-    digitalWrite(channel.dac_pin, HIGH); // Deselect DAC
-    SPI_endTransaction();
+    if (g_holdCounter > 0 && g_holdEnabled && !isHoldBypassed()) {
+        m_heldMask |= 1 << i;
+        return;
+    }
+
+    m_heldMask &= ~(1 << i);
+    write(buffer, DAC_value);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -167,5 +197,73 @@ void DigitalAnalogConverter::set_current(float value) {
     set_value(DATA_BUFFER_B, util::remap(value, channel.I_MIN, (float)DAC_MIN, channel.getDualRangeMax(), (float)DAC_MAX));
 }
 
+////////////////////////////////////////////////////////////////////////////////
+
+void DigitalAnalogConverter::hold() {
+    ++g_holdCounter;
+}
+
+void DigitalAnalogConverter::enableHold(bool enable) {
+    g_holdEnabled = enable;
+}
+
+bool DigitalAnalogConverter::isHoldBypassed() {
+    // self test and calibration measure output right after the value is set
+    return m_testing || (calibration::isEnabled() && &calibration::getCalibrationChannel() == &channel);
+}
+
+bool DigitalAnalogConverter::isHeld() {
+    return g_holdCounter > 0;
+}
+
+uint32_t DigitalAnalogConverter::release() {
+    if (--g_holdCounter > 0) {
+        return 0;
+    }
+
+    // fill input buffer A of the channels where both outputs are changed,
+    // outputs are updated by the frames below
+    for (int i = 0; i < CH_NUM; ++i) {
+        DigitalAnalogConverter &dac = Channel::get(i).dac;
+        if (dac.m_heldMask == 3) {
+            dac.write(0, dac.m_values[0]);
+        }
+    }
+
+    // Writing input buffer B with both LOAD bits set updates both outputs at once,
+    // so every channel is updated with one frame and channels are updated back-to-back.
+    uint32_t firstLoad = 0;
+    uint32_t lastLoad = 0;
+    bool first = true;
+    for (int i = 0; i < CH_NUM; ++i) {
+        DigitalAnalogConverter &dac = Channel::get(i).dac;
+        if (dac.m_heldMask) {
+            uint32_t start = micros();
+
+            if (dac.m_heldMask == 1) {
+                dac.write(DATA_BUFFER_A, dac.m_values[0]);
+            } else if (dac.m_heldMask == 2) {
+                dac.write(DATA_BUFFER_B, dac.m_values[1]);
+            } else {
+                dac.write(BUFFER_SELECT_B | LOAD_A | LOAD_B, dac.m_values[1]);
+            }
+
+            if (first) {
+                firstLoad = start;
+                first = false;
+            }
+            lastLoad = start;
+
+            dac.m_heldMask = 0;
+        }
+    }
+
+    return lastLoad - firstLoad;
+}
+
+const DigitalAnalogConverter::Statistics &DigitalAnalogConverter::getStatistics() {
+    return g_statistics;
+}
+
 }
 } // namespace eez::psu
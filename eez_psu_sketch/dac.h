@@ -27,6 +27,12 @@ public:
     static const uint8_t DATA_BUFFER_A = 0B00010000;
     static const uint8_t DATA_BUFFER_B = 0B00100100;
 
+    /// Control byte bits. Data goes into input buffer B if BUFFER_SELECT_B is set (otherwise A),
+    /// LOAD_A and LOAD_B update DAC A and DAC B output from its input buffer.
+    static const uint8_t BUFFER_SELECT_B = 0B00000100;
+    static const uint8_t LOAD_A = 0B00010000;
+    static const uint8_t LOAD_B = 0B00100000;
+
     static const uint16_t DAC_MIN = 0;
     static const uint16_t DAC_MAX = (1L << DAC_RES) - 1;
 
@@ -42,11 +48,44 @@ public:
 
     bool isTesting() { return m_testing; }
 
+    struct Statistics {
+        /// Number of set_voltage and set_current calls.
+        uint32_t numWrites;
+        /// Number of SPI transactions actually sent to the DACs.
+        uint32_t numTransactions;
+    };
+
+    /// From now on set_voltage and set_current only remember the new values,
+    /// nothing is sent to the DAC until the matching release() is called.
+    /// Calls can be nested, values are sent by the outermost release().
+    /// Hold is ignored by the DAC under self test and by the DAC of the channel under calibration.
+    static void hold();
+    static bool isHeld();
+    /// While hold is disabled values are written immediately even if hold() is in effect.
+    /// Used to hold only the values set by the SCPI session which began the group.
+    static void enableHold(bool enable);
+
+    /// Write held values of all channels in one burst. Only the last value written
+    /// to each input buffer is sent. Input buffers are filled first and then both outputs
+    /// of every channel are updated with a single frame.
+    /// \returns Time in microseconds between the output update of the first and the last channel,
+    /// 0 if values are still held by the outer hold().
+    static uint32_t release();
+
+    static const Statistics &getStatistics();
+
 private:
     Channel &channel;
     bool m_testing;
 
+    /// Last value written to input buffer A and B.
+    uint16_t m_values[2];
+    /// Bit 0 (buffer A) and bit 1 (buffer B) are set if value is held.
+    uint8_t m_heldMask;
+
+    bool isHoldBypassed();
     void set_value(uint8_t buffer, float value);
+    void write(uint8_t control, uint16_t value);
 };
 
 }
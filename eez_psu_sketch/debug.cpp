@@ -23,6 +23,11 @@
 
 #define AVG_LOOP_DURATION_N 100
 
+#if DEBUG_PROFILING
+/// One for each scheduler task.
+#define MAX_PROFILE_VARIABLES SCHEDULER_MAX_TASKS
+#endif
+
 namespace eez {
 namespace psu {
 namespace debug {
@@ -39,6 +44,13 @@ DebugDurationVariable g_mainLoopDuration("MAIN_LOOP_DURATION");
 DebugDurationVariable g_listTickDuration("LIST_TICK_DURATION");
 #endif
 DebugCounterVariable g_adcCounter("ADC_COUNTER");
+#if OPTION_DISPLAY
+DebugDurationVariable g_guiFrameDuration("GUI_FRAME_DURATION");
+DebugCounterVariable g_lcdPixelCounter("LCD_PIXELS");
+#ifdef EEZ_PSU_SIMULATOR
+DebugCounterVariable g_lcdFlushPixelCounter("LCD_FLUSH_PIXELS");
+#endif
+#endif
 
 DebugVariable *g_variables[] = {
     &g_uDac[0],    &g_uDac[1],
@@ -52,9 +64,21 @@ DebugVariable *g_variables[] = {
 #if CONF_DEBUG_VARIABLES
     &g_listTickDuration,
 #endif
-    &g_adcCounter
+    &g_adcCounter,
+#if OPTION_DISPLAY
+    &g_guiFrameDuration,
+    &g_lcdPixelCounter,
+#ifdef EEZ_PSU_SIMULATOR
+    &g_lcdFlushPixelCounter
+#endif
+#endif
 };
 
+#if DEBUG_PROFILING
+DebugDurationVariable *g_profileVariables[MAX_PROFILE_VARIABLES];
+static int g_numProfileVariables;
+#endif
+
 bool g_debugWatchdog = true;
 
 static uint32_t g_previousTickCount1sec;
@@ -71,6 +95,22 @@ void dumpVariables(char *buffer) {
     }
 }
 
+#if DEBUG_PROFILING
+void addProfileVariable(DebugDurationVariable *variable) {
+    if (g_numProfileVariables < MAX_PROFILE_VARIABLES) {
+        g_profileVariables[g_numProfileVariables++] = variable;
+    }
+}
+
+int getNumProfileVariables() {
+    return g_numProfileVariables;
+}
+
+DebugDurationVariable *getProfileVariable(int index) {
+    return g_profileVariables[index];
+}
+#endif
+
 }
 }
 } // namespace eez::psu::debug
@@ -113,6 +153,11 @@ void tick(uint32_t tickCount) {
             for (unsigned i = 0; i < sizeof(g_variables) / sizeof(DebugVariable *); ++i) {
                 g_variables[i]->tick1secPeriod();
             }
+#if DEBUG_PROFILING
+            for (int i = 0; i < g_numProfileVariables; ++i) {
+                g_profileVariables[i]->tick1secPeriod();
+            }
+#endif
             g_previousTickCount1sec = tickCount;
         }
     } else {
@@ -124,6 +169,11 @@ void tick(uint32_t tickCount) {
             for (unsigned i = 0; i < sizeof(g_variables) / sizeof(DebugVariable *); ++i) {
                 g_variables[i]->tick10secPeriod();
             }
+#if DEBUG_PROFILING
+            for (int i = 0; i < g_numProfileVariables; ++i) {
+                g_profileVariables[i]->tick10secPeriod();
+            }
+#endif
             g_previousTickCount10sec = tickCount;
         }
     } else {
@@ -183,6 +233,9 @@ DebugDurationForPeriod::DebugDurationForPeriod()
     , m_total(0)
     , m_count(0)
 {
+#if DEBUG_PROFILING
+    memset(m_histogram, 0, sizeof(m_histogram));
+#endif
 }
 
 void DebugDurationForPeriod::tick(uint32_t duration) {
@@ -196,23 +249,67 @@ void DebugDurationForPeriod::tick(uint32_t duration) {
 
     m_total += duration;
     ++m_count;
+
+#if DEBUG_PROFILING
+    int bucket = 0;
+    for (uint32_t value = duration >> 2; value && bucket < HISTOGRAM_SIZE - 1; value >>= 1) {
+        ++bucket;
+    }
+    if (m_histogram[bucket] == 65535) {
+        // scale down all the buckets instead of losing the counts,
+        // percentiles are calculated from the proportions
+        for (int i = 0; i < HISTOGRAM_SIZE; ++i) {
+            m_histogram[i] >>= 1;
+        }
+    }
+    ++m_histogram[bucket];
+#endif
 }
 
+#if DEBUG_PROFILING
+uint32_t DebugDurationForPeriod::getPercentile(int percentile) {
+    uint32_t total = 0;
+    for (int i = 0; i < HISTOGRAM_SIZE; ++i) {
+        total += m_histogram[i];
+    }
+
+    uint32_t count = 0;
+    for (int i = 0; i < HISTOGRAM_SIZE - 1; ++i) {
+        count += m_histogram[i];
+        if (count * 100 >= total * percentile) {
+            uint32_t upperBound = (4UL << i) - 1;
+            return upperBound < m_max ? upperBound : m_max;
+        }
+    }
+
+    return m_max;
+}
+#endif
+
 void DebugDurationForPeriod::tickPeriod() {
     if (m_count > 0) {
         m_minLast = m_min;
         m_maxLast = m_max;
         m_avgLast = m_total / m_count;
+#if DEBUG_PROFILING
+        m_p99Last = getPercentile(99);
+#endif
     } else {
         m_minLast = 0;
         m_maxLast = 0;
         m_avgLast = 0;
+#if DEBUG_PROFILING
+        m_p99Last = 0;
+#endif
     }
 
     m_min = 4294967295;
     m_max = 0;
     m_total = 0;
     m_count = 0;
+#if DEBUG_PROFILING
+    memset(m_histogram, 0, sizeof(m_histogram));
+#endif
 }
 
 
@@ -222,6 +319,10 @@ void DebugDurationForPeriod::dump(char *buffer) {
     util::strcatUInt32(buffer, m_avgLast);
     strcat(buffer, " ");
     util::strcatUInt32(buffer, m_maxLast);
+#if DEBUG_PROFILING
+    strcat(buffer, " ");
+    util::strcatUInt32(buffer, m_p99Last);
+#endif
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -242,8 +343,11 @@ void DebugDurationVariable::finish() {
 }
 
 void DebugDurationVariable::tick(uint32_t tickCount) {
-    uint32_t duration = tickCount - m_lastTickCount;
+    addDuration(tickCount - m_lastTickCount);
+    m_lastTickCount = tickCount;
+}
 
+void DebugDurationVariable::addDuration(uint32_t duration) {
     duration1sec.tick(duration);
     duration10sec.tick(duration);
 
@@ -254,8 +358,6 @@ void DebugDurationVariable::tick(uint32_t tickCount) {
     if (duration > m_maxTotal) {
         m_maxTotal = duration;
     }
-
-    m_lastTickCount = tickCount;
 }
 
 void DebugDurationVariable::tick1secPeriod() {
@@ -280,6 +382,12 @@ void DebugDurationVariable::dump(char *buffer) {
     util::strcatUInt32(buffer, m_maxTotal);
 }
 
+#if DEBUG_PROFILING
+void DebugDurationVariable::dump1sec(char *buffer) {
+    duration1sec.dump(buffer);
+}
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 
 DebugCounterForPeriod::DebugCounterForPeriod() : m_counter(0) {
@@ -289,6 +397,10 @@ void DebugCounterForPeriod::inc() {
     ++m_counter;
 }
 
+void DebugCounterForPeriod::add(uint32_t value) {
+    m_counter += value;
+}
+
 void DebugCounterForPeriod::tickPeriod() {
     noInterrupts();
     m_lastCounter = m_counter;
@@ -312,6 +424,12 @@ void DebugCounterVariable::inc() {
     ++m_totalCounter;
 }
 
+void DebugCounterVariable::add(uint32_t value) {
+    counter1sec.add(value);
+    counter10sec.add(value);
+    m_totalCounter += value;
+}
+
 void DebugCounterVariable::tick1secPeriod() {
     counter1sec.tickPeriod();
 }
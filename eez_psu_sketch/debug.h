@@ -60,6 +60,7 @@ public:
     DebugVariable(const char *name);
 
     const char *name();
+    void setName(const char *name) { m_name = name; }
 
     virtual void tick1secPeriod() = 0;
     virtual void tick10secPeriod() = 0;
@@ -93,30 +94,49 @@ public:
     void dump(char *buffer);
 
 private:
+#if DEBUG_PROFILING
+    /// Number of histogram buckets, bucket N counts durations below 2^(N+2) microseconds
+    /// (and at least 2^(N+1) for N > 0), the last bucket counts all the longer durations.
+    static const int HISTOGRAM_SIZE = 16;
+#endif
+
     uint32_t m_lastTickCount;
 
     uint32_t m_min;
     uint32_t m_max;
     uint32_t m_total;
     uint32_t m_count;
+#if DEBUG_PROFILING
+    uint16_t m_histogram[HISTOGRAM_SIZE];
+#endif
 
     uint32_t m_minLast;
     uint32_t m_maxLast;
     uint32_t m_avgLast;
+#if DEBUG_PROFILING
+    /// Estimated from the histogram, i.e. it is the upper bound of the bucket where 99th percentile falls.
+    uint32_t m_p99Last;
 
+    uint32_t getPercentile(int percentile);
+#endif
 };
 
 class DebugDurationVariable : public DebugVariable {
 public:
-    DebugDurationVariable(const char *name);
+    DebugDurationVariable(const char *name = 0);
     
     void start();
     void finish();
     void tick(uint32_t tickCount);
+    void addDuration(uint32_t duration);
 
     void tick1secPeriod();
     void tick10secPeriod();
     void dump(char *buffer);
+#if DEBUG_PROFILING
+    /// Dump only "min avg max p99" of the last 1 second period.
+    void dump1sec(char *buffer);
+#endif
 
 private:
     uint32_t m_lastTickCount;
@@ -133,6 +153,7 @@ public:
     DebugCounterForPeriod();
     
     void inc();
+    void add(uint32_t value);
     void tickPeriod();
     void dump(char *buffer);
 
@@ -146,6 +167,7 @@ public:
     DebugCounterVariable(const char *name);
     
     void inc();
+    void add(uint32_t value);
 
     void tick1secPeriod();
     void tick10secPeriod();
@@ -170,11 +192,29 @@ extern DebugDurationVariable g_mainLoopDuration;
 extern DebugDurationVariable g_listTickDuration;
 #endif
 extern DebugCounterVariable g_adcCounter;
+#if OPTION_DISPLAY
+/// Time spent drawing one GUI frame.
+extern DebugDurationVariable g_guiFrameDuration;
+/// Number of pixels drawn to the display.
+extern DebugCounterVariable g_lcdPixelCounter;
+#ifdef EEZ_PSU_SIMULATOR
+/// Number of pixels in the dirty rectangles taken by EEZ_UTFT::takeDirtyRects.
+extern DebugCounterVariable g_lcdFlushPixelCounter;
+#endif
+#endif
 
 extern bool g_debugWatchdog;
 
 void dumpVariables(char *buffer);
 
+#if DEBUG_PROFILING
+/// Add duration variable of one main loop stage (scheduler task) to the profile.
+void addProfileVariable(DebugDurationVariable *variable);
+
+int getNumProfileVariables();
+DebugDurationVariable *getProfileVariable(int index);
+#endif
+
 }
 }
 } // namespace eez::psu::debug
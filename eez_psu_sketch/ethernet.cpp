@@ -20,6 +20,7 @@
 
 #include "persist_conf.h"
 #include "event_queue.h"
+#include "scheduler.h"
 
 #if OPTION_ETHERNET
 
@@ -48,8 +49,34 @@ uint8_t mac[6] = ETHERNET_MAC_ADDRESS;
 
 EthernetServer server(TCP_PORT);
 
-bool alreadyConnected = false;
-EthernetClient activeClient;
+/// SCPI session of one TCP client.
+struct Session {
+    bool connected;
+    EthernetClient client;
+
+    scpi_reg_val_t scpi_psu_regs[SCPI_PSU_REG_COUNT];
+    scpi_psu_t scpi_psu_context;
+
+    char scpi_input_buffer[SCPI_PARSER_INPUT_BUFFER_LENGTH];
+    int16_t error_queue_data[SCPI_PARSER_ERROR_QUEUE_SIZE + 1];
+
+    scpi_t scpi_context;
+};
+
+static Session g_sessions[ETHERNET_MAX_SESSIONS];
+
+/// Session from which next tick will start reading the input.
+static int g_nextSessionIndex;
+
+/// Some client had more data than was read during the last tick.
+static bool g_rxPending;
+/// Number of ticks since the sockets were last polled.
+static uint8_t g_idleTicks;
+
+static Statistics g_statistics;
+static uint32_t g_throughputWindowStart;
+static uint32_t g_rxBytesInWindow;
+static uint32_t g_txBytesInWindow;
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -58,6 +85,9 @@ size_t ethernet_client_write(EthernetClient &client, const char *data, size_t le
     size_t size = client.write(data, len);
     SPI_endTransaction();
 
+    g_statistics.txBytes += size;
+    g_txBytesInWindow += size;
+
     return size;
 }
 
@@ -65,10 +95,27 @@ size_t ethernet_client_write_str(EthernetClient &client, const char *str) {
     return ethernet_client_write(client, str, strlen(str));
 }
 
+static Session *getSession(scpi_t *context) {
+    for (int i = 0; i < ETHERNET_MAX_SESSIONS; ++i) {
+        if (&g_sessions[i].scpi_context == context) {
+            return &g_sessions[i];
+        }
+    }
+    return 0;
+}
+
+static size_t session_write(scpi_t *context, const char *data, size_t len) {
+    Session *session = getSession(context);
+    if (!session || !session->connected) {
+        return 0;
+    }
+    return ethernet_client_write(session->client, data, len);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 size_t SCPI_Write(scpi_t *context, const char * data, size_t len) {
-    return ethernet_client_write(activeClient, data, len);
+    return session_write(context, data, len);
 }
 
 scpi_result_t SCPI_Flush(scpi_t * context) {
@@ -79,7 +126,7 @@ int SCPI_Error(scpi_t *context, int_fast16_t err) {
     if (err != 0) {
         char errorOutputBuffer[256];
         sprintf_P(errorOutputBuffer, PSTR("**ERROR: %d,\"%s\"\r\n"), (int16_t)err, SCPI_ErrorTranslate(err));
-        ethernet_client_write(activeClient, errorOutputBuffer, strlen(errorOutputBuffer));
+        session_write(context, errorOutputBuffer, strlen(errorOutputBuffer));
     }
 
     return 0;
@@ -93,7 +140,7 @@ scpi_result_t SCPI_Control(scpi_t *context, scpi_ctrl_name_t ctrl, scpi_reg_val_
         sprintf_P(outputBuffer, PSTR("**CTRL %02x: 0x%X (%d)\r\n"), ctrl, val, val);
     }
 
-    ethernet_client_write(activeClient, outputBuffer, strlen(outputBuffer));
+    session_write(context, outputBuffer, strlen(outputBuffer));
 
     return SCPI_RES_OK;
 }
@@ -108,9 +155,6 @@ scpi_result_t SCPI_Reset(scpi_t *context) {
 
 ////////////////////////////////////////////////////////////////////////////////
 
-scpi_reg_val_t scpi_psu_regs[SCPI_PSU_REG_COUNT];
-scpi_psu_t scpi_psu_context = { scpi_psu_regs, 1 };
-
 scpi_interface_t scpi_interface = {
     SCPI_Error,
     SCPI_Write,
@@ -119,11 +163,6 @@ scpi_interface_t scpi_interface = {
     SCPI_Reset,
 };
 
-char scpi_input_buffer[SCPI_PARSER_INPUT_BUFFER_LENGTH];
-int16_t error_queue_data[SCPI_PARSER_ERROR_QUEUE_SIZE + 1];
-
-scpi_t scpi_context;
-
 ////////////////////////////////////////////////////////////////////////////////
 
 void init() {
@@ -159,6 +198,21 @@ void init() {
 
     SPI.endTransaction();
 
+    for (int i = 0; i < ETHERNET_MAX_SESSIONS; ++i) {
+        Session &session = g_sessions[i];
+
+        session.connected = false;
+
+        session.scpi_psu_context.registers = session.scpi_psu_regs;
+        session.scpi_psu_context.selected_channel_index = 1;
+
+        scpi::init(session.scpi_context,
+            session.scpi_psu_context,
+            &scpi_interface,
+            session.scpi_input_buffer, SCPI_PARSER_INPUT_BUFFER_LENGTH,
+            session.error_queue_data, SCPI_PARSER_ERROR_QUEUE_SIZE + 1);
+    }
+
     g_testResult = psu::TEST_OK;
 
     DebugTraceF("Listening on port %d", (int)TCP_PORT);
@@ -171,12 +225,6 @@ void init() {
     Serial.print("DNS IP: "); Serial.println(Ethernet.dnsServerIP());
 #endif
 #endif
-
-    scpi::init(scpi_context,
-        scpi_psu_context,
-        &scpi_interface,
-        scpi_input_buffer, SCPI_PARSER_INPUT_BUFFER_LENGTH,
-        error_queue_data, SCPI_PARSER_ERROR_QUEUE_SIZE + 1);
 }
 
 bool test() {
@@ -187,51 +235,182 @@ bool test() {
     return g_testResult != psu::TEST_FAILED;
 }
 
-void tick(uint32_t tick_usec) {
-    if (g_testResult != psu::TEST_OK) {
-        return;
+static void acceptClient(EthernetClient &client) {
+    for (int i = 0; i < ETHERNET_MAX_SESSIONS; ++i) {
+        if (g_sessions[i].connected && g_sessions[i].client == client) {
+            // already have a session for this client
+            return;
+        }
+    }
+
+    for (int i = 0; i < ETHERNET_MAX_SESSIONS; ++i) {
+        Session &session = g_sessions[i];
+        if (!session.connected) {
+            client.flush();
+            session.client = client;
+            session.connected = true;
+            // discard unfinished command left by the previous client
+            session.scpi_context.buffer.position = 0;
+            session.scpi_context.input_count = 0;
+            session.scpi_psu_context.inputOverrun = false;
+            setNotify(session.scpi_context, false);
+            // new client always starts with ASCII responses
+            SCPI_SetResultFormat(&session.scpi_context, FALSE, SCPI_FORMAT_NORMAL);
+            DebugTraceF("A new ethernet client detected (session %d)!", i + 1);
+            return;
+        }
     }
 
+    SPI_endTransaction();
+    ethernet_client_write_str(client, "**ERROR: too many clients connected\r\n");
     SPI_beginTransaction(ETHERNET_SPI);
+    client.stop();
+    DebugTrace("Too many ethernet clients, new client rejected!");
+}
 
-    if (alreadyConnected) {
-        if (!activeClient.connected()) {
-            alreadyConnected = false;
-            activeClient = EthernetClient();
+static void sessionTick(Session &session) {
+    // Read until ETHERNET_MAX_INPUT_PER_TICK bytes are received or there is no more data,
+    // available() may report only part of the received data (e.g. one packet).
+    size_t budget = ETHERNET_MAX_INPUT_PER_TICK;
+    while (budget > 0) {
+        // Data is received directly into the free space of the SCPI input buffer.
+        // This is done before SPI transaction is started because,
+        // if input buffer is full, SCPI parser is called to make some room.
+        size_t freeSize;
+        char *buffer = scpi::getInputBuffer(session.scpi_context, freeSize);
+
+        SPI_beginTransaction(ETHERNET_SPI);
+
+        if (!session.client.connected()) {
+            SPI_endTransaction();
+            session.connected = false;
+            session.client = EthernetClient();
             DebugTrace("Ethernet client lost!");
+            return;
         }
+
+        size_t available = session.client.available();
+        if (available == 0) {
+            SPI_endTransaction();
+            return;
+        }
+
+        size_t size = available;
+        if (size > budget) {
+            size = budget;
+        }
+        if (size > freeSize) {
+            size = freeSize;
+        }
+
+        int result = session.client.read((uint8_t *)buffer, size);
+
+        SPI_endTransaction();
+
+        ++g_statistics.rxReads;
+
+        if (result <= 0) {
+            return;
+        }
+
+        g_statistics.rxBytes += result;
+        g_rxBytesInWindow += result;
+
+        inputCommit(session.scpi_context, result);
+
+        budget -= result;
     }
 
-    EthernetClient client = server.available();
+    // per tick limit is reached, service this client again in the next tick
+    g_rxPending = true;
+}
+
+static void updateThroughput(uint32_t tick_usec) {
+    uint32_t duration = tick_usec - g_throughputWindowStart;
+    if (duration >= 1000000L) {
+        g_statistics.rxBytesPerSecond = (uint32_t)(1000000.0f * g_rxBytesInWindow / duration);
+        g_statistics.txBytesPerSecond = (uint32_t)(1000000.0f * g_txBytesInWindow / duration);
+        g_rxBytesInWindow = 0;
+        g_txBytesInWindow = 0;
+        g_throughputWindowStart = tick_usec;
+    }
+}
+
+void tick(uint32_t tick_usec) {
+    if (g_testResult != psu::TEST_OK) {
+        return;
+    }
+
+    updateThroughput(tick_usec);
 
+    // if there is no unread data, poll sockets only every ETHERNET_IDLE_POLL_PERIOD ticks
+    if (!g_rxPending && ++g_idleTicks < ETHERNET_IDLE_POLL_PERIOD) {
+        ++g_statistics.skippedPolls;
+        return;
+    }
+    g_idleTicks = 0;
+    g_rxPending = false;
+
+    SPI_beginTransaction(ETHERNET_SPI);
+    EthernetClient client = server.available();
     if (client) {
-        if (!alreadyConnected) {
-            client.flush();
-            activeClient = client;
-            alreadyConnected = true;
-            DebugTrace("A new ethernet client detected!");
+        acceptClient(client);
+    }
+    SPI_endTransaction();
+
+    // service sessions round robin, every session can consume
+    // at most ETHERNET_MAX_INPUT_PER_TICK bytes during one tick
+    for (int i = 0; i < ETHERNET_MAX_SESSIONS; ++i) {
+        Session &session = g_sessions[(g_nextSessionIndex + i) % ETHERNET_MAX_SESSIONS];
+        if (session.connected) {
+            sessionTick(session);
         }
+    }
+    g_nextSessionIndex = (g_nextSessionIndex + 1) % ETHERNET_MAX_SESSIONS;
+}
 
-        size_t size;
-        while ((size = client.available()) > 0) {
-            uint8_t* msg = (uint8_t*)malloc(size);
-            size = client.read(msg, size);
-            if (client == activeClient) {
-                SPI_endTransaction();
-                input(scpi_context, (const char *)msg, size);
-                SPI_beginTransaction(ETHERNET_SPI);
-            }
-            else {
-                SPI_endTransaction();
-                ethernet_client_write_str(client, "**ERROR: another client already connected\r\n");
-                SPI_beginTransaction(ETHERNET_SPI);
-                DebugTrace("Another client detected and ignored!");
+uint32_t getIdleTime(uint32_t tick_usec) {
+    if (g_testResult != psu::TEST_OK) {
+        return scheduler::IDLE_FOREVER;
+    }
+
+    if (g_rxPending || g_idleTicks > 0) {
+        return 0;
+    }
+
+    // input could be already received while some other task was using the network
+    for (int i = 0; i < ETHERNET_MAX_SESSIONS; ++i) {
+        Session &session = g_sessions[i];
+        if (session.connected) {
+            SPI_beginTransaction(ETHERNET_SPI);
+            int available = session.client.available();
+            SPI_endTransaction();
+
+            if (available > 0) {
+                return 0;
             }
-            free(msg);
         }
     }
 
-    SPI_endTransaction();
+    return scheduler::IDLE_FOREVER;
+}
+
+scpi_t *getScpiContext(int sessionIndex) {
+    return &g_sessions[sessionIndex].scpi_context;
+}
+
+int getNumConnectedSessions() {
+    int n = 0;
+    for (int i = 0; i < ETHERNET_MAX_SESSIONS; ++i) {
+        if (g_sessions[i].connected) {
+            ++n;
+        }
+    }
+    return n;
+}
+
+const Statistics &getStatistics() {
+    return g_statistics;
 }
 
 uint32_t getIpAddress() {
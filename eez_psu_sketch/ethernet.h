@@ -26,13 +26,36 @@ namespace ethernet {
 
 extern TestResult g_testResult;
 
-extern scpi_t scpi_context;
+struct Statistics {
+    uint32_t rxBytes;
+    uint32_t txBytes;
+    /// Number of socket reads.
+    uint32_t rxReads;
+    /// Number of ticks in which sockets were not polled because there was no pending input.
+    uint32_t skippedPolls;
+    /// Throughput measured during the last second.
+    uint32_t rxBytesPerSecond;
+    uint32_t txBytesPerSecond;
+};
 
 void init();
 bool test();
 
 void tick(uint32_t tick_usec);
 
+/// 0 if some client has unread data or sockets were not polled in the last tick,
+/// otherwise ethernet waits for the next client input, see scheduler::TaskIdleFunction.
+uint32_t getIdleTime(uint32_t tick_usec);
+
+/// SCPI context of the session slot (0 .. ETHERNET_MAX_SESSIONS - 1).
+/// Every session slot keeps its own context, input buffer and error queue.
+scpi_t *getScpiContext(int sessionIndex);
+
+/// Number of currently connected ethernet SCPI clients.
+int getNumConnectedSessions();
+
+const Statistics &getStatistics();
+
 uint32_t getIpAddress();
 
 }
@@ -69,6 +69,7 @@
 
 #define INTERNAL_PAGE_ID_NONE             -1
 #define INTERNAL_PAGE_ID_SELECT_FROM_ENUM -2
+#define INTERNAL_PAGE_ID_PROFILE          -3
 
 #define MAX_EVENTS 16
 
@@ -333,6 +334,12 @@ void pushSelectFromEnumPage(const data::EnumItem *enumDefinition, uint8_t curren
     pushPage(INTERNAL_PAGE_ID_SELECT_FROM_ENUM, new SelectFromEnumPage(enumDefinition, currentValue, disabledValue, onSet));
 }
 
+#if DEBUG_PROFILING
+void pushProfilePage() {
+    pushPage(INTERNAL_PAGE_ID_PROFILE, new ProfilePage());
+}
+#endif
+
 void dialogYes() {
     popPage();
 
@@ -29,6 +29,9 @@ void init();
 void tick(uint32_t tick_usec);
 void touchHandling(uint32_t tick_usec);
 
+/// Time (in microseconds) until the next frame is drawn, see scheduler::TaskIdleFunction.
+uint32_t getIdleTime(uint32_t tick_usec);
+
 void refreshPage();
 
 void showWelcomePage();
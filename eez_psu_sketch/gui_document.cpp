@@ -2658,5103 +2658,983 @@ const uint8_t *fonts[] = {
 
 // BITMAP DEFINITIONS
 
-const uint8_t bitmap_pixel_data_logo[4608] PROGMEM = {
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0xBD, 0x4B, 0xB5, 0x32, 0xCE, 0x21, 0x29, 0x11, 0xA5, 0x08, 0x42, 0x00, 0x21, 0x00,
-    0x21, 0x00, 0x42, 0x00, 0xA5, 0x08, 0x29, 0x11, 0xEE, 0x21, 0xB5, 0x32, 0xBD, 0x4B, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0xDE, 0x4B, 0x72, 0x2A,
-    0xE7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x11,
-    0x73, 0x32, 0xDE, 0x4B, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0xBD, 0x4B, 0xEF, 0x21, 0x21, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xC3, 0x18, 0x49, 0x4A, 0xCF, 0x7B, 0xF3, 0x9C, 0x96, 0xB5, 0x18, 0xC6,
-    0x18, 0xC6, 0x96, 0xB5, 0xD3, 0x9C, 0xCF, 0x7B, 0x49, 0x4A, 0xA2, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x41, 0x00, 0xEF, 0x21, 0xBD, 0x4B, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0xFF, 0x4B, 0x31, 0x2A, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x18,
-    0x6D, 0x6B, 0x18, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x18, 0xC6, 0x4D, 0x6B,
-    0xA2, 0x10, 0x00, 0x00, 0x00, 0x00, 0x42, 0x00, 0x52, 0x2A, 0xFF, 0x4B, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x7B, 0x43, 0xE7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0xB2, 0x94, 0xBE, 0xF7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xBE, 0xF7, 0x71, 0x8C, 0xE3, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x10, 0x9B, 0x43, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0xF6, 0x3A, 0x41, 0x00, 0x00, 0x00, 0x61, 0x08, 0xCF, 0x7B, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x8E, 0x73, 0x41, 0x08, 0x00, 0x00, 0x42, 0x00, 0xF7, 0x3A,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x73, 0x32,
-    0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x59, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xC6, 0x04, 0x21, 0x00, 0x00, 0x00, 0x00,
-    0xB5, 0x32, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x73, 0x32, 0x00, 0x00,
-    0x00, 0x00, 0x08, 0x42, 0x7D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0x5D, 0xEF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
-    0x3C, 0xE7, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xEF, 0xE7, 0x39, 0x00, 0x00,
-    0x00, 0x00, 0xB5, 0x32, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0xF6, 0x3A, 0x00, 0x00, 0x00, 0x00,
-    0x69, 0x4A, 0xDF, 0xFF, 0xFF, 0xFF, 0xBA, 0xD6, 0x0C, 0x63, 0xC3, 0x18, 0x00, 0x00, 0x00, 0x00,
-    0xA2, 0x10, 0xAA, 0x52, 0x59, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xAD, 0x08, 0x42, 0x61, 0x08,
-    0x00, 0x00, 0x20, 0x00, 0x24, 0x21, 0xCF, 0x7B, 0x7D, 0xEF, 0xFF, 0xFF, 0x9E, 0xF7, 0x28, 0x42,
-    0x00, 0x00, 0x00, 0x00, 0xF7, 0x3A, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x7B, 0x43, 0x42, 0x00, 0x00, 0x00, 0x28, 0x42,
-    0xDF, 0xFF, 0xFF, 0xFF, 0x71, 0x8C, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xCF, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0x49, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x18, 0xF7, 0xBD, 0xFF, 0xFF, 0x9E, 0xF7,
-    0xE7, 0x39, 0x00, 0x00, 0x42, 0x00, 0x9C, 0x43, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0xFF, 0x4B, 0xE7, 0x10, 0x00, 0x00, 0x24, 0x21, 0x7D, 0xEF,
+const uint8_t bitmap_pixel_data_logo[2610] PROGMEM = {
+    0x90, 0x1F, 0x54, 0x0D, 0xBD, 0x4B, 0xB5, 0x32, 0xCE, 0x21, 0x29, 0x11, 0xA5, 0x08, 0x42, 0x00,
+    0x21, 0x00, 0x21, 0x00, 0x42, 0x00, 0xA5, 0x08, 0x29, 0x11, 0xEE, 0x21, 0xB5, 0x32, 0xBD, 0x4B,
+    0x90, 0x1F, 0x54, 0x8D, 0x1F, 0x54, 0x02, 0xDE, 0x4B, 0x72, 0x2A, 0xE7, 0x10, 0x8D, 0x00, 0x00,
+    0x02, 0x07, 0x11, 0x73, 0x32, 0xDE, 0x4B, 0x8D, 0x1F, 0x54, 0x8B, 0x1F, 0x54, 0x02, 0xBD, 0x4B,
+    0xEF, 0x21, 0x21, 0x00, 0x82, 0x00, 0x00, 0x0B, 0xC3, 0x18, 0x49, 0x4A, 0xCF, 0x7B, 0xF3, 0x9C,
+    0x96, 0xB5, 0x18, 0xC6, 0x18, 0xC6, 0x96, 0xB5, 0xD3, 0x9C, 0xCF, 0x7B, 0x49, 0x4A, 0xA2, 0x10,
+    0x82, 0x00, 0x00, 0x02, 0x41, 0x00, 0xEF, 0x21, 0xBD, 0x4B, 0x8B, 0x1F, 0x54, 0x89, 0x1F, 0x54,
+    0x07, 0xFF, 0x4B, 0x31, 0x2A, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x18, 0x6D, 0x6B, 0x18,
+    0xC6, 0x8A, 0xFF, 0xFF, 0x08, 0xDF, 0xFF, 0x18, 0xC6, 0x4D, 0x6B, 0xA2, 0x10, 0x00, 0x00, 0x00,
+    0x00, 0x42, 0x00, 0x52, 0x2A, 0xFF, 0x4B, 0x89, 0x1F, 0x54, 0x88, 0x1F, 0x54, 0x06, 0x7B, 0x43,
+    0xE7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0xB2, 0x94, 0xBE, 0xF7, 0x8F, 0xFF, 0xFF, 0x06,
+    0xBE, 0xF7, 0x71, 0x8C, 0xE3, 0x18, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x10, 0x9B, 0x43, 0x88, 0x1F,
+    0x54, 0x87, 0x1F, 0x54, 0x05, 0xF6, 0x3A, 0x41, 0x00, 0x00, 0x00, 0x61, 0x08, 0xCF, 0x7B, 0xBE,
+    0xF7, 0x93, 0xFF, 0xFF, 0x05, 0x9E, 0xF7, 0x8E, 0x73, 0x41, 0x08, 0x00, 0x00, 0x42, 0x00, 0xF7,
+    0x3A, 0x87, 0x1F, 0x54, 0x86, 0x1F, 0x54, 0x04, 0x73, 0x32, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21,
+    0x59, 0xCE, 0x97, 0xFF, 0xFF, 0x04, 0x38, 0xC6, 0x04, 0x21, 0x00, 0x00, 0x00, 0x00, 0xB5, 0x32,
+    0x86, 0x1F, 0x54, 0x85, 0x1F, 0x54, 0x04, 0x73, 0x32, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42, 0x7D,
+    0xEF, 0x82, 0xFF, 0xFF, 0x01, 0x7D, 0xEF, 0x5D, 0xEF, 0x8E, 0xFF, 0xFF, 0x02, 0xDF, 0xFF, 0x3C,
+    0xE7, 0xBE, 0xF7, 0x82, 0xFF, 0xFF, 0x04, 0x5D, 0xEF, 0xE7, 0x39, 0x00, 0x00, 0x00, 0x00, 0xB5,
+    0x32, 0x85, 0x1F, 0x54, 0x84, 0x1F, 0x54, 0x0D, 0xF6, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x69, 0x4A,
+    0xDF, 0xFF, 0xFF, 0xFF, 0xBA, 0xD6, 0x0C, 0x63, 0xC3, 0x18, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x10,
+    0xAA, 0x52, 0x59, 0xCE, 0x89, 0xFF, 0xFF, 0x0D, 0x55, 0xAD, 0x08, 0x42, 0x61, 0x08, 0x00, 0x00,
+    0x20, 0x00, 0x24, 0x21, 0xCF, 0x7B, 0x7D, 0xEF, 0xFF, 0xFF, 0x9E, 0xF7, 0x28, 0x42, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0x3A, 0x84, 0x1F, 0x54, 0x83, 0x1F, 0x54, 0x07, 0x7B, 0x43, 0x42, 0x00, 0x00,
+    0x00, 0x28, 0x42, 0xDF, 0xFF, 0xFF, 0xFF, 0x71, 0x8C, 0x61, 0x08, 0x85, 0x00, 0x00, 0x01, 0x41,
+    0x08, 0xCF, 0x7B, 0x86, 0xFF, 0xFF, 0x01, 0x7D, 0xEF, 0x49, 0x4A, 0x86, 0x00, 0x00, 0x07, 0xE3,
+    0x18, 0xF7, 0xBD, 0xFF, 0xFF, 0x9E, 0xF7, 0xE7, 0x39, 0x00, 0x00, 0x42, 0x00, 0x9C, 0x43, 0x83,
+    0x1F, 0x54, 0x82, 0x1F, 0x54, 0x11, 0xFF, 0x4B, 0xE7, 0x10, 0x00, 0x00, 0x24, 0x21, 0x7D, 0xEF,
     0xFF, 0xFF, 0x92, 0x94, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x31, 0x14, 0xA5, 0xDB, 0xDE, 0xDB, 0xDE,
-    0x14, 0xA5, 0xA6, 0x31, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xE7, 0x39, 0x00, 0x00, 0x41, 0x08, 0x0C, 0x63, 0xD7, 0xBD,
-    0x1C, 0xE7, 0x59, 0xCE, 0xEF, 0x7B, 0xA2, 0x10, 0x00, 0x00, 0x61, 0x08, 0x59, 0xCE, 0xFF, 0xFF,
-    0x5D, 0xEF, 0x04, 0x21, 0x00, 0x00, 0x07, 0x11, 0xFF, 0x4B, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x52, 0x2A, 0x00, 0x00, 0x61, 0x08, 0x59, 0xCE, 0xFF, 0xFF,
-    0xDB, 0xDE, 0x61, 0x08, 0x00, 0x00, 0x0C, 0x63, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xEB, 0x5A, 0x00, 0x00, 0x41, 0x08, 0x38, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x84, 0x00, 0x00, 0x61, 0x08, 0x96, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xDE, 0x24, 0x21, 0x00, 0x00, 0x65, 0x29, 0xDF, 0xFF,
-    0xFF, 0xFF, 0x18, 0xC6, 0x41, 0x08, 0x00, 0x00, 0x73, 0x2A, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0xBD, 0x4B, 0x42, 0x00, 0x00, 0x00, 0xCF, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x4D, 0x6B, 0x00, 0x00, 0x86, 0x31, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x86, 0x31, 0x00, 0x00, 0xEB, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xDF, 0xFF, 0xC3, 0x18, 0x00, 0x00, 0x30, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0x20, 0x00, 0x00, 0x00, 0x34, 0xA5,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x73, 0x00, 0x00, 0x42, 0x00, 0xDE, 0x4B, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0xEF, 0x21, 0x00, 0x00, 0x04, 0x21, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x04, 0x21, 0x00, 0x00, 0xF3, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x9C, 0x00, 0x00, 0xC7, 0x39, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x38, 0xC6, 0x00, 0x00, 0x82, 0x10, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x42, 0x00, 0x00, 0x0C, 0x63,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xE3, 0x18, 0x00, 0x00, 0xEF, 0x21, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0xDE, 0x4B, 0x21, 0x00, 0x00, 0x00, 0xB2, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7,
-    0x20, 0x00, 0x00, 0x00, 0x79, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xBD, 0x00, 0x00, 0x65, 0x29, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAE, 0x73, 0x00, 0x00, 0xC7, 0x39,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x71, 0x8C, 0x00, 0x00, 0x42, 0x00, 0xDE, 0x4B, 0x1F, 0x54,
-    0x1F, 0x54, 0x73, 0x32, 0x00, 0x00, 0xC3, 0x18, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7,
-    0x20, 0x00, 0x00, 0x00, 0x79, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xBD, 0x00, 0x00, 0x86, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x73, 0x00, 0x00, 0xC7, 0x39,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xA2, 0x10, 0x00, 0x00, 0x94, 0x32, 0x1F, 0x54,
-    0x1F, 0x54, 0x08, 0x11, 0x00, 0x00, 0x6D, 0x6B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xE3, 0x18, 0x00, 0x00, 0xB2, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xBD, 0x00, 0x00, 0x86, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x39, 0x00, 0x00, 0xEB, 0x5A,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0x63, 0x00, 0x00, 0x28, 0x11, 0x1F, 0x54,
-    0xBD, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x38, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x2C, 0x63, 0x00, 0x00, 0x45, 0x29, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xBD, 0x00, 0x00, 0x86, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x34, 0xA5,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xDE, 0x4B,
-    0xD5, 0x32, 0x00, 0x00, 0xC3, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xBA, 0xD6, 0x61, 0x08, 0x00, 0x00, 0xAA, 0x52, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xBD, 0x00, 0x00, 0x86, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0xD6, 0xE3, 0x18, 0x00, 0x00, 0x45, 0x29, 0xDF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x82, 0x10, 0x00, 0x00, 0xD6, 0x3A,
-    0xEF, 0x21, 0x00, 0x00, 0x69, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x51, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x45, 0x29, 0x71, 0x8C, 0x34, 0xA5, 0x34, 0xA5,
-    0x34, 0xA5, 0x92, 0x94, 0x92, 0x94, 0x4D, 0x6B, 0x00, 0x00, 0x24, 0x21, 0x92, 0x94, 0x92, 0x94,
-    0x92, 0x94, 0x6D, 0x6B, 0x00, 0x00, 0x04, 0x21, 0x92, 0x94, 0x92, 0x94, 0xF3, 0x9C, 0x34, 0xA5,
-    0x34, 0xA5, 0x34, 0xA5, 0x6D, 0x6B, 0x82, 0x10, 0x00, 0x00, 0x61, 0x08, 0x38, 0xC6, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x42, 0x00, 0x00, 0x0F, 0x2A,
-    0x29, 0x19, 0x00, 0x00, 0xEF, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x84, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x18, 0xD7, 0xBD, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x73, 0x00, 0x00, 0x4A, 0x19,
-    0xC5, 0x08, 0x00, 0x00, 0x14, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x79, 0xCE, 0xEB, 0x5A, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42,
-    0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0xA6, 0x31, 0x00, 0x00, 0xA2, 0x10, 0x28, 0x42, 0x28, 0x42,
-    0x28, 0x42, 0xA6, 0x31, 0x00, 0x00, 0xA2, 0x10, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0x28, 0x42,
-    0x28, 0x42, 0x28, 0x42, 0x28, 0x42, 0xEF, 0x7B, 0x5D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0x94, 0x00, 0x00, 0xC6, 0x10,
-    0x63, 0x00, 0x00, 0x00, 0xB6, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xBD, 0x00, 0x00, 0x86, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x75, 0xAD, 0x00, 0x00, 0x83, 0x08,
-    0x42, 0x00, 0x00, 0x00, 0x38, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xBD, 0x00, 0x00, 0x86, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB6, 0xB5, 0x00, 0x00, 0x42, 0x00,
-    0x42, 0x00, 0x00, 0x00, 0x38, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xBD, 0x00, 0x00, 0x86, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0xBD, 0x00, 0x00, 0x42, 0x00,
-    0x62, 0x00, 0x00, 0x00, 0xB6, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xC6, 0xB2, 0x94, 0x51, 0x8C, 0x51, 0x8C,
-    0x51, 0x8C, 0x51, 0x8C, 0x51, 0x8C, 0x0C, 0x63, 0x00, 0x00, 0x24, 0x21, 0x51, 0x8C, 0x51, 0x8C,
-    0x51, 0x8C, 0x4D, 0x6B, 0x00, 0x00, 0xE3, 0x18, 0x51, 0x8C, 0x51, 0x8C, 0x51, 0x8C, 0x51, 0x8C,
-    0x51, 0x8C, 0x51, 0x8C, 0x14, 0xA5, 0xBA, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x75, 0xAD, 0x00, 0x00, 0x83, 0x08,
-    0xC5, 0x08, 0x00, 0x00, 0x14, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDB, 0xDE, 0xC7, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x63, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0x94, 0x00, 0x00, 0xC6, 0x10,
-    0x29, 0x19, 0x00, 0x00, 0xEF, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x79, 0xCE, 0xA2, 0x10, 0x00, 0x00, 0x41, 0x08, 0x28, 0x42, 0x0C, 0x63, 0x0C, 0x63,
-    0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x08, 0x42, 0x00, 0x00, 0xE3, 0x18, 0x0C, 0x63, 0x0C, 0x63,
-    0x0C, 0x63, 0x49, 0x4A, 0x00, 0x00, 0xC3, 0x18, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63, 0x0C, 0x63,
-    0x0C, 0x63, 0x0C, 0x63, 0x65, 0x29, 0x00, 0x00, 0x00, 0x00, 0x86, 0x31, 0x9E, 0xF7, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAE, 0x73, 0x00, 0x00, 0x4A, 0x19,
-    0xEF, 0x21, 0x00, 0x00, 0x8A, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xBE, 0xF7, 0x24, 0x21, 0x00, 0x00, 0x45, 0x29, 0x79, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xBD, 0x00, 0x00, 0x86, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x92, 0x94, 0x41, 0x08, 0x00, 0x00, 0xCB, 0x5A, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x49, 0x4A, 0x00, 0x00, 0x0F, 0x2A,
-    0xD5, 0x32, 0x00, 0x00, 0xE3, 0x18, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x71, 0x8C, 0x00, 0x00, 0xA2, 0x10, 0x1C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xBD, 0x00, 0x00, 0x86, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x92, 0x94, 0x00, 0x00, 0x20, 0x00, 0x79, 0xCE,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xA2, 0x10, 0x00, 0x00, 0xD6, 0x3A,
-    0xBD, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x59, 0xCE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xA6, 0x31, 0x00, 0x00, 0xCF, 0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xBD, 0x00, 0x00, 0x86, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x24, 0x21, 0x00, 0x00, 0xAE, 0x73,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0xC6, 0x00, 0x00, 0x00, 0x00, 0xDE, 0x4B,
-    0x1F, 0x54, 0x08, 0x11, 0x00, 0x00, 0xAE, 0x73, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
-    0x41, 0x08, 0x00, 0x00, 0x38, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xBD, 0x00, 0x00, 0x86, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0x63, 0x00, 0x00, 0x28, 0x42,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0x6B, 0x00, 0x00, 0x28, 0x11, 0x1F, 0x54,
-    0x1F, 0x54, 0x73, 0x2A, 0x00, 0x00, 0xE3, 0x18, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7,
-    0x00, 0x00, 0x00, 0x00, 0x9A, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xBD, 0x00, 0x00, 0x86, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x7B, 0x00, 0x00, 0xA6, 0x31,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xA2, 0x10, 0x00, 0x00, 0x73, 0x32, 0x1F, 0x54,
-    0x1F, 0x54, 0xDE, 0x4B, 0x21, 0x00, 0x00, 0x00, 0xF3, 0x9C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x82, 0x10, 0x00, 0x00, 0x96, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0xAD, 0x00, 0x00, 0xC7, 0x39, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xF7, 0xBD, 0x00, 0x00, 0xA2, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAA, 0x52, 0x00, 0x00, 0x69, 0x4A,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB2, 0x94, 0x00, 0x00, 0x42, 0x00, 0xDE, 0x4B, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0xCE, 0x21, 0x00, 0x00, 0x24, 0x21, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x28, 0x42, 0x00, 0x00, 0x8A, 0x52, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8A, 0x52, 0x00, 0x00, 0x28, 0x42, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x3C, 0xE7, 0x41, 0x08, 0x00, 0x00, 0x55, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xEF, 0x82, 0x10, 0x00, 0x00, 0x30, 0x84,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x04, 0x21, 0x00, 0x00, 0xEF, 0x21, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0xBD, 0x4B, 0x21, 0x00, 0x00, 0x00, 0x10, 0x84, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x75, 0xAD, 0x00, 0x00, 0x20, 0x00, 0x14, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x9C, 0x00, 0x00, 0x00, 0x00, 0x92, 0x94, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x8A, 0x52, 0x00, 0x00, 0x04, 0x21, 0x1C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x49, 0x4A, 0x00, 0x00, 0x82, 0x10, 0x3C, 0xE7,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x7B, 0x00, 0x00, 0x42, 0x00, 0xBD, 0x4B, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x31, 0x2A, 0x00, 0x00, 0x82, 0x10, 0x9A, 0xD6, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x49, 0x4A, 0x00, 0x00, 0x41, 0x08, 0xAE, 0x73, 0x3C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x5D, 0xEF, 0xAE, 0x73, 0x41, 0x08, 0x00, 0x00, 0xA6, 0x31, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xDE, 0xA2, 0x10, 0x00, 0x00, 0xE3, 0x18, 0x34, 0xA5, 0xDF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xC6, 0xE7, 0x39, 0x00, 0x00, 0x00, 0x00, 0x51, 0x8C, 0xFF, 0xFF,
-    0xFF, 0xFF, 0x59, 0xCE, 0x61, 0x08, 0x00, 0x00, 0x52, 0x2A, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0xFF, 0x4B, 0xC6, 0x10, 0x00, 0x00, 0x65, 0x29, 0x9E, 0xF7,
-    0xFF, 0xFF, 0x7D, 0xEF, 0xC7, 0x39, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x45, 0x29, 0x45, 0x29,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x29, 0x1C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xBD, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x82, 0x10,
-    0x65, 0x29, 0xC3, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x63, 0xFF, 0xFF, 0xFF, 0xFF,
-    0x7D, 0xEF, 0x45, 0x29, 0x00, 0x00, 0xE7, 0x10, 0xFF, 0x4B, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x7B, 0x43, 0x41, 0x00, 0x00, 0x00, 0x69, 0x4A,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xCF, 0x7B, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x82, 0x10, 0x6D, 0x6B, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xD6, 0x49, 0x4A, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x14, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF,
-    0x28, 0x42, 0x00, 0x00, 0x42, 0x00, 0x7B, 0x43, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0xD6, 0x3A, 0x00, 0x00, 0x00, 0x00,
-    0xEB, 0x5A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x75, 0xAD, 0x51, 0x8C, 0x30, 0x84,
-    0x55, 0xAD, 0x7D, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xDE, 0xF3, 0x9C,
-    0x10, 0x84, 0x71, 0x8C, 0x18, 0xC6, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x69, 0x4A,
-    0x00, 0x00, 0x00, 0x00, 0xF7, 0x3A, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x73, 0x32, 0x00, 0x00,
-    0x00, 0x00, 0x8A, 0x52, 0x9E, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0x49, 0x4A, 0x00, 0x00,
-    0x00, 0x00, 0x93, 0x32, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x73, 0x32,
-    0x00, 0x00, 0x00, 0x00, 0x65, 0x29, 0xBA, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0xD6, 0x65, 0x29, 0x00, 0x00, 0x00, 0x00,
-    0x73, 0x32, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0xD6, 0x3A, 0x41, 0x00, 0x00, 0x00, 0x82, 0x10, 0x51, 0x8C, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x10, 0x84, 0x61, 0x08, 0x00, 0x00, 0x42, 0x00, 0xF6, 0x3A,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x7B, 0x43, 0xC6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x45, 0x29, 0x14, 0xA5, 0xDF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xDF, 0xFF, 0x14, 0xA5, 0x24, 0x21, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x10, 0x7B, 0x43, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0xFF, 0x4B, 0x30, 0x2A, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21,
-    0xEF, 0x7B, 0x9A, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0xD6, 0xCF, 0x7B,
-    0x04, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x31, 0x2A, 0xFF, 0x4B, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x9C, 0x4B, 0xAD, 0x21, 0x21, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0xEB, 0x5A, 0x51, 0x8C, 0x55, 0xAD, 0x18, 0xC6, 0xBA, 0xD6,
-    0x9A, 0xD6, 0x18, 0xC6, 0x55, 0xAD, 0x51, 0x8C, 0xCB, 0x5A, 0x04, 0x21, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x21, 0x00, 0xCD, 0x21, 0xBD, 0x4B, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0xBD, 0x4B, 0x52, 0x2A,
-    0xE6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x10,
-    0x52, 0x2A, 0xDD, 0x4B, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0xBC, 0x4B, 0x94, 0x32, 0xCD, 0x21, 0x08, 0x11, 0x84, 0x08, 0x42, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x42, 0x00, 0x84, 0x08, 0x08, 0x11, 0xCE, 0x21, 0x94, 0x32, 0xBD, 0x4B, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54,
-    0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54, 0x1F, 0x54
+    0x14, 0xA5, 0xA6, 0x31, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x73, 0x84, 0xFF, 0xFF, 0x12, 0xDF, 0xFF,
+    0xE7, 0x39, 0x00, 0x00, 0x41, 0x08, 0x0C, 0x63, 0xD7, 0xBD, 0x1C, 0xE7, 0x59, 0xCE, 0xEF, 0x7B,
+    0xA2, 0x10, 0x00, 0x00, 0x61, 0x08, 0x59, 0xCE, 0xFF, 0xFF, 0x5D, 0xEF, 0x04, 0x21, 0x00, 0x00,
+    0x07, 0x11, 0xFF, 0x4B, 0x82, 0x1F, 0x54, 0x82, 0x1F, 0x54, 0x09, 0x52, 0x2A, 0x00, 0x00, 0x61,
+    0x08, 0x59, 0xCE, 0xFF, 0xFF, 0xDB, 0xDE, 0x61, 0x08, 0x00, 0x00, 0x0C, 0x63, 0xDF, 0xFF, 0x83,
+    0xFF, 0xFF, 0x04, 0xDF, 0xFF, 0xEB, 0x5A, 0x00, 0x00, 0x41, 0x08, 0x38, 0xC6, 0x83, 0xFF, 0xFF,
+    0x03, 0x30, 0x84, 0x00, 0x00, 0x61, 0x08, 0x96, 0xB5, 0x84, 0xFF, 0xFF, 0x09, 0xFB, 0xDE, 0x24,
+    0x21, 0x00, 0x00, 0x65, 0x29, 0xDF, 0xFF, 0xFF, 0xFF, 0x18, 0xC6, 0x41, 0x08, 0x00, 0x00, 0x73,
+    0x2A, 0x82, 0x1F, 0x54, 0x0B, 0x1F, 0x54, 0x1F, 0x54, 0xBD, 0x4B, 0x42, 0x00, 0x00, 0x00, 0xCF,
+    0x7B, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0x6B, 0x00, 0x00, 0x86, 0x31, 0xDF, 0xFF, 0x85, 0xFF, 0xFF,
+    0x03, 0xDF, 0xFF, 0x86, 0x31, 0x00, 0x00, 0xEB, 0x5A, 0x82, 0xFF, 0xFF, 0x03, 0xDF, 0xFF, 0xC3,
+    0x18, 0x00, 0x00, 0x30, 0x84, 0x86, 0xFF, 0xFF, 0x0B, 0x59, 0xCE, 0x20, 0x00, 0x00, 0x00, 0x34,
+    0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x73, 0x00, 0x00, 0x42, 0x00, 0xDE, 0x4B, 0x1F, 0x54, 0x1F,
+    0x54, 0x0A, 0x1F, 0x54, 0x1F, 0x54, 0xEF, 0x21, 0x00, 0x00, 0x04, 0x21, 0xBE, 0xF7, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x04, 0x21, 0x00, 0x00, 0xF3, 0x9C, 0x87, 0xFF, 0xFF, 0x02, 0xD3, 0x9C, 0x00, 0x00,
+    0xC7, 0x39, 0x82, 0xFF, 0xFF, 0x03, 0x38, 0xC6, 0x00, 0x00, 0x82, 0x10, 0x9E, 0xF7, 0x87, 0xFF,
+    0xFF, 0x0A, 0x08, 0x42, 0x00, 0x00, 0x0C, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0xF7, 0xE3, 0x18,
+    0x00, 0x00, 0xEF, 0x21, 0x1F, 0x54, 0x1F, 0x54, 0x0A, 0x1F, 0x54, 0xDE, 0x4B, 0x21, 0x00, 0x00,
+    0x00, 0xB2, 0x94, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x20, 0x00, 0x00, 0x00, 0x79, 0xCE, 0x87,
+    0xFF, 0xFF, 0x02, 0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39, 0x82, 0xFF, 0xFF, 0x02, 0xF7, 0xBD, 0x00,
+    0x00, 0x65, 0x29, 0x88, 0xFF, 0xFF, 0x02, 0xAE, 0x73, 0x00, 0x00, 0xC7, 0x39, 0x82, 0xFF, 0xFF,
+    0x04, 0x71, 0x8C, 0x00, 0x00, 0x42, 0x00, 0xDE, 0x4B, 0x1F, 0x54, 0x0A, 0x1F, 0x54, 0x73, 0x32,
+    0x00, 0x00, 0xC3, 0x18, 0xBE, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0x20, 0x00, 0x00, 0x00,
+    0x79, 0xCE, 0x87, 0xFF, 0xFF, 0x02, 0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39, 0x82, 0xFF, 0xFF, 0x02,
+    0xF7, 0xBD, 0x00, 0x00, 0x86, 0x31, 0x88, 0xFF, 0xFF, 0x02, 0x8E, 0x73, 0x00, 0x00, 0xC7, 0x39,
+    0x82, 0xFF, 0xFF, 0x04, 0x9E, 0xF7, 0xA2, 0x10, 0x00, 0x00, 0x94, 0x32, 0x1F, 0x54, 0x03, 0x1F,
+    0x54, 0x08, 0x11, 0x00, 0x00, 0x6D, 0x6B, 0x83, 0xFF, 0xFF, 0x02, 0xE3, 0x18, 0x00, 0x00, 0xB2,
+    0x94, 0x87, 0xFF, 0xFF, 0x02, 0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39, 0x82, 0xFF, 0xFF, 0x02, 0xF7,
+    0xBD, 0x00, 0x00, 0x86, 0x31, 0x88, 0xFF, 0xFF, 0x02, 0xE7, 0x39, 0x00, 0x00, 0xEB, 0x5A, 0x83,
+    0xFF, 0xFF, 0x03, 0x2C, 0x63, 0x00, 0x00, 0x28, 0x11, 0x1F, 0x54, 0x03, 0xBD, 0x4B, 0x00, 0x00,
+    0x00, 0x00, 0x38, 0xC6, 0x83, 0xFF, 0xFF, 0x03, 0x2C, 0x63, 0x00, 0x00, 0x45, 0x29, 0xBE, 0xF7,
+    0x86, 0xFF, 0xFF, 0x02, 0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39, 0x82, 0xFF, 0xFF, 0x02, 0xF7, 0xBD,
+    0x00, 0x00, 0x86, 0x31, 0x87, 0xFF, 0xFF, 0x03, 0x18, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x34, 0xA5,
+    0x83, 0xFF, 0xFF, 0x03, 0xF7, 0xBD, 0x00, 0x00, 0x00, 0x00, 0xDE, 0x4B, 0x02, 0xD5, 0x32, 0x00,
+    0x00, 0xC3, 0x18, 0x84, 0xFF, 0xFF, 0x04, 0xBA, 0xD6, 0x61, 0x08, 0x00, 0x00, 0xAA, 0x52, 0xBE,
+    0xF7, 0x85, 0xFF, 0xFF, 0x02, 0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39, 0x82, 0xFF, 0xFF, 0x02, 0xF7,
+    0xBD, 0x00, 0x00, 0x86, 0x31, 0x86, 0xFF, 0xFF, 0x04, 0x9A, 0xD6, 0xE3, 0x18, 0x00, 0x00, 0x45,
+    0x29, 0xDF, 0xFF, 0x83, 0xFF, 0xFF, 0x03, 0xDF, 0xFF, 0x82, 0x10, 0x00, 0x00, 0xD6, 0x3A, 0x02,
+    0xEF, 0x21, 0x00, 0x00, 0x69, 0x4A, 0x85, 0xFF, 0xFF, 0x04, 0x51, 0x8C, 0x00, 0x00, 0x00, 0x00,
+    0x45, 0x29, 0x71, 0x8C, 0x82, 0x34, 0xA5, 0x04, 0x92, 0x94, 0x92, 0x94, 0x4D, 0x6B, 0x00, 0x00,
+    0x24, 0x21, 0x82, 0x92, 0x94, 0x05, 0x6D, 0x6B, 0x00, 0x00, 0x04, 0x21, 0x92, 0x94, 0x92, 0x94,
+    0xF3, 0x9C, 0x82, 0x34, 0xA5, 0x04, 0x6D, 0x6B, 0x82, 0x10, 0x00, 0x00, 0x61, 0x08, 0x38, 0xC6,
+    0x85, 0xFF, 0xFF, 0x02, 0x28, 0x42, 0x00, 0x00, 0x0F, 0x2A, 0x02, 0x29, 0x19, 0x00, 0x00, 0xEF,
+    0x7B, 0x86, 0xFF, 0xFF, 0x01, 0x30, 0x84, 0x61, 0x08, 0x97, 0x00, 0x00, 0x01, 0xC3, 0x18, 0xD7,
+    0xBD, 0x86, 0xFF, 0xFF, 0x02, 0x8E, 0x73, 0x00, 0x00, 0x4A, 0x19, 0x02, 0xC5, 0x08, 0x00, 0x00,
+    0x14, 0xA5, 0x87, 0xFF, 0xFF, 0x01, 0x79, 0xCE, 0xEB, 0x5A, 0x85, 0x28, 0x42, 0x02, 0xA6, 0x31,
+    0x00, 0x00, 0xA2, 0x10, 0x82, 0x28, 0x42, 0x02, 0xA6, 0x31, 0x00, 0x00, 0xA2, 0x10, 0x86, 0x28,
+    0x42, 0x01, 0xEF, 0x7B, 0x5D, 0xEF, 0x87, 0xFF, 0xFF, 0x02, 0xB2, 0x94, 0x00, 0x00, 0xC6, 0x10,
+    0x02, 0x63, 0x00, 0x00, 0x00, 0xB6, 0xB5, 0x8F, 0xFF, 0xFF, 0x02, 0x96, 0xB5, 0x00, 0x00, 0xC7,
+    0x39, 0x82, 0xFF, 0xFF, 0x02, 0xF7, 0xBD, 0x00, 0x00, 0x86, 0x31, 0x90, 0xFF, 0xFF, 0x02, 0x75,
+    0xAD, 0x00, 0x00, 0x83, 0x08, 0x02, 0x42, 0x00, 0x00, 0x00, 0x38, 0xC6, 0x8F, 0xFF, 0xFF, 0x02,
+    0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39, 0x82, 0xFF, 0xFF, 0x02, 0xF7, 0xBD, 0x00, 0x00, 0x86, 0x31,
+    0x90, 0xFF, 0xFF, 0x02, 0xB6, 0xB5, 0x00, 0x00, 0x42, 0x00, 0x02, 0x42, 0x00, 0x00, 0x00, 0x38,
+    0xC6, 0x8F, 0xFF, 0xFF, 0x02, 0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39, 0x82, 0xFF, 0xFF, 0x02, 0xF7,
+    0xBD, 0x00, 0x00, 0x86, 0x31, 0x90, 0xFF, 0xFF, 0x02, 0xD7, 0xBD, 0x00, 0x00, 0x42, 0x00, 0x02,
+    0x62, 0x00, 0x00, 0x00, 0xB6, 0xB5, 0x88, 0xFF, 0xFF, 0x01, 0x38, 0xC6, 0xB2, 0x94, 0x84, 0x51,
+    0x8C, 0x02, 0x0C, 0x63, 0x00, 0x00, 0x24, 0x21, 0x82, 0x51, 0x8C, 0x02, 0x4D, 0x6B, 0x00, 0x00,
+    0xE3, 0x18, 0x85, 0x51, 0x8C, 0x01, 0x14, 0xA5, 0xBA, 0xD6, 0x88, 0xFF, 0xFF, 0x02, 0x75, 0xAD,
+    0x00, 0x00, 0x83, 0x08, 0x02, 0xC5, 0x08, 0x00, 0x00, 0x14, 0xA5, 0x86, 0xFF, 0xFF, 0x01, 0xDB,
+    0xDE, 0xC7, 0x39, 0x97, 0x00, 0x00, 0x01, 0x0C, 0x63, 0x9E, 0xF7, 0x86, 0xFF, 0xFF, 0x02, 0xB2,
+    0x94, 0x00, 0x00, 0xC6, 0x10, 0x02, 0x29, 0x19, 0x00, 0x00, 0xEF, 0x7B, 0x85, 0xFF, 0xFF, 0x04,
+    0x79, 0xCE, 0xA2, 0x10, 0x00, 0x00, 0x41, 0x08, 0x28, 0x42, 0x84, 0x0C, 0x63, 0x02, 0x08, 0x42,
+    0x00, 0x00, 0xE3, 0x18, 0x82, 0x0C, 0x63, 0x02, 0x49, 0x4A, 0x00, 0x00, 0xC3, 0x18, 0x85, 0x0C,
+    0x63, 0x04, 0x65, 0x29, 0x00, 0x00, 0x00, 0x00, 0x86, 0x31, 0x9E, 0xF7, 0x85, 0xFF, 0xFF, 0x02,
+    0xAE, 0x73, 0x00, 0x00, 0x4A, 0x19, 0x02, 0xEF, 0x21, 0x00, 0x00, 0x8A, 0x52, 0x84, 0xFF, 0xFF,
+    0x04, 0xBE, 0xF7, 0x24, 0x21, 0x00, 0x00, 0x45, 0x29, 0x79, 0xCE, 0x85, 0xFF, 0xFF, 0x02, 0x96,
+    0xB5, 0x00, 0x00, 0xC7, 0x39, 0x82, 0xFF, 0xFF, 0x02, 0xF7, 0xBD, 0x00, 0x00, 0x86, 0x31, 0x86,
+    0xFF, 0xFF, 0x03, 0x92, 0x94, 0x41, 0x08, 0x00, 0x00, 0xCB, 0x5A, 0x85, 0xFF, 0xFF, 0x02, 0x49,
+    0x4A, 0x00, 0x00, 0x0F, 0x2A, 0x02, 0xD5, 0x32, 0x00, 0x00, 0xE3, 0x18, 0x84, 0xFF, 0xFF, 0x03,
+    0x71, 0x8C, 0x00, 0x00, 0xA2, 0x10, 0x1C, 0xE7, 0x86, 0xFF, 0xFF, 0x02, 0x96, 0xB5, 0x00, 0x00,
+    0xC7, 0x39, 0x82, 0xFF, 0xFF, 0x02, 0xF7, 0xBD, 0x00, 0x00, 0x86, 0x31, 0x87, 0xFF, 0xFF, 0x03,
+    0x92, 0x94, 0x00, 0x00, 0x20, 0x00, 0x79, 0xCE, 0x83, 0xFF, 0xFF, 0x03, 0xDF, 0xFF, 0xA2, 0x10,
+    0x00, 0x00, 0xD6, 0x3A, 0x03, 0xBD, 0x4B, 0x00, 0x00, 0x00, 0x00, 0x59, 0xCE, 0x83, 0xFF, 0xFF,
+    0x02, 0xA6, 0x31, 0x00, 0x00, 0xCF, 0x7B, 0x87, 0xFF, 0xFF, 0x02, 0x96, 0xB5, 0x00, 0x00, 0xC7,
+    0x39, 0x82, 0xFF, 0xFF, 0x02, 0xF7, 0xBD, 0x00, 0x00, 0x86, 0x31, 0x88, 0xFF, 0xFF, 0x02, 0x24,
+    0x21, 0x00, 0x00, 0xAE, 0x73, 0x83, 0xFF, 0xFF, 0x03, 0x18, 0xC6, 0x00, 0x00, 0x00, 0x00, 0xDE,
+    0x4B, 0x03, 0x1F, 0x54, 0x08, 0x11, 0x00, 0x00, 0xAE, 0x73, 0x82, 0xFF, 0xFF, 0x03, 0xDF, 0xFF,
+    0x41, 0x08, 0x00, 0x00, 0x38, 0xC6, 0x87, 0xFF, 0xFF, 0x02, 0x96, 0xB5, 0x00, 0x00, 0xC7, 0x39,
+    0x82, 0xFF, 0xFF, 0x02, 0xF7, 0xBD, 0x00, 0x00, 0x86, 0x31, 0x88, 0xFF, 0xFF, 0x02, 0x2C, 0x63,
+    0x00, 0x00, 0x28, 0x42, 0x83, 0xFF, 0xFF, 0x03, 0x4D, 0x6B, 0x00, 0x00, 0x28, 0x11, 0x1F, 0x54,
+    0x0A, 0x1F, 0x54, 0x73, 0x2A, 0x00, 0x00, 0xE3, 0x18, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E,
+    0xF7, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xD6, 0x87, 0xFF, 0xFF, 0x02, 0x96, 0xB5, 0x00, 0x00, 0xC7,
+    0x39, 0x82, 0xFF, 0xFF, 0x02, 0xF7, 0xBD, 0x00, 0x00, 0x86, 0x31, 0x88, 0xFF, 0xFF, 0x02, 0xCF,
+    0x7B, 0x00, 0x00, 0xA6, 0x31, 0x82, 0xFF, 0xFF, 0x04, 0xBE, 0xF7, 0xA2, 0x10, 0x00, 0x00, 0x73,
+    0x32, 0x1F, 0x54, 0x04, 0x1F, 0x54, 0xDE, 0x4B, 0x21, 0x00, 0x00, 0x00, 0xF3, 0x9C, 0x82, 0xFF,
+    0xFF, 0x02, 0x82, 0x10, 0x00, 0x00, 0x96, 0xB5, 0x87, 0xFF, 0xFF, 0x02, 0x55, 0xAD, 0x00, 0x00,
+    0xC7, 0x39, 0x82, 0xFF, 0xFF, 0x02, 0xF7, 0xBD, 0x00, 0x00, 0xA2, 0x10, 0x88, 0xFF, 0xFF, 0x02,
+    0xAA, 0x52, 0x00, 0x00, 0x69, 0x4A, 0x82, 0xFF, 0xFF, 0x04, 0xB2, 0x94, 0x00, 0x00, 0x42, 0x00,
+    0xDE, 0x4B, 0x1F, 0x54, 0x0A, 0x1F, 0x54, 0x1F, 0x54, 0xCE, 0x21, 0x00, 0x00, 0x24, 0x21, 0xDF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x42, 0x00, 0x00, 0x8A, 0x52, 0x87, 0xFF, 0xFF, 0x02, 0x8A,
+    0x52, 0x00, 0x00, 0x28, 0x42, 0x82, 0xFF, 0xFF, 0x03, 0x3C, 0xE7, 0x41, 0x08, 0x00, 0x00, 0x55,
+    0xAD, 0x86, 0xFF, 0xFF, 0x0B, 0x5D, 0xEF, 0x82, 0x10, 0x00, 0x00, 0x30, 0x84, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x9E, 0xF7, 0x04, 0x21, 0x00, 0x00, 0xEF, 0x21, 0x1F, 0x54, 0x1F, 0x54, 0x0B, 0x1F, 0x54,
+    0x1F, 0x54, 0xBD, 0x4B, 0x21, 0x00, 0x00, 0x00, 0x10, 0x84, 0xFF, 0xFF, 0xFF, 0xFF, 0x75, 0xAD,
+    0x00, 0x00, 0x20, 0x00, 0x14, 0xA5, 0x85, 0xFF, 0xFF, 0x03, 0xF3, 0x9C, 0x00, 0x00, 0x00, 0x00,
+    0x92, 0x94, 0x83, 0xFF, 0xFF, 0x03, 0x8A, 0x52, 0x00, 0x00, 0x04, 0x21, 0x1C, 0xE7, 0x84, 0xFF,
+    0xFF, 0x0C, 0xDF, 0xFF, 0x49, 0x4A, 0x00, 0x00, 0x82, 0x10, 0x3C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xCF, 0x7B, 0x00, 0x00, 0x42, 0x00, 0xBD, 0x4B, 0x1F, 0x54, 0x1F, 0x54, 0x82, 0x1F, 0x54, 0x12,
+    0x31, 0x2A, 0x00, 0x00, 0x82, 0x10, 0x9A, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0x49, 0x4A, 0x00, 0x00,
+    0x41, 0x08, 0xAE, 0x73, 0x3C, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xEF, 0xAE, 0x73, 0x41, 0x08,
+    0x00, 0x00, 0xA6, 0x31, 0xDF, 0xFF, 0x83, 0xFF, 0xFF, 0x12, 0xFB, 0xDE, 0xA2, 0x10, 0x00, 0x00,
+    0xE3, 0x18, 0x34, 0xA5, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0xC6, 0xE7, 0x39, 0x00, 0x00,
+    0x00, 0x00, 0x51, 0x8C, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0xCE, 0x61, 0x08, 0x00, 0x00, 0x52, 0x2A,
+    0x82, 0x1F, 0x54, 0x82, 0x1F, 0x54, 0x11, 0xFF, 0x4B, 0xC6, 0x10, 0x00, 0x00, 0x65, 0x29, 0x9E,
+    0xF7, 0xFF, 0xFF, 0x7D, 0xEF, 0xC7, 0x39, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x45, 0x29, 0x45,
+    0x29, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x29, 0x1C, 0xE7, 0x85, 0xFF, 0xFF, 0x06, 0xF7,
+    0xBD, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x82, 0x10, 0x65, 0x29, 0xC3, 0x18, 0x82, 0x00, 0x00,
+    0x07, 0x2C, 0x63, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0xEF, 0x45, 0x29, 0x00, 0x00, 0xE7, 0x10, 0xFF,
+    0x4B, 0x82, 0x1F, 0x54, 0x83, 0x1F, 0x54, 0x08, 0x7B, 0x43, 0x41, 0x00, 0x00, 0x00, 0x69, 0x4A,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xF7, 0xCF, 0x7B, 0x82, 0x10, 0x83, 0x00, 0x00, 0x02, 0x82, 0x10,
+    0x6D, 0x6B, 0x9E, 0xF7, 0x87, 0xFF, 0xFF, 0x01, 0xBA, 0xD6, 0x49, 0x4A, 0x84, 0x00, 0x00, 0x08,
+    0x24, 0x21, 0x14, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x28, 0x42, 0x00, 0x00, 0x42, 0x00,
+    0x7B, 0x43, 0x83, 0x1F, 0x54, 0x84, 0x1F, 0x54, 0x03, 0xD6, 0x3A, 0x00, 0x00, 0x00, 0x00, 0xEB,
+    0x5A, 0x82, 0xFF, 0xFF, 0x05, 0x9E, 0xF7, 0x75, 0xAD, 0x51, 0x8C, 0x30, 0x84, 0x55, 0xAD, 0x7D,
+    0xEF, 0x8B, 0xFF, 0xFF, 0x0C, 0xFB, 0xDE, 0xF3, 0x9C, 0x10, 0x84, 0x71, 0x8C, 0x18, 0xC6, 0xDF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0x69, 0x4A, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x3A, 0x84,
+    0x1F, 0x54, 0x85, 0x1F, 0x54, 0x04, 0x73, 0x32, 0x00, 0x00, 0x00, 0x00, 0x8A, 0x52, 0x9E, 0xF7,
+    0x99, 0xFF, 0xFF, 0x04, 0x9E, 0xF7, 0x49, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x93, 0x32, 0x85, 0x1F,
+    0x54, 0x86, 0x1F, 0x54, 0x04, 0x73, 0x32, 0x00, 0x00, 0x00, 0x00, 0x65, 0x29, 0xBA, 0xD6, 0x97,
+    0xFF, 0xFF, 0x04, 0x9A, 0xD6, 0x65, 0x29, 0x00, 0x00, 0x00, 0x00, 0x73, 0x32, 0x86, 0x1F, 0x54,
+    0x87, 0x1F, 0x54, 0x05, 0xD6, 0x3A, 0x41, 0x00, 0x00, 0x00, 0x82, 0x10, 0x51, 0x8C, 0xDF, 0xFF,
+    0x93, 0xFF, 0xFF, 0x05, 0xDF, 0xFF, 0x10, 0x84, 0x61, 0x08, 0x00, 0x00, 0x42, 0x00, 0xF6, 0x3A,
+    0x87, 0x1F, 0x54, 0x88, 0x1F, 0x54, 0x06, 0x7B, 0x43, 0xC6, 0x10, 0x00, 0x00, 0x00, 0x00, 0x45,
+    0x29, 0x14, 0xA5, 0xDF, 0xFF, 0x8F, 0xFF, 0xFF, 0x06, 0xDF, 0xFF, 0x14, 0xA5, 0x24, 0x21, 0x00,
+    0x00, 0x00, 0x00, 0xE6, 0x10, 0x7B, 0x43, 0x88, 0x1F, 0x54, 0x89, 0x1F, 0x54, 0x07, 0xFF, 0x4B,
+    0x30, 0x2A, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x21, 0xEF, 0x7B, 0x9A, 0xD6, 0x8B, 0xFF,
+    0xFF, 0x07, 0x9A, 0xD6, 0xCF, 0x7B, 0x04, 0x21, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x31, 0x2A,
+    0xFF, 0x4B, 0x89, 0x1F, 0x54, 0x8B, 0x1F, 0x54, 0x02, 0x9C, 0x4B, 0xAD, 0x21, 0x21, 0x00, 0x82,
+    0x00, 0x00, 0x0B, 0x24, 0x21, 0xEB, 0x5A, 0x51, 0x8C, 0x55, 0xAD, 0x18, 0xC6, 0xBA, 0xD6, 0x9A,
+    0xD6, 0x18, 0xC6, 0x55, 0xAD, 0x51, 0x8C, 0xCB, 0x5A, 0x04, 0x21, 0x82, 0x00, 0x00, 0x02, 0x21,
+    0x00, 0xCD, 0x21, 0xBD, 0x4B, 0x8B, 0x1F, 0x54, 0x8D, 0x1F, 0x54, 0x02, 0xBD, 0x4B, 0x52, 0x2A,
+    0xE6, 0x10, 0x8D, 0x00, 0x00, 0x02, 0xE6, 0x10, 0x52, 0x2A, 0xDD, 0x4B, 0x8D, 0x1F, 0x54, 0x90,
+    0x1F, 0x54, 0x0D, 0xBC, 0x4B, 0x94, 0x32, 0xCD, 0x21, 0x08, 0x11, 0x84, 0x08, 0x42, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x42, 0x00, 0x84, 0x08, 0x08, 0x11, 0xCE, 0x21, 0x94, 0x32, 0xBD, 0x4B, 0x90,
+    0x1F, 0x54
 };
 
-const uint8_t bitmap_pixel_data_bp_coupled[76800] PROGMEM = {
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x4A, 0xC9, 0x39,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0xC9, 0x39, 0x28, 0x4A, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x4A, 0xC9, 0x39,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0xC9, 0x39, 0x28, 0x4A, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC7, 0x62, 0xC5, 0xFE,
-    0x05, 0xDE, 0x85, 0xA4, 0x07, 0x6B, 0xA9, 0x31, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x89, 0x31, 0xC7, 0x5A, 0x26, 0x94, 0xA5, 0xCD,
-    0xA5, 0xFE, 0xC7, 0x62, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC7, 0x62, 0xC5, 0xFE,
-    0x05, 0xDE, 0x85, 0xA4, 0x07, 0x6B, 0xA9, 0x31, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x4A, 0x29, 0x4A, 0x29, 0x89, 0x31, 0xC7, 0x5A, 0x26, 0x94, 0xA5, 0xCD,
-    0xA5, 0xFE, 0xC7, 0x62, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE5, 0xDD,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xA5, 0xFE, 0xA5, 0xCD, 0x26, 0x94, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC6, 0x8B, 0x45, 0xC5, 0x85, 0xF6, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xE5, 0xDD, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE5, 0xDD,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xA5, 0xFE, 0xA5, 0xCD, 0x26, 0x94, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC6, 0x8B, 0x45, 0xC5, 0x85, 0xF6, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xE5, 0xDD, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x86, 0x7B,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x65, 0xEE,
-    0x65, 0xEE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0x86, 0x7B, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x86, 0x7B,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x65, 0xEE,
-    0x65, 0xEE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0x86, 0x7B, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x89, 0x31,
-    0x65, 0xEE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x85, 0xF6,
-    0xA9, 0x31, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x89, 0x31,
-    0x65, 0xEE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x85, 0xF6,
-    0xA9, 0x31, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x45, 0x9C, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x45, 0x9C,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x45, 0x9C, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x45, 0x9C,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x08, 0x42, 0xA5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x08, 0x42,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x08, 0x42, 0xA5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x08, 0x42,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x25, 0xBD, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x25, 0xBD, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x25, 0xBD, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x25, 0xBD, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0xC7, 0x62, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC7, 0x62, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0xC7, 0x62, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC7, 0x62, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0xE6, 0x18, 0xA3, 0x10, 0xC2, 0x08,
-    0xC3, 0x10, 0xC4, 0x10, 0x07, 0x21, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xE5, 0xDD, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xE5, 0xDD, 0x69, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0xC5, 0x18, 0x83, 0x18,
-    0x62, 0x10, 0x83, 0x18, 0xC5, 0x18, 0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xE5, 0xDD, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xE5, 0xDD, 0x69, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x07, 0x21, 0xC4, 0x10,
-    0xC3, 0x10, 0xC2, 0x08, 0xC3, 0x10, 0xC6, 0x18, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0x61, 0x00, 0x21, 0x01, 0xA2, 0x03, 0x83, 0x04,
-    0x63, 0x04, 0xC2, 0x02, 0x81, 0x00, 0xA2, 0x08, 0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xA6, 0x83, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x86, 0x7B, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0xA4, 0x18, 0x00, 0x08, 0x21, 0x38, 0x01, 0x78,
-    0x01, 0x90, 0x01, 0x78, 0x21, 0x40, 0x00, 0x08, 0xA4, 0x18, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xA6, 0x83, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x86, 0x7B, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0xA2, 0x08, 0x80, 0x00, 0xA2, 0x02,
-    0x43, 0x04, 0xA3, 0x04, 0xA2, 0x03, 0x41, 0x01, 0x61, 0x00, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x80, 0x00, 0x03, 0x05, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07,
-    0xE5, 0x07, 0xE5, 0x07, 0x85, 0x07, 0xE2, 0x02, 0x61, 0x08, 0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x89, 0x31, 0x65, 0xEE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x85, 0xF6, 0xA9, 0x31, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x83, 0x10, 0x21, 0x20, 0x02, 0xC8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xD0, 0x21, 0x28, 0x82, 0x10, 0x49, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x89, 0x31, 0x65, 0xEE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x85, 0xF6, 0xA9, 0x31, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0x81, 0x08, 0x81, 0x02, 0x65, 0x07, 0xE5, 0x07,
-    0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0x43, 0x05, 0x81, 0x00, 0xC5, 0x18, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x08, 0x21, 0x40, 0x00, 0xE4, 0x05, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07,
-    0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0x02, 0x03, 0xA2, 0x08, 0x49, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x65, 0x9C, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x65, 0x9C, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x21, 0x18, 0x02, 0xE0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xE8, 0x21, 0x20, 0xC5, 0x18, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x65, 0x9C, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x65, 0x9C, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA2, 0x08, 0xA2, 0x02, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07,
-    0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0x24, 0x06, 0x40, 0x00, 0x07, 0x21,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0xC3, 0x10, 0xE2, 0x02, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07,
-    0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0x85, 0x07, 0x81, 0x00, 0x07, 0x21, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x08, 0x42, 0xA5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x28, 0x42, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x49, 0x29, 0x41, 0x08, 0x02, 0xA0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xB0, 0x21, 0x08, 0x49, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x08, 0x42, 0xA5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x28, 0x42, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x07, 0x21, 0x60, 0x00, 0x45, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07,
-    0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0x42, 0x03, 0xC3, 0x10,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x49, 0x29, 0x61, 0x00, 0xC4, 0x05, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07,
-    0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xC2, 0x02, 0xC4, 0x10, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x25, 0xBD, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x25, 0xBD, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x07, 0x21, 0x20, 0x10, 0x03, 0xF0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x21, 0x10, 0x07, 0x21,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x25, 0xBD, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0x25, 0xBD, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x61, 0x02, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07,
-    0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0x24, 0x06, 0x40, 0x00,
-    0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x29, 0x29, 0x00, 0x00, 0x25, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07,
-    0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0x23, 0x04, 0xC3, 0x10, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE7, 0x62, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xE7, 0x62, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0xE6, 0x18, 0x21, 0x28, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x21, 0x30, 0xE6, 0x18,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE7, 0x62, 0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xC5, 0xFE, 0xE7, 0x62, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xC3, 0x10, 0xC2, 0x03, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07,
-    0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xA5, 0x07, 0x00, 0x00,
-    0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x28, 0x21, 0x00, 0x00, 0x65, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07,
-    0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0x83, 0x04, 0xC2, 0x08, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE5, 0xDD, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x05, 0xDE, 0x69, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0xE6, 0x18, 0x21, 0x30, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x21, 0x38, 0xC5, 0x18,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE5, 0xDD, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0x05, 0xDE, 0x69, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xC3, 0x10, 0x02, 0x04, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07,
-    0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0x00, 0x00,
-    0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x49, 0x29, 0x20, 0x00, 0x84, 0x06, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07,
-    0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xA2, 0x03, 0xC3, 0x10, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA6, 0x83, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xA6, 0x83, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0xE7, 0x20, 0x21, 0x18, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x21, 0x20, 0xE6, 0x18,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA6, 0x83, 0xC5, 0xFE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0xC5, 0xFE, 0xA6, 0x83, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10, 0x22, 0x03, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07,
-    0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE4, 0x06, 0x00, 0x00,
-    0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0xA2, 0x08, 0x22, 0x04, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07,
-    0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0x41, 0x01, 0xE6, 0x18, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x89, 0x31, 0x65, 0xEE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0x85, 0xF6, 0xA9, 0x31, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x49, 0x29, 0x00, 0x08, 0x02, 0xC8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xD8, 0x00, 0x00, 0x28, 0x21,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x89, 0x31, 0x65, 0xEE, 0xC5, 0xFE,
-    0xC5, 0xFE, 0x85, 0xF6, 0xA9, 0x31, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0xE1, 0x00, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07,
-    0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xA3, 0x04, 0xA2, 0x08,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0xE6, 0x18, 0xC1, 0x00, 0x65, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07,
-    0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0x23, 0x05, 0x61, 0x00, 0x49, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x65, 0xA4, 0xC5, 0xFE,
-    0xC5, 0xFE, 0x65, 0x9C, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x83, 0x10, 0x01, 0x48, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x50, 0x83, 0x10, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x65, 0xA4, 0xC5, 0xFE,
-    0xC5, 0xFE, 0x65, 0x9C, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x81, 0x08, 0xC3, 0x04, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07,
-    0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xA5, 0x07, 0xE1, 0x00, 0xE6, 0x18,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x49, 0x29, 0xA2, 0x10, 0xC1, 0x01, 0x65, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07,
-    0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE4, 0x05, 0x80, 0x00, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x08, 0x42, 0xA5, 0xFE,
-    0xC5, 0xFE, 0x28, 0x4A, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0x41, 0x08, 0x01, 0x70, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x78, 0x21, 0x08, 0x28, 0x21, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x08, 0x42, 0xA5, 0xFE,
-    0xC5, 0xFE, 0x28, 0x4A, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0x60, 0x00, 0xA3, 0x05, 0xE5, 0x07, 0xE5, 0x07,
-    0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0xE5, 0x07, 0x85, 0x07, 0x01, 0x02, 0xA2, 0x08, 0x49, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0xA3, 0x10, 0xC1, 0x00, 0x22, 0x04, 0xA4, 0x06, 0xC5, 0x07,
-    0x65, 0x07, 0xE4, 0x05, 0xC2, 0x02, 0x40, 0x00, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x45, 0xBD,
-    0x25, 0xBD, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x07, 0x21, 0x41, 0x10, 0x21, 0x28, 0x01, 0x98, 0x02, 0xD8,
-    0x03, 0xF0, 0x02, 0xD8, 0x02, 0xA0, 0x21, 0x30, 0x41, 0x10, 0x07, 0x21, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x45, 0xBD,
-    0x25, 0xBD, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0x40, 0x00, 0xA2, 0x02, 0xC4, 0x05,
-    0x65, 0x07, 0xC5, 0x07, 0xA4, 0x06, 0x43, 0x04, 0xC1, 0x00, 0xA2, 0x08, 0x29, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0xE6, 0x18, 0xA2, 0x08, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x61, 0x00, 0xC3, 0x10, 0x08, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE7, 0x62,
-    0xE7, 0x62, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0xC5, 0x18, 0x41, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x41, 0x10, 0xC5, 0x18, 0x29, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE7, 0x62,
-    0xE7, 0x62, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0xC3, 0x10, 0x61, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xA2, 0x08, 0xE6, 0x18, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x28, 0x21,
-    0x28, 0x21, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x69, 0x29,
-    0x69, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x29, 0x21,
-    0x28, 0x21, 0x29, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x69, 0x29,
-    0x69, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29,
-    0x28, 0x21, 0x28, 0x21, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x49, 0x29, 0x07, 0x21, 0xE6, 0x18, 0xA4, 0x10, 0xA4, 0x10, 0xA3, 0x10, 0xA3, 0x10, 0xA3, 0x10,
-    0xA4, 0x10, 0xA4, 0x10, 0xC5, 0x18, 0xE7, 0x20, 0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x29, 0x21, 0x07, 0x21, 0xC6, 0x18, 0xA4, 0x10, 0xA4, 0x10, 0xA3, 0x10, 0xA3, 0x10,
-    0xA3, 0x10, 0xA4, 0x10, 0xA4, 0x10, 0xC5, 0x18, 0x07, 0x21, 0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0x07, 0x21, 0xC5, 0x18, 0xA4, 0x10, 0xA4, 0x10, 0xA3, 0x10,
-    0xA3, 0x10, 0xA3, 0x10, 0xA4, 0x10, 0xA4, 0x10, 0xC6, 0x18, 0x07, 0x21, 0x29, 0x21, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0xE7, 0x20, 0xC5, 0x18, 0xA4, 0x10, 0xA4, 0x10,
-    0xA3, 0x10, 0xA3, 0x10, 0xA3, 0x10, 0xA4, 0x10, 0xA4, 0x10, 0xE6, 0x18, 0x07, 0x21, 0x49, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x07, 0x21, 0xC4, 0x18, 0x82, 0x10,
-    0x00, 0x00, 0x82, 0x10, 0x04, 0x21, 0xC7, 0x41, 0x49, 0x52, 0x8A, 0x5A, 0xAA, 0x5A, 0x8A, 0x5A,
-    0x49, 0x52, 0x08, 0x42, 0x45, 0x29, 0x82, 0x10, 0x00, 0x00, 0x82, 0x10, 0xA4, 0x10, 0x07, 0x21,
-    0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x07, 0x21, 0xA4, 0x10,
-    0x82, 0x10, 0x00, 0x00, 0x82, 0x10, 0x24, 0x21, 0xE7, 0x41, 0x49, 0x52, 0x8A, 0x5A, 0xAA, 0x5A,
-    0x8A, 0x5A, 0x49, 0x52, 0xE7, 0x41, 0x24, 0x29, 0x82, 0x10, 0x00, 0x00, 0x82, 0x10, 0xA4, 0x10,
-    0x07, 0x21, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x07, 0x21,
-    0xA4, 0x10, 0x82, 0x10, 0x00, 0x00, 0x82, 0x10, 0x25, 0x29, 0xE7, 0x41, 0x49, 0x52, 0x8A, 0x5A,
-    0xAA, 0x5A, 0x8A, 0x5A, 0x49, 0x52, 0xE7, 0x41, 0x24, 0x21, 0x82, 0x10, 0x00, 0x00, 0x82, 0x10,
-    0xA4, 0x10, 0x07, 0x21, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29,
-    0xE7, 0x20, 0xA4, 0x10, 0x82, 0x10, 0x00, 0x00, 0x82, 0x10, 0x45, 0x29, 0x08, 0x42, 0x49, 0x52,
-    0x8A, 0x5A, 0xAA, 0x5A, 0x8A, 0x5A, 0x49, 0x52, 0xC7, 0x41, 0x04, 0x21, 0x82, 0x10, 0x00, 0x00,
-    0x82, 0x10, 0xC5, 0x18, 0x07, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0xC5, 0x18, 0x82, 0x10, 0x41, 0x08, 0x86, 0x31, 0xEB, 0x62,
-    0x10, 0x94, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x71, 0x9C, 0x2C, 0x6B, 0xE7, 0x41, 0x82, 0x10,
-    0x62, 0x08, 0xC4, 0x18, 0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0xC5, 0x18, 0x82, 0x10, 0x61, 0x08, 0xA6, 0x39,
-    0x0C, 0x6B, 0x30, 0x94, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x51, 0x9C, 0x0C, 0x6B, 0xC7, 0x39,
-    0x61, 0x08, 0x62, 0x08, 0xC5, 0x18, 0x29, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x29, 0x21, 0xC5, 0x18, 0x62, 0x08, 0x61, 0x08,
-    0xC7, 0x39, 0x0C, 0x6B, 0x51, 0x9C, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x30, 0x94, 0xEB, 0x6A,
-    0xA6, 0x39, 0x61, 0x08, 0x82, 0x10, 0xC5, 0x18, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0xC4, 0x18, 0x62, 0x08,
-    0x82, 0x10, 0xE7, 0x41, 0x2C, 0x73, 0x71, 0x9C, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x10, 0x94,
-    0xEB, 0x62, 0x86, 0x31, 0x41, 0x08, 0x82, 0x10, 0xC5, 0x18, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x49, 0x29, 0xC5, 0x18, 0x61, 0x08, 0xC3, 0x18, 0xEB, 0x62, 0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC,
-    0x4D, 0x73, 0x45, 0x29, 0x41, 0x08, 0xA4, 0x18, 0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x49, 0x29, 0xC5, 0x18, 0x61, 0x08, 0xE4, 0x20, 0x0C, 0x6B, 0xB2, 0xA4, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xB2, 0xA4, 0x0C, 0x6B, 0x04, 0x21, 0x41, 0x08, 0xC4, 0x18, 0x29, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x29, 0x21, 0xC4, 0x18, 0x41, 0x08, 0x24, 0x21, 0x2C, 0x6B, 0xB2, 0xA4,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x92, 0xA4, 0x0C, 0x6B, 0xE3, 0x20, 0x61, 0x08, 0xC5, 0x18, 0x49, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0xA4, 0x10, 0x41, 0x08, 0x45, 0x29, 0x4D, 0x73,
-    0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4, 0xCB, 0x62, 0xC3, 0x18, 0x61, 0x08, 0xC5, 0x18, 0x49, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x20,
-    0x62, 0x10, 0xE3, 0x18, 0x4D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x51, 0x9C, 0x8E, 0x7B, 0x0C, 0x6B, 0xCB, 0x62, 0xAA, 0x5A, 0xAA, 0x5A,
-    0xEB, 0x6A, 0x6D, 0x7B, 0x30, 0x94, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xCF, 0x83, 0x65, 0x29, 0x61, 0x08, 0xC5, 0x18, 0x49, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0xE6, 0x18, 0x62, 0x08, 0x04, 0x21, 0x6D, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x51, 0x94, 0x8E, 0x7B, 0x0C, 0x6B, 0xCB, 0x62, 0xAA, 0x5A,
-    0xCB, 0x62, 0xEB, 0x6A, 0x8E, 0x7B, 0x30, 0x94, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x8E, 0x7B, 0x24, 0x29, 0x61, 0x08, 0xE6, 0x18, 0x49, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x49, 0x29, 0xE6, 0x18, 0x61, 0x08, 0x25, 0x29, 0xAE, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x30, 0x94, 0x6D, 0x7B, 0xEB, 0x6A, 0xCB, 0x62,
-    0xAA, 0x5A, 0xCB, 0x62, 0x0C, 0x6B, 0x8E, 0x7B, 0x51, 0x94, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x7B, 0x04, 0x21, 0x62, 0x08, 0xE6, 0x18,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x49, 0x29, 0xC5, 0x18, 0x41, 0x08, 0x65, 0x31, 0xCF, 0x83, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x30, 0x94, 0x6D, 0x73, 0xEB, 0x6A,
-    0xAA, 0x5A, 0xAA, 0x5A, 0xCB, 0x62, 0x0C, 0x6B, 0x8E, 0x7B, 0x51, 0x9C, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x2C, 0x73, 0xC3, 0x18, 0x82, 0x10,
-    0xE7, 0x20, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0xA4, 0x10, 0x61, 0x08,
-    0xAA, 0x5A, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4, 0xEB, 0x62,
-    0x86, 0x39, 0x82, 0x10, 0x00, 0x00, 0x41, 0x10, 0x61, 0x28, 0x61, 0x38, 0x61, 0x40, 0x61, 0x38,
-    0x61, 0x30, 0x61, 0x18, 0x00, 0x00, 0x41, 0x08, 0x45, 0x31, 0x8A, 0x5A, 0x30, 0x94, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0xA2, 0x10, 0x82, 0x10, 0x28, 0x21,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0xA3, 0x10,
-    0x82, 0x10, 0xEB, 0x62, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x71, 0x9C,
-    0xCB, 0x62, 0x65, 0x31, 0x61, 0x08, 0x00, 0x00, 0x41, 0x08, 0x61, 0x08, 0x61, 0x08, 0x61, 0x08,
-    0x61, 0x08, 0x61, 0x08, 0x61, 0x08, 0x00, 0x00, 0x61, 0x08, 0x65, 0x31, 0xAA, 0x5A, 0x51, 0x9C,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x0C, 0x6B, 0x82, 0x10, 0x83, 0x10,
-    0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21,
-    0x83, 0x10, 0x82, 0x10, 0x2C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x51, 0x9C, 0xAA, 0x5A, 0x65, 0x31, 0x61, 0x10, 0x00, 0x00, 0x61, 0x18, 0x61, 0x30, 0x61, 0x38,
-    0x61, 0x40, 0x61, 0x38, 0x61, 0x30, 0x41, 0x10, 0x00, 0x00, 0x61, 0x10, 0x65, 0x39, 0xCB, 0x62,
-    0x71, 0x9C, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0xEB, 0x62, 0x62, 0x10,
-    0xA3, 0x10, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x28, 0x21, 0x82, 0x10, 0xA2, 0x10, 0x4D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x30, 0x94, 0x8A, 0x5A, 0x45, 0x29, 0x41, 0x08, 0x00, 0x00, 0x61, 0x08, 0x61, 0x08,
-    0x61, 0x08, 0x61, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x00, 0x00, 0x82, 0x10, 0x86, 0x31,
-    0xEB, 0x62, 0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0xAA, 0x5A,
-    0x61, 0x08, 0xA4, 0x10, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x08, 0x21, 0x82, 0x10, 0x04, 0x21, 0x30, 0x94,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xCF, 0x83, 0x86, 0x39, 0x41, 0x08, 0x61, 0x20,
-    0x01, 0x68, 0x02, 0xA8, 0x02, 0xE0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x02, 0xE8, 0x02, 0xB8, 0x01, 0x78, 0x61, 0x30, 0x00, 0x00, 0x24, 0x29,
-    0x4D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xB2, 0xA4, 0xA6, 0x39, 0x61, 0x08,
-    0xE6, 0x20, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x07, 0x21, 0x62, 0x08, 0x45, 0x29,
-    0x71, 0x9C, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x8E, 0x7B, 0x65, 0x31, 0x20, 0x00,
-    0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x20, 0x00,
-    0x45, 0x29, 0x6D, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4, 0x65, 0x31,
-    0x62, 0x08, 0x07, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x07, 0x21, 0x61, 0x08,
-    0x86, 0x31, 0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x7B, 0x45, 0x31,
-    0x20, 0x08, 0x61, 0x30, 0x01, 0x78, 0x02, 0xB8, 0x02, 0xE8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xE0, 0x02, 0xB0, 0x01, 0x70, 0x61, 0x28,
-    0x20, 0x08, 0x65, 0x31, 0xAE, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x71, 0x9C,
-    0x45, 0x29, 0x82, 0x10, 0x07, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18,
-    0x61, 0x08, 0xC7, 0x39, 0xB2, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x2C, 0x73,
-    0x24, 0x21, 0x00, 0x00, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x61, 0x08, 0x41, 0x08, 0x86, 0x31, 0xCF, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x30, 0x94, 0x04, 0x21, 0x82, 0x10, 0x08, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x07, 0x21, 0x61, 0x08, 0x08, 0x4A, 0xD3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xEF, 0x8B, 0x45, 0x31, 0x20, 0x08, 0x21, 0x58, 0x02, 0xC0, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xD0, 0x01, 0x70,
-    0x41, 0x10, 0xC3, 0x20, 0x6D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xEB, 0x62,
-    0x41, 0x08, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE7, 0x20, 0x41, 0x08, 0x69, 0x52, 0xD3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xCF, 0x83, 0x04, 0x21, 0x41, 0x08, 0x41, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x41, 0x08, 0xE3, 0x20, 0xAE, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x8A, 0x5A, 0x41, 0x08, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0x41, 0x08, 0xAA, 0x5A,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x8E, 0x7B, 0xE3, 0x20, 0x41, 0x10, 0x01, 0x68,
-    0x02, 0xD0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x02, 0xC8, 0x21, 0x60, 0x41, 0x08, 0x24, 0x29, 0xCF, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xD3, 0xAC, 0x49, 0x52, 0x41, 0x08, 0xE7, 0x20, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE5, 0x18, 0x41, 0x08,
-    0x0C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0xC3, 0x18, 0x41, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x20, 0x08, 0x45, 0x29, 0x10, 0x8C, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xD3, 0xAC, 0x08, 0x42, 0x61, 0x08, 0x07, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x07, 0x21, 0x41, 0x08, 0x8A, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xB2, 0xAC, 0x28, 0x4A, 0x41, 0x08, 0x21, 0x58, 0x02, 0xD8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x02, 0xE8, 0x01, 0x78, 0x41, 0x10, 0x65, 0x39, 0x71, 0x9C, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x6D, 0x7B, 0x61, 0x08, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0x41, 0x08, 0xEB, 0x6A, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xB2, 0xA4, 0xE7, 0x41, 0x20, 0x00, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x41, 0x08, 0xA6, 0x39, 0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x2C, 0x73, 0x41, 0x08, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0x41, 0x08, 0x4D, 0x73, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4, 0xA6, 0x39, 0x41, 0x08, 0x01, 0x70, 0x02, 0xE8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x02, 0xE0, 0x01, 0x60, 0x20, 0x08, 0xE7, 0x49, 0xB2, 0xA4, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xEB, 0x62, 0x41, 0x08, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x61, 0x08, 0x8E, 0x7B,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x51, 0x9C, 0x65, 0x31, 0x41, 0x08, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x41, 0x08, 0x28, 0x4A, 0xD3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x8A, 0x5A, 0x41, 0x08, 0x07, 0x21, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x07, 0x21, 0x41, 0x08, 0xEB, 0x62, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x30, 0x94,
-    0xE3, 0x20, 0x41, 0x28, 0x02, 0xB8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x02, 0xD8, 0x41, 0x40, 0x82, 0x10, 0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xCF, 0x83, 0x61, 0x08, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x07, 0x21, 0x41, 0x08, 0x2C, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xEF, 0x8B, 0xC3, 0x18, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0xA2, 0x10, 0xCF, 0x83, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x8E, 0x7B, 0x41, 0x08, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0x41, 0x08, 0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xAE, 0x83, 0xA2, 0x18, 0x41, 0x38, 0x02, 0xD0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xC8, 0x41, 0x30, 0xC3, 0x20, 0xF0, 0x8B,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x2C, 0x73, 0x41, 0x08, 0x07, 0x21, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE5, 0x18, 0x61, 0x08, 0xCF, 0x83, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x8E, 0x7B, 0x82, 0x10, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0xE3, 0x20,
-    0x30, 0x94, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xCB, 0x62, 0x41, 0x08, 0x07, 0x21, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x28, 0x21, 0x61, 0x08, 0x8A, 0x52, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xAE, 0x83, 0x61, 0x10,
-    0x21, 0x58, 0x03, 0xE8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x80, 0x41, 0x08, 0xEB, 0x62, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x8E, 0x7B, 0x41, 0x08, 0xE6, 0x20, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x08, 0x21, 0x41, 0x08, 0xEB, 0x62, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x7B,
-    0x41, 0x08, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x41, 0x08, 0x2C, 0x73,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x2C, 0x73, 0x41, 0x08, 0x07, 0x21, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x07, 0x21, 0x41, 0x08, 0x2C, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x2C, 0x6B, 0x41, 0x08, 0x01, 0x70, 0x03, 0xF0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF0, 0x21, 0x60, 0x61, 0x10,
-    0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xCB, 0x62, 0x41, 0x08, 0x08, 0x21, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0x41, 0x08, 0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xCB, 0x62, 0x41, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08,
-    0x61, 0x10, 0xCF, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x69, 0x52, 0x61, 0x08, 0x28, 0x21,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29,
-    0x82, 0x10, 0xE7, 0x41, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x8E, 0x7B, 0x61, 0x08, 0x01, 0x78,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xA8, 0x41, 0x10, 0x8A, 0x5A,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xEB, 0x6A, 0x61, 0x08, 0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x49, 0x29, 0x82, 0x10, 0x29, 0x4A, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x2C, 0x73, 0x41, 0x08,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08,
-    0xEB, 0x62, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x8A, 0x5A, 0x62, 0x08, 0x29, 0x21, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x28, 0x21, 0x62, 0x08, 0xAA, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xEB, 0x62,
-    0x41, 0x08, 0x02, 0xA0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x88,
-    0x41, 0x08, 0x2C, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x28, 0x4A, 0x82, 0x10, 0x49, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0x61, 0x08, 0x0C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x8A, 0x5A, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x41, 0x08, 0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xC7, 0x39, 0x82, 0x10,
-    0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10,
-    0xE3, 0x18, 0xB2, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xCF, 0x83, 0x61, 0x10, 0x01, 0x88, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xB8, 0x41, 0x10,
-    0xCB, 0x62, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xC7, 0x39, 0x82, 0x10, 0x49, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0xA4, 0x10, 0x24, 0x29, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x7B, 0x41, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x41, 0x08, 0x2C, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x65, 0x31, 0xA3, 0x10, 0x49, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x49, 0x29, 0xA3, 0x10, 0x65, 0x31, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x2C, 0x73, 0x41, 0x08,
-    0x02, 0xA8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x01, 0x98, 0x41, 0x08, 0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x24, 0x21, 0xA4, 0x10,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x49, 0x29, 0x82, 0x10, 0xC7, 0x41, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xCB, 0x62,
-    0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x61, 0x08, 0xCF, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0xB2, 0xA4, 0xE3, 0x18,
-    0xC4, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x07, 0x21, 0x41, 0x08,
-    0x10, 0x8C, 0xF3, 0xAC, 0xF3, 0xAC, 0x51, 0x9C, 0x82, 0x10, 0x01, 0x78, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xA8,
-    0x41, 0x08, 0x6D, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xB2, 0xA4, 0xA3, 0x18, 0xC5, 0x18, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x20,
-    0x61, 0x08, 0x51, 0x9C, 0xF3, 0xAC, 0xF3, 0xAC, 0x10, 0x8C, 0x61, 0x08, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x41, 0x08, 0xCF, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4, 0x82, 0x10, 0xE6, 0x18,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0xE6, 0x18, 0x82, 0x10, 0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xCF, 0x83, 0x41, 0x08, 0x02, 0x98,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x01, 0x88, 0x61, 0x10, 0x10, 0x94, 0xF3, 0xAC, 0xF3, 0xAC, 0x51, 0x94, 0x61, 0x08,
-    0xE7, 0x20, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0xC5, 0x18, 0xC3, 0x18, 0xB2, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x7B, 0x41, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x82, 0x10, 0x51, 0x9C, 0xF3, 0xAC, 0xF3, 0xAC, 0x10, 0x8C,
-    0x41, 0x08, 0x07, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x82, 0x10, 0x49, 0x52,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x24, 0x29, 0x41, 0x48, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x01, 0x80, 0x61, 0x10, 0x51, 0x9C, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0x41, 0x08, 0x28, 0x21,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x62, 0x08,
-    0xAA, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC, 0xB2, 0xA4, 0xC3, 0x18, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0xA2, 0x10, 0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0x0C, 0x6B, 0x61, 0x08,
-    0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29,
-    0x61, 0x08, 0x0C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4, 0xA2, 0x18, 0x01, 0x70, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x21, 0x58, 0xC3, 0x20, 0xB2, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0x8A, 0x5A,
-    0x82, 0x10, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x28, 0x21, 0x41, 0x08, 0x6D, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0x71, 0x9C, 0x82, 0x10, 0x20, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x04, 0x21, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x49, 0x4A, 0x82, 0x10, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0xA2, 0x10, 0xB2, 0xA4,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x8A, 0x5A, 0x61, 0x20, 0x02, 0xE8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x41, 0x48, 0x65, 0x31, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x65, 0x31, 0xA4, 0x10,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0xC3, 0x18,
-    0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x08, 0x4A, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0xC7, 0x39, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x04, 0x21,
-    0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC4, 0x18,
-    0x24, 0x21, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xA6, 0x39, 0x41, 0x38, 0x03, 0xF0, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF0, 0x41, 0x28, 0x28, 0x4A, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC,
-    0xC3, 0x18, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0xA4, 0x10, 0x86, 0x31, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x45, 0x29, 0x61, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x8A, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xB2, 0xA4, 0x82, 0x10, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x82, 0x10, 0xCB, 0x62, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x30, 0x94, 0x41, 0x08, 0x02, 0xA8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x02, 0xD8, 0x41, 0x10, 0x4D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xEF, 0x8B, 0x20, 0x00,
-    0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x62, 0x08, 0x2C, 0x73,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xEF, 0x8B, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xAE, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x7B,
-    0x61, 0x08, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x61, 0x08,
-    0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xAE, 0x83, 0x41, 0x08, 0x02, 0xD0, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xC0, 0x41, 0x08, 0xF0, 0x8B, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x0C, 0x6B, 0x62, 0x08, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21,
-    0x21, 0x08, 0xEF, 0x8B, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x51, 0x94, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xAA, 0x5A, 0x82, 0x10, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0x82, 0x10, 0xB2, 0xA4, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xA6, 0x39, 0x41, 0x48, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xC0, 0x01, 0x80, 0x01, 0x60, 0x00, 0x48, 0x01, 0x58,
-    0x01, 0x78, 0x02, 0xB0, 0x03, 0xF0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x01, 0x80, 0xC3, 0x18, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x45, 0x29,
-    0xC4, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0xC3, 0x18, 0xD3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x45, 0x29, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x08, 0x42, 0xEF, 0x7B, 0xD3, 0x9C, 0x75, 0xAD,
-    0xF3, 0x9C, 0xEF, 0x7B, 0x28, 0x42, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x04, 0x21, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x04, 0x21, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x04, 0x21,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xE3, 0x20, 0x01, 0x70, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF0, 0x02, 0xB0, 0x01, 0x78, 0x01, 0x58,
-    0x00, 0x48, 0x01, 0x60, 0x01, 0x78, 0x02, 0xB8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x21, 0x58, 0x65, 0x31, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xD3, 0xAC, 0xA3, 0x18, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC4, 0x18,
-    0x65, 0x31, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0xA2, 0x18, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x08, 0x49, 0x42, 0x10, 0x74,
-    0xF3, 0x8C, 0x75, 0x9D, 0xB2, 0x84, 0xCF, 0x6B, 0xC7, 0x31, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xC7, 0x39, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xB2, 0xA4, 0x82, 0x10, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA3, 0x10, 0x49, 0x52, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x30, 0x94, 0x20, 0x08, 0x02, 0xC8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF0, 0x01, 0x88, 0x00, 0x18, 0x00, 0x08, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x01, 0x68, 0x02, 0xE8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF0, 0x61, 0x18, 0x2C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x73,
-    0x61, 0x08, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x82, 0x10, 0xAA, 0x5A, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xEF, 0x8B, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x82, 0x10, 0xAE, 0x73, 0x5D, 0xEF, 0xBE, 0xF7, 0xB6, 0xB5, 0xB2, 0x94, 0x10, 0x84,
-    0x92, 0x94, 0x96, 0xB5, 0x9E, 0xF7, 0x7D, 0xEF, 0xEF, 0x7B, 0xA2, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x0C, 0x6B, 0x82, 0x10, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x82, 0x10, 0x0C, 0x6B,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x7B, 0x41, 0x10, 0x02, 0xE0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xE8, 0x01, 0x78, 0x00, 0x10, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x08, 0x00, 0x10, 0x01, 0x80, 0x03, 0xF0, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xD8, 0x20, 0x08, 0xEF, 0x8B, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xAA, 0x5A, 0x83, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x61, 0x08,
-    0x6D, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0x0C, 0x6B, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x10, 0x51, 0x7C, 0x9E, 0xD7, 0x7D, 0xD7, 0x75, 0x9D,
-    0x92, 0x84, 0x10, 0x74, 0xD3, 0x84, 0xD7, 0xA5, 0xDF, 0xDF, 0x1C, 0xC7, 0x4D, 0x5B, 0x61, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x30, 0x94,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x49, 0x4A, 0xA3, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x29, 0x21, 0x20, 0x00, 0x10, 0x8C, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x28, 0x4A, 0x41, 0x40, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xD0,
-    0x00, 0x20, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x02, 0xA8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x78, 0xE3, 0x28, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC,
-    0x82, 0x10, 0xE7, 0x20, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x08, 0x21, 0x20, 0x00, 0x71, 0x9C, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xA6, 0x39, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xA6, 0x31, 0xFB, 0xDE, 0xFB, 0xDE, 0xEB, 0x5A, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x82, 0x10, 0xAA, 0x52, 0xBA, 0xD6, 0x3C, 0xE7, 0x08, 0x42, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x45, 0x29, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xB2, 0xA4, 0x61, 0x08, 0x07, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x07, 0x21, 0x61, 0x08, 0xB2, 0xA4,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x45, 0x31, 0x01, 0x68, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x02, 0xB8, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x18, 0x02, 0xC8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x21, 0x58, 0xA6, 0x41, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x71, 0x9C, 0x20, 0x00, 0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0x82, 0x10,
-    0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xE3, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x69, 0x42, 0x7D, 0xD7, 0x59, 0xB6, 0x69, 0x42, 0x61, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x10, 0x4D, 0x5B, 0x3C, 0xCF, 0xBA, 0xBE,
-    0x45, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x28, 0x4A,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x10, 0x8C, 0x20, 0x00, 0x29, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0xE3, 0x20, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC,
-    0x82, 0x10, 0x02, 0xA0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xB8, 0x00, 0x10,
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x88, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xE0, 0x20, 0x08, 0x10, 0x8C, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x08, 0x42, 0xA4, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x45, 0x29, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xB2, 0xA4, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x69, 0x4A,
-    0xBE, 0xF7, 0x71, 0x8C, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0xEF, 0x7B, 0xBE, 0xF7, 0xEB, 0x5A,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x71, 0x9C, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xA6, 0x39, 0xC4, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10, 0xA6, 0x39, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x71, 0x9C, 0x20, 0x08, 0x02, 0xC8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x02, 0x98, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08,
-    0x02, 0xA8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xB8, 0x61, 0x08, 0xB2, 0xA4,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x25, 0x29, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10, 0x08, 0x4A,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x10, 0x94, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x6D, 0x63, 0xDF, 0xDF, 0x6D, 0x63, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x10, 0x14, 0x8D,
-    0x7D, 0xD7, 0x08, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x10,
-    0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xE3, 0x18, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10, 0x49, 0x52, 0xF3, 0xAC, 0xF3, 0xAC, 0x8E, 0x7B,
-    0x41, 0x10, 0x03, 0xF0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xD0, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02, 0xA8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x61, 0x40, 0x69, 0x52, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x4D, 0x73, 0x62, 0x08, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA3, 0x10, 0xAA, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x0C, 0x6B, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA6, 0x31, 0x9E, 0xF7,
-    0x6D, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x5A, 0xDF, 0xFF,
-    0x08, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0xCB, 0x62, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xEB, 0x62, 0x82, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x82, 0x10, 0x0C, 0x6B, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xAA, 0x62, 0x61, 0x30, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xB8,
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0x02, 0xC8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x61, 0x18, 0x2C, 0x6B,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x8A, 0x5A, 0xA3, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x62, 0x08, 0x6D, 0x73,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x49, 0x52, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x8A, 0x4A, 0xDF, 0xDF, 0x49, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x10, 0x74, 0x7D, 0xCF, 0x24, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08,
-    0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0x28, 0x4A, 0xA4, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x61, 0x08, 0x6D, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0x28, 0x4A,
-    0x41, 0x48, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x28, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
-    0x02, 0xE0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x80, 0x04, 0x29, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x92, 0xA4, 0x20, 0x00, 0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x41, 0x08, 0xEF, 0x8B, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xC7, 0x39, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0xFB, 0xDE, 0x92, 0x94,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x7B,
-    0x3C, 0xE7, 0xA2, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x31, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x30, 0x94, 0x00, 0x00, 0x29, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x29, 0x21, 0x00, 0x00, 0x30, 0x94, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x65, 0x31, 0x01, 0x70, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xE8, 0x00, 0x10,
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0x00, 0x20, 0x03, 0xF0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x21, 0x58, 0xE7, 0x41,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xCF, 0x83, 0x41, 0x08, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0x20, 0x00, 0x92, 0xA4,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x04, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x19,
-    0x9E, 0xD7, 0x4D, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x20, 0x00, 0x34, 0x95, 0x59, 0xB6, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08,
-    0x49, 0x52, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x7B, 0x62, 0x08, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0x00, 0x00, 0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xE3, 0x28,
-    0x01, 0x88, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x98, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-    0x01, 0x60, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xC8, 0x20, 0x08, 0xB2, 0xA4, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xC3, 0x18, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x08, 0x21, 0x41, 0x08, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xA2, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8E, 0x73, 0x1C, 0xE7, 0x82, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08,
-    0x79, 0xCE, 0x10, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0xD3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x82, 0x10, 0x07, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x07, 0x21, 0x82, 0x10, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xD3, 0xAC, 0x61, 0x10, 0x02, 0xB0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x70, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x08, 0x01, 0x88, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xA0, 0xA2, 0x18,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x20, 0x00, 0x08, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0xC3, 0x18, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xB2, 0xA4, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD3, 0x84,
-    0xF7, 0xAD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xA2, 0x10, 0x7D, 0xCF, 0xCB, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x04, 0x21, 0xF3, 0xAC, 0xF3, 0xAC, 0x71, 0x9C, 0x00, 0x00, 0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x07, 0x21, 0x82, 0x10, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x41, 0x08,
-    0x02, 0xC0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0x02, 0xE8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF0, 0x20, 0x08, 0xEF, 0x8B, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x65, 0x31, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0xC3, 0x18, 0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x1C, 0xE7, 0x0C, 0x63, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x8A, 0x52, 0x9E, 0xF7, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x94,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x04, 0x21, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC6, 0x18, 0x24, 0x21, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x30, 0x94, 0x00, 0x00, 0x02, 0xE8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xD0, 0x00, 0x00,
-    0xB2, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xC3, 0x18, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x86, 0x31, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xCF, 0x83, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x18, 0xDF, 0xDF,
-    0xE7, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xCF, 0x6B, 0x79, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x61, 0x08, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x62, 0x10, 0x07, 0x21, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0x04, 0x21, 0xF3, 0xAC, 0xF3, 0xAC, 0x51, 0x94, 0x00, 0x00,
-    0x02, 0xE0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x02, 0x98, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x61, 0x20, 0x2C, 0x6B, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x28, 0x4A, 0xA4, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x66, 0x31, 0xF3, 0xAC, 0xF3, 0xAC, 0xEF, 0x8B,
-    0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x39, 0xDF, 0xFF, 0xA2, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x61, 0x08, 0x7D, 0xEF, 0x49, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x8E, 0x7B,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xC7, 0x41, 0xA4, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10, 0xE7, 0x41, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x6D, 0x7B, 0x61, 0x18, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xA8, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02, 0xC0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF0, 0x20, 0x08,
-    0xEF, 0x8B, 0xF3, 0xAC, 0xF3, 0xAC, 0x65, 0x31, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10, 0x49, 0x52, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x0C, 0x6B, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x53, 0xFB, 0xC6,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x04, 0x19, 0xFF, 0xDF, 0x24, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x51, 0x9C, 0xF3, 0xAC, 0xF3, 0xAC, 0x04, 0x21, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x66, 0x31, 0xF3, 0xAC, 0xF3, 0xAC, 0xAE, 0x83, 0x41, 0x10,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x98, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0x01, 0x58, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x61, 0x40, 0xAA, 0x5A, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x8A, 0x5A, 0xA3, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10, 0xE7, 0x41, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73,
-    0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAE, 0x73, 0xF7, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x55, 0xAD, 0x51, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x0C, 0x6B,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x49, 0x4A, 0xA4, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10, 0x49, 0x52, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xEB, 0x6A, 0x61, 0x30, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x70, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x61, 0x18,
-    0x4D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xC7, 0x41, 0xA4, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA3, 0x10, 0xAA, 0x5A, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x8A, 0x5A, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x8C, 0xB2, 0x84,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9A, 0xBE, 0x0C, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x41, 0x08, 0xCF, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0x65, 0x31, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0xA6, 0x39, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x7B, 0x61, 0x18,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x78, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x41, 0x50, 0x69, 0x52, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xEB, 0x62, 0xA3, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10, 0x28, 0x4A, 0xF3, 0xAC, 0xF3, 0xAC, 0x0C, 0x6B,
-    0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x94, 0xF3, 0x9C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x51, 0x8C, 0x34, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0xCB, 0x62,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x8A, 0x5A, 0xA4, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10, 0x8A, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xAA, 0x5A, 0x61, 0x38, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x68, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x61, 0x28,
-    0x2C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0x08, 0x4A, 0xA4, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA3, 0x10, 0xEB, 0x62, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x69, 0x52, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD7, 0xA5, 0xAE, 0x63,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x9D, 0xEF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x61, 0x08, 0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xA6, 0x39, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10, 0xE7, 0x41, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0x61, 0x20,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x68, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x28, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x21, 0x58, 0x28, 0x4A, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x0C, 0x6B, 0x83, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10, 0x49, 0x52, 0xF3, 0xAC, 0xF3, 0xAC, 0xEB, 0x62,
-    0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0xA5, 0x51, 0x8C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xAE, 0x73, 0xD7, 0xBD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x8A, 0x5A,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xAA, 0x5A, 0xA3, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA3, 0x10, 0xAA, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x8A, 0x5A, 0x61, 0x40, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x50, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x61, 0x30,
-    0xEB, 0x62, 0xF3, 0xAC, 0xF3, 0xAC, 0x49, 0x52, 0xA4, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x83, 0x10, 0x0C, 0x6B, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x28, 0x4A, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xB6, 0x0C, 0x53,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x8C, 0x92, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x61, 0x08, 0x4D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xE7, 0x41, 0xA4, 0x10, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0xC7, 0x39, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x7B, 0x61, 0x18,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x78, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x38, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x41, 0x50, 0x69, 0x52, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xEB, 0x62, 0xA3, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10, 0x28, 0x4A, 0xF3, 0xAC, 0xF3, 0xAC, 0x0C, 0x6B,
-    0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x92, 0x94, 0xD3, 0x9C, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x30, 0x84, 0x34, 0xA5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0xAA, 0x62,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x8A, 0x5A, 0xA3, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10, 0x8A, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xAA, 0x5A, 0x61, 0x40, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x48, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x68, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x61, 0x28,
-    0x0C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0x28, 0x4A, 0xA4, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA3, 0x10, 0xEB, 0x62, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x49, 0x52, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xA5, 0x8E, 0x63,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x9D, 0xEF, 0x6B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x61, 0x08, 0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xA6, 0x39, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x66, 0x31, 0xF3, 0xAC, 0xF3, 0xAC, 0xAE, 0x83, 0x41, 0x10,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x90, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x01, 0x58, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x61, 0x40, 0x8A, 0x5A, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xAA, 0x5A, 0xA3, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10, 0xE7, 0x41, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73,
-    0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0x7B, 0xD7, 0xBD, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x34, 0xA5, 0x71, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0xEB, 0x6A,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x49, 0x4A, 0xA4, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10, 0x49, 0x52, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xEB, 0x62, 0x61, 0x30, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x68, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x01, 0x80, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x61, 0x20,
-    0x4D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xE7, 0x41, 0xA4, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA3, 0x10, 0xAA, 0x5A, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x8A, 0x5A, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x8D, 0x71, 0x7C,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0xB6, 0x2C, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x41, 0x08, 0xCF, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0x65, 0x31, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xC6, 0x18, 0x24, 0x21, 0xF3, 0xAC, 0xF3, 0xAC, 0x30, 0x94, 0x00, 0x00,
-    0x02, 0xE8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x10, 0x01, 0x90, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x61, 0x28, 0x0C, 0x6B, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x49, 0x52, 0xA4, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x86, 0x31, 0xF3, 0xAC, 0xF3, 0xAC, 0xCF, 0x83,
-    0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42, 0xBE, 0xF7, 0x82, 0x10, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x41, 0x08, 0x5D, 0xEF, 0x8A, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x6D, 0x7B,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xE7, 0x41, 0xA4, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10, 0xE7, 0x41, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x6D, 0x73, 0x61, 0x18, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xA8, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02, 0xB8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x20, 0x08,
-    0xCF, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0x65, 0x31, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10, 0x49, 0x52, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x0C, 0x6B, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x5B, 0xBA, 0xBE,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0xE3, 0x18, 0xFF, 0xDF, 0x45, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x30, 0x94, 0xF3, 0xAC, 0xF3, 0xAC, 0x04, 0x21, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x07, 0x21, 0x82, 0x10, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x41, 0x08,
-    0x02, 0xC0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x02, 0xE0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x41, 0x08, 0xCF, 0x83, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x86, 0x31, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0xE3, 0x18, 0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x5D, 0xEF, 0xCB, 0x5A, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x28, 0x42, 0xBE, 0xF7, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x94,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x24, 0x21, 0xC6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x25, 0x29, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x30, 0x94, 0x00, 0x00, 0x02, 0xE8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xE8, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xD0, 0x00, 0x00,
-    0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xC3, 0x18, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0xA6, 0x39, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xCF, 0x83, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x18, 0xFF, 0xDF,
-    0x86, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x6D, 0x63, 0xDA, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x41, 0x08, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x82, 0x10, 0x07, 0x21, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0x00, 0x00, 0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xE3, 0x20,
-    0x01, 0x90, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x90, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-    0x01, 0x50, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xC8, 0x20, 0x08, 0x92, 0xA4, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xC3, 0x18, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x07, 0x21, 0x41, 0x08, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x7B, 0xBA, 0xD6, 0x61, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
-    0x38, 0xC6, 0x71, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0xD3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x82, 0x10, 0x07, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x07, 0x21, 0x82, 0x10, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xD3, 0xAC, 0x61, 0x08, 0x02, 0xB8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x60, 0x00, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x01, 0x78, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xA0, 0x82, 0x18,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x41, 0x08, 0x08, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0xE3, 0x18, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x92, 0xA4, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x95,
-    0x96, 0x9D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x82, 0x10, 0x3C, 0xCF, 0x2C, 0x5B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0xE3, 0x18, 0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4, 0x00, 0x00, 0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x61, 0x08, 0xAE, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0x08, 0x4A,
-    0x41, 0x50, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF0, 0x00, 0x20, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-    0x02, 0xD8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x88, 0xE3, 0x28, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xB2, 0xA4, 0x41, 0x08, 0x08, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x21, 0x08, 0xF0, 0x8B, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xA6, 0x39, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x10, 0x3C, 0xE7, 0xEF, 0x7B,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D, 0x6B,
-    0x7D, 0xEF, 0xC3, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65, 0x29, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x51, 0x9C, 0x00, 0x00, 0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0x00, 0x00, 0x51, 0x9C, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x45, 0x31, 0x01, 0x78, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xE0, 0x00, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x18, 0x03, 0xE8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x60, 0xC7, 0x41,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xEF, 0x8B, 0x41, 0x08, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x08, 0x21, 0x41, 0x08, 0xB2, 0xA4,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xE3, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21,
-    0xBE, 0xDF, 0xAA, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x92, 0x84, 0xBA, 0xBE, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08,
-    0x28, 0x4A, 0xF3, 0xAC, 0xF3, 0xAC, 0x8E, 0x7B, 0x61, 0x08, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA3, 0x10, 0x69, 0x52, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x73,
-    0x61, 0x18, 0x03, 0xF0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xC8, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x98,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x41, 0x40, 0x49, 0x52, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x6D, 0x7B, 0x62, 0x08, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x83, 0x10, 0xCB, 0x62, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x0C, 0x6B, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x42, 0xBE, 0xF7,
-    0xAA, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x49, 0x4A, 0xDF, 0xFF,
-    0x8A, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0xAA, 0x5A, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x0C, 0x6B, 0x82, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x82, 0x10, 0x2C, 0x6B, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xAA, 0x5A, 0x61, 0x38, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xA8,
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x08, 0x02, 0xB8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x61, 0x20, 0x0C, 0x6B,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xAA, 0x5A, 0xA3, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x61, 0x08, 0x8E, 0x7B,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x49, 0x4A, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x0C, 0x5B, 0xBE, 0xD7, 0xC7, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x4D, 0x5B, 0x9E, 0xD7, 0x86, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08,
-    0x6D, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0x49, 0x52, 0xA4, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x04, 0x21, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC,
-    0x61, 0x10, 0x02, 0xB0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xA8, 0x00, 0x08,
-    0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x01, 0x70, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xE0, 0x20, 0x08, 0xEF, 0x8B, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x28, 0x4A, 0xA4, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x66, 0x31, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x92, 0xA4, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x63,
-    0xDF, 0xFF, 0xAE, 0x73, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2C, 0x63, 0xDF, 0xFF, 0x8E, 0x73,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x51, 0x94, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xC7, 0x39, 0xA4, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10, 0xC7, 0x41, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x30, 0x94, 0x00, 0x00, 0x02, 0xD0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x01, 0x80, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
-    0x01, 0x98, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xC0, 0x41, 0x08, 0x92, 0xA4,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x65, 0x29, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA3, 0x10, 0x49, 0x4A,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xEF, 0x8B, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x30, 0x74, 0xBE, 0xD7, 0xAA, 0x4A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x30, 0x74,
-    0xBE, 0xDF, 0x8A, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08,
-    0xB2, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x04, 0x21, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0x20, 0x00, 0x30, 0x94, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xE7, 0x41, 0x41, 0x48, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xC0,
-    0x00, 0x18, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x01, 0x90, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x88, 0xC3, 0x20, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xA2, 0x10, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x07, 0x21, 0x41, 0x08, 0x92, 0xA4, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x86, 0x31, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x49, 0x4A, 0x7D, 0xEF, 0x59, 0xCE, 0x28, 0x42, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x39, 0xF7, 0xBD, 0x9E, 0xF7, 0xAA, 0x52, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x29, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xB2, 0xA4, 0x61, 0x08, 0x07, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x07, 0x21, 0x61, 0x08, 0xB2, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x24, 0x29, 0x01, 0x78, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x02, 0xA0, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x10, 0x02, 0xB0,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x21, 0x60, 0x86, 0x39, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x71, 0x9C, 0x41, 0x08, 0x08, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0xA2, 0x10,
-    0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xC3, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x2C, 0x5B, 0xDF, 0xDF, 0x96, 0x9D, 0xA6, 0x29, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x69, 0x42, 0x9A, 0xBE, 0x3C, 0xCF,
-    0xC7, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xE7, 0x41,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x30, 0x94, 0x20, 0x00, 0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA3, 0x10, 0x8A, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x10, 0x8C, 0x20, 0x08, 0x02, 0xD0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x02, 0xE8, 0x01, 0x70, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x01, 0x50, 0x02, 0xD8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF0, 0x61, 0x18, 0xEB, 0x62, 0xF3, 0xAC, 0xF3, 0xAC, 0x8E, 0x7B,
-    0x61, 0x08, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x82, 0x10, 0xEB, 0x62, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xAE, 0x83, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0xC3, 0x18, 0x71, 0x8C, 0xDF, 0xFF, 0x3C, 0xE7, 0xF3, 0x9C, 0xEF, 0x7B, 0x2C, 0x63,
-    0xCF, 0x7B, 0xD3, 0x9C, 0x1C, 0xE7, 0xDF, 0xFF, 0xD3, 0x9C, 0x04, 0x21, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x4D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x2C, 0x73, 0x62, 0x08, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x62, 0x08, 0x4D, 0x73,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0x41, 0x10, 0x02, 0xE8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x02, 0xD8, 0x01, 0x58, 0x00, 0x08, 0x00, 0x10, 0x00, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x08, 0x00, 0x08, 0x01, 0x68, 0x02, 0xE0, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xE0, 0x41, 0x08, 0xAE, 0x83, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xCB, 0x62, 0x82, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x41, 0x08,
-    0xAE, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0xEB, 0x62, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x21, 0x34, 0x95, 0xFF, 0xDF, 0xDB, 0xBE, 0xB2, 0x84,
-    0xAE, 0x6B, 0x2C, 0x5B, 0xEF, 0x6B, 0x14, 0x8D, 0x5D, 0xCF, 0x9E, 0xD7, 0x10, 0x74, 0xA2, 0x10,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10, 0x8C,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x69, 0x52, 0xA3, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0xA2, 0x10, 0xD3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x65, 0x39, 0x21, 0x58, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF0, 0x02, 0xA8, 0x01, 0x60, 0x00, 0x40, 0x00, 0x28, 0x00, 0x38,
-    0x01, 0x58, 0x01, 0x90, 0x02, 0xE0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x01, 0x90, 0x82, 0x18, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x86, 0x31,
-    0xA4, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0xE3, 0x18, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x04, 0x21, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0x10, 0xCB, 0x5A, 0xD3, 0x9C, 0x96, 0xB5, 0x59, 0xCE,
-    0xB6, 0xB5, 0xD3, 0x9C, 0xEB, 0x5A, 0xC3, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x18, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x24, 0x29, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x45, 0x29,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0xC3, 0x20, 0x01, 0x80, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xE8, 0x01, 0x98, 0x01, 0x58, 0x00, 0x38,
-    0x00, 0x28, 0x00, 0x40, 0x01, 0x60, 0x02, 0xA0, 0x02, 0xE8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x21, 0x68, 0x24, 0x29, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xE3, 0x18, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10,
-    0xA6, 0x39, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x18, 0x2C, 0x5B, 0xF3, 0x8C,
-    0xD7, 0xA5, 0x59, 0xB6, 0x96, 0x9D, 0xB2, 0x84, 0x8A, 0x4A, 0x82, 0x10, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x86, 0x31, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xD3, 0xAC, 0xA2, 0x10, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x62, 0x08, 0x0C, 0x6B, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x10, 0x94, 0x41, 0x08, 0x02, 0xB8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x02, 0xE8, 0x61, 0x18, 0x0C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0x10, 0x94, 0x20, 0x00,
-    0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x61, 0x08, 0x6D, 0x73,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xCF, 0x83, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x6D, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xAE, 0x83,
-    0x41, 0x08, 0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0x41, 0x08,
-    0xCF, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0x41, 0x10, 0x02, 0xD8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xC8, 0x20, 0x08, 0xAE, 0x83, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x4D, 0x73, 0x61, 0x08, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21,
-    0x20, 0x00, 0x10, 0x94, 0xF3, 0xAC, 0xF3, 0xAC, 0xEB, 0x6A, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x10, 0x8C, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xEB, 0x62, 0x62, 0x08, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0xC3, 0x18, 0xD3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x28, 0x52, 0x41, 0x28, 0x03, 0xF0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x21, 0x50, 0x24, 0x29, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xA6, 0x39, 0xA4, 0x10,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x04, 0x21,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xC7, 0x39, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x65, 0x31, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x45, 0x29,
-    0xA4, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x18,
-    0x65, 0x29, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x65, 0x31, 0x41, 0x40, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF0, 0x41, 0x30, 0xC7, 0x41, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC,
-    0xE4, 0x20, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0xA3, 0x10, 0xC7, 0x39, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x04, 0x21, 0x41, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x49, 0x4A, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xD3, 0xAC, 0xC3, 0x18, 0xC6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x82, 0x10, 0x8A, 0x5A,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xB2, 0xA4, 0xE3, 0x20, 0x21, 0x58, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x01, 0x90, 0x61, 0x10, 0x10, 0x94, 0xF3, 0xAC, 0xF3, 0xAC, 0xAE, 0x83, 0x41, 0x08, 0x28, 0x21,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x62, 0x08,
-    0xEB, 0x6A, 0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4, 0xA2, 0x18, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x20, 0x00, 0x82, 0x10, 0x71, 0x9C, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0x61, 0x08,
-    0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21,
-    0x41, 0x08, 0x4D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0x71, 0x9C, 0x82, 0x10, 0x01, 0x80, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x01, 0x68, 0xA2, 0x18, 0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xEB, 0x62,
-    0x62, 0x08, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x28, 0x21, 0x41, 0x08, 0xAE, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0x30, 0x94, 0x61, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xE3, 0x18, 0xB2, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x8A, 0x5A, 0x82, 0x10, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE7, 0x20, 0x61, 0x08,
-    0x51, 0x94, 0xF3, 0xAC, 0xF3, 0xAC, 0x10, 0x94, 0x61, 0x10, 0x01, 0x88, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xB8,
-    0x41, 0x10, 0x2C, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0xE3, 0x18, 0xC5, 0x18, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18,
-    0x82, 0x10, 0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xCF, 0x83, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x41, 0x08, 0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xB2, 0xA4, 0xA2, 0x10, 0xC5, 0x18,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0xC5, 0x18, 0xA2, 0x18, 0xB2, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x7B, 0x41, 0x08, 0x02, 0xB0,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x01, 0x98, 0x41, 0x08, 0xEF, 0x8B, 0xF3, 0xAC, 0xF3, 0xAC, 0x71, 0x9C, 0x82, 0x10,
-    0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0xC5, 0x18, 0xE3, 0x18, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x0C, 0x6B, 0x41, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x61, 0x08, 0x10, 0x94, 0xF3, 0xAC, 0xF3, 0xAC, 0x30, 0x94,
-    0x61, 0x08, 0x07, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10,
-    0x24, 0x21, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x7B, 0x41, 0x08, 0x02, 0xA0, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xC8, 0x41, 0x10,
-    0x69, 0x52, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x28, 0x4A, 0x82, 0x10, 0x49, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29,
-    0xA3, 0x10, 0x65, 0x31, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x2C, 0x6B, 0x41, 0x08, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x41, 0x08, 0xCB, 0x62, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xA7, 0x39, 0x82, 0x10, 0x49, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x49, 0x29, 0x82, 0x10, 0xC7, 0x39, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xCB, 0x62, 0x41, 0x10,
-    0x02, 0xC0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x02, 0xB0, 0x41, 0x08, 0x2C, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x65, 0x31, 0xA3, 0x10,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x49, 0x29, 0x82, 0x10, 0x28, 0x4A, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x69, 0x52,
-    0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x04, 0x21,
-    0xA4, 0x10, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29,
-    0x82, 0x10, 0x29, 0x4A, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x0C, 0x6B, 0x41, 0x08, 0x01, 0x90,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xB8, 0x41, 0x10, 0x08, 0x4A,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0x41, 0x08, 0x08, 0x21, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x29, 0x21, 0x62, 0x08, 0xAA, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xCB, 0x62, 0x41, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08,
-    0x69, 0x52, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xEB, 0x6A, 0x61, 0x08, 0x28, 0x21, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x28, 0x21, 0x61, 0x08, 0x0C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x69, 0x52,
-    0x41, 0x10, 0x02, 0xB0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xA0,
-    0x41, 0x08, 0xCB, 0x62, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x8A, 0x5A, 0x62, 0x08, 0x29, 0x21,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x08, 0x21, 0x41, 0x08, 0x6D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x08, 0x42, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x41, 0x08, 0x2C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x28, 0x4A, 0x82, 0x10,
-    0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x07, 0x21, 0x41, 0x08, 0xEB, 0x62, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0x41, 0x08,
-    0x01, 0x68, 0x03, 0xF0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x98, 0x41, 0x10, 0x69, 0x52, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xEF, 0x8B, 0x61, 0x08, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x07, 0x21, 0x41, 0x08, 0x4D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x0C, 0x6B,
-    0x41, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x41, 0x08, 0xCB, 0x62,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x8E, 0x7B, 0x41, 0x08, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0x41, 0x08, 0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xAA, 0x5A, 0x41, 0x08, 0x01, 0x88, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x01, 0x78, 0x41, 0x08,
-    0x0C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0x41, 0x08, 0x07, 0x21, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0x61, 0x08, 0xEF, 0x8B, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x49, 0x52, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08,
-    0x41, 0x08, 0x6D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xEB, 0x62, 0x41, 0x08, 0x08, 0x21,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0xE7, 0x20, 0x41, 0x08, 0x4D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xCF, 0x83,
-    0xA2, 0x18, 0x61, 0x38, 0x02, 0xD0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x02, 0xE8, 0x21, 0x58, 0x61, 0x10, 0x2C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x10, 0x94, 0x82, 0x10, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0x41, 0x08, 0xAE, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x8E, 0x7B, 0x82, 0x10, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x61, 0x10, 0x6D, 0x7B, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xEF, 0x8B, 0x61, 0x08, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x61, 0x08, 0xEF, 0x8B, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x4D, 0x73, 0x61, 0x10, 0x41, 0x48, 0x02, 0xE0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xD8, 0x41, 0x40, 0x82, 0x18, 0xAE, 0x83,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xAE, 0x7B, 0x41, 0x08, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x82, 0x10, 0x10, 0x94, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x0C, 0x6B, 0x61, 0x08, 0x41, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0xA2, 0x18,
-    0xEF, 0x8B, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0x41, 0x08, 0xE7, 0x20, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0x41, 0x08, 0x0C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x92, 0xA4, 0xA6, 0x39, 0x41, 0x08, 0x01, 0x70, 0x02, 0xE8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF0, 0x01, 0x90, 0x41, 0x10, 0x04, 0x29, 0x10, 0x94, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xEF, 0x8B, 0x82, 0x10, 0xA4, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x41, 0x08, 0x6D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0x71, 0x9C, 0x65, 0x31, 0x41, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0x24, 0x29, 0x51, 0x9C, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xAE, 0x83, 0x61, 0x08, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x61, 0x08, 0xAE, 0x83, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x51, 0x94, 0x24, 0x29, 0x41, 0x10, 0x01, 0x88, 0x03, 0xF0, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xE8, 0x01, 0x78, 0x41, 0x10, 0x65, 0x39, 0x71, 0x9C, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0x41, 0x08, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xA4, 0x10, 0x82, 0x10, 0xEF, 0x8B,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x10, 0x94, 0x04, 0x21, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0xA6, 0x39, 0x92, 0xA4,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x0C, 0x6B, 0x41, 0x08, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0x41, 0x08, 0x8A, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x8E, 0x7B, 0xE3, 0x20, 0x41, 0x10, 0x01, 0x70, 0x02, 0xD8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xE8, 0x01, 0x88,
-    0x61, 0x20, 0x82, 0x10, 0xEB, 0x62, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x73,
-    0x61, 0x08, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0x41, 0x08, 0xEB, 0x62, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0xC3, 0x18, 0x61, 0x08, 0x20, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x61, 0x08, 0xA2, 0x10, 0x2C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x0C, 0x6B, 0x41, 0x08, 0xC5, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x41, 0x08, 0x2C, 0x73,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x0C, 0x6B, 0xA2, 0x18, 0x61, 0x18, 0x01, 0x80,
-    0x02, 0xE0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x02, 0xD8, 0x01, 0x78, 0x61, 0x10, 0xC3, 0x20, 0x6D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xCB, 0x62, 0x41, 0x08, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xC5, 0x18, 0x61, 0x08,
-    0x6D, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0xEB, 0x62, 0x82, 0x10, 0x61, 0x08,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x08, 0xE3, 0x18, 0xAE, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x6A, 0x5A, 0x41, 0x08, 0xE6, 0x20, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x07, 0x21, 0x62, 0x08, 0x65, 0x31, 0x92, 0xA4,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0x04, 0x29, 0x00, 0x00, 0x61, 0x38,
-    0x01, 0x80, 0x02, 0xC0, 0x03, 0xF0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xD0, 0x01, 0x90, 0x41, 0x48, 0x41, 0x08, 0xA2, 0x18,
-    0xCB, 0x62, 0xB2, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x28, 0x4A, 0x41, 0x08,
-    0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE7, 0x20, 0x61, 0x08, 0xA6, 0x39,
-    0xB2, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x0C, 0x6B, 0xE3, 0x20, 0x20, 0x00,
-    0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x08, 0x20, 0x00,
-    0xC3, 0x18, 0xEB, 0x6A, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xB2, 0xA4, 0xE7, 0x41,
-    0x61, 0x08, 0xE6, 0x18, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18, 0x41, 0x08,
-    0xE8, 0x41, 0xB2, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0xEB, 0x6A, 0xC3, 0x20,
-    0x20, 0x08, 0x41, 0x48, 0x01, 0x88, 0x02, 0xD0, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8,
-    0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x03, 0xF8, 0x02, 0xC8, 0x01, 0x88, 0x41, 0x40,
-    0x20, 0x08, 0xE3, 0x28, 0x2C, 0x6B, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xB2, 0xA4,
-    0xA6, 0x39, 0x61, 0x08, 0x07, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0xE6, 0x18,
-    0x41, 0x08, 0x49, 0x4A, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xB2, 0xA4, 0xCB, 0x62,
-    0xA2, 0x18, 0x41, 0x08, 0x61, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x61, 0x08, 0x00, 0x00, 0x04, 0x21, 0x4D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0x71, 0x9C, 0x65, 0x31, 0x62, 0x08, 0x07, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0xA3, 0x10, 0x82, 0x10,
-    0xEB, 0x6A, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x30, 0x94, 0x8A, 0x52,
-    0x04, 0x29, 0x20, 0x08, 0x20, 0x08, 0x61, 0x28, 0x61, 0x40, 0x41, 0x50, 0x01, 0x60, 0x41, 0x50,
-    0x61, 0x48, 0x61, 0x30, 0x41, 0x10, 0x00, 0x00, 0xC3, 0x20, 0x28, 0x4A, 0xCF, 0x83, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xEF, 0x8B, 0x04, 0x21, 0x62, 0x10, 0x07, 0x21,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0x83, 0x10,
-    0xA2, 0x10, 0x0C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x10, 0x8C,
-    0x49, 0x52, 0xE3, 0x20, 0x20, 0x00, 0x41, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x00, 0x00,
-    0x41, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x00, 0x00, 0xE3, 0x18, 0x49, 0x4A, 0xEF, 0x8B,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xAE, 0x83, 0xE3, 0x18, 0x82, 0x10,
-    0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21,
-    0x82, 0x10, 0xC3, 0x18, 0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xEF, 0x8B, 0x49, 0x4A, 0xE3, 0x20, 0x00, 0x00, 0x41, 0x10, 0x61, 0x28, 0x61, 0x48, 0x41, 0x50,
-    0x01, 0x60, 0x41, 0x50, 0x61, 0x40, 0x61, 0x28, 0x41, 0x08, 0x20, 0x08, 0x04, 0x29, 0x69, 0x52,
-    0x10, 0x8C, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x7B, 0xA3, 0x18,
-    0x83, 0x10, 0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x08, 0x21, 0x82, 0x10, 0xE4, 0x20, 0xCF, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xCF, 0x83, 0x08, 0x4A, 0xC3, 0x18, 0x00, 0x00, 0x41, 0x08, 0x61, 0x08, 0x61, 0x08,
-    0x41, 0x08, 0x00, 0x00, 0x61, 0x08, 0x61, 0x08, 0x61, 0x08, 0x20, 0x00, 0x20, 0x08, 0x04, 0x21,
-    0x8A, 0x5A, 0x30, 0x94, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73,
-    0x82, 0x10, 0xA3, 0x10, 0x29, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0xE6, 0x18,
-    0x61, 0x08, 0x45, 0x29, 0xCF, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xB2, 0xA4, 0xCF, 0x83, 0x0C, 0x6B, 0x8A, 0x5A, 0x49, 0x52, 0x08, 0x42, 0x49, 0x4A,
-    0x8A, 0x5A, 0xEB, 0x62, 0xAE, 0x83, 0x71, 0x9C, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x30, 0x94, 0xC7, 0x41, 0x41, 0x08, 0xC4, 0x18, 0x49, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29,
-    0xC5, 0x18, 0x41, 0x08, 0x65, 0x31, 0xEF, 0x8B, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4, 0xCF, 0x83, 0x0C, 0x6B, 0x8A, 0x5A, 0x49, 0x52, 0x08, 0x42,
-    0x49, 0x52, 0x8A, 0x5A, 0x0C, 0x6B, 0xAE, 0x83, 0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x10, 0x8C, 0xA6, 0x39, 0x41, 0x08, 0xC5, 0x18, 0x49, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x49, 0x29, 0xC5, 0x18, 0x41, 0x08, 0xA6, 0x39, 0x10, 0x94, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4, 0xAE, 0x83, 0x0C, 0x6B, 0x8A, 0x5A, 0x49, 0x52,
-    0x08, 0x42, 0x49, 0x52, 0x8A, 0x5A, 0x0C, 0x6B, 0xCF, 0x83, 0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xEF, 0x8B, 0x65, 0x31, 0x41, 0x08, 0xC5, 0x18,
-    0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x49, 0x29, 0xC4, 0x18, 0x41, 0x08, 0xE7, 0x41, 0x30, 0x94, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x71, 0x9C, 0xAE, 0x83, 0xEB, 0x62, 0x8A, 0x5A,
-    0x49, 0x4A, 0x08, 0x42, 0x49, 0x52, 0x8A, 0x5A, 0x0C, 0x6B, 0xEF, 0x8B, 0xB2, 0xA4, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xAE, 0x83, 0x25, 0x29, 0x61, 0x08,
-    0xE6, 0x18, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x29, 0x21, 0xA4, 0x10, 0x41, 0x08, 0x25, 0x29, 0x4D, 0x73, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xCF, 0x83, 0xC7, 0x39, 0x20, 0x00, 0xA3, 0x10, 0x08, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x28, 0x21, 0xA4, 0x10, 0x20, 0x00, 0x65, 0x31, 0x8E, 0x7B, 0xD3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xAE, 0x83, 0x86, 0x31, 0x20, 0x00, 0xA4, 0x10, 0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0xA4, 0x10, 0x20, 0x00, 0xA6, 0x39, 0xAE, 0x83, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xD3, 0xAC, 0x6D, 0x7B, 0x65, 0x31, 0x41, 0x08, 0xA4, 0x10, 0x28, 0x21, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x08, 0x21, 0xA3, 0x10, 0x41, 0x08, 0xC7, 0x39, 0xCF, 0x83,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x4D, 0x73, 0x25, 0x29, 0x41, 0x08, 0xC4, 0x18, 0x29, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0xC4, 0x18, 0x61, 0x08, 0x82, 0x10, 0x08, 0x4A, 0x6D, 0x73,
-    0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0xAE, 0x83, 0x69, 0x52, 0xC3, 0x18,
-    0x41, 0x08, 0xA4, 0x10, 0x08, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0xC4, 0x10, 0x61, 0x08, 0x82, 0x10, 0x28, 0x4A,
-    0x6D, 0x7B, 0xB2, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xB2, 0xA4, 0x8E, 0x7B, 0x49, 0x4A,
-    0xA2, 0x10, 0x41, 0x08, 0xA4, 0x10, 0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x28, 0x21, 0xA4, 0x10, 0x41, 0x08, 0xA2, 0x10,
-    0x49, 0x52, 0x8E, 0x7B, 0xB2, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xB2, 0xA4, 0x6D, 0x7B,
-    0x28, 0x4A, 0x82, 0x10, 0x61, 0x08, 0xA4, 0x18, 0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x08, 0x21, 0xA4, 0x10, 0x41, 0x08,
-    0xC3, 0x18, 0x69, 0x52, 0xAE, 0x83, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
-    0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4,
-    0x4D, 0x73, 0x08, 0x42, 0x82, 0x10, 0x61, 0x08, 0xC4, 0x18, 0x28, 0x21, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0xE7, 0x20, 0xA4, 0x10, 0x62, 0x08,
-    0x20, 0x00, 0xE3, 0x18, 0xA6, 0x39, 0x69, 0x52, 0xCB, 0x62, 0x0C, 0x6B, 0x4D, 0x73, 0x0C, 0x6B,
-    0xEB, 0x62, 0x8A, 0x5A, 0xC7, 0x39, 0x04, 0x21, 0x61, 0x08, 0x41, 0x08, 0xA3, 0x10, 0xE6, 0x18,
-    0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0xE6, 0x18, 0xA4, 0x10,
-    0x61, 0x08, 0x41, 0x08, 0xE3, 0x20, 0xA6, 0x39, 0x69, 0x52, 0xCB, 0x62, 0x0C, 0x6B, 0x4D, 0x73,
-    0x0C, 0x6B, 0xCB, 0x62, 0x8A, 0x52, 0xA6, 0x39, 0xE4, 0x20, 0x41, 0x08, 0x61, 0x08, 0xA3, 0x10,
-    0xE6, 0x18, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0xE6, 0x18,
-    0xA3, 0x10, 0x61, 0x08, 0x41, 0x08, 0xE4, 0x20, 0xA6, 0x39, 0x8A, 0x52, 0xCB, 0x62, 0x0C, 0x6B,
-    0x4D, 0x73, 0x0C, 0x6B, 0xCB, 0x62, 0x69, 0x52, 0xA6, 0x39, 0xE3, 0x20, 0x41, 0x08, 0x61, 0x08,
-    0xA4, 0x10, 0xE6, 0x18, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29,
-    0xE6, 0x18, 0xA3, 0x10, 0x41, 0x08, 0x61, 0x08, 0x04, 0x21, 0xC7, 0x39, 0x8A, 0x5A, 0xEB, 0x62,
-    0x0C, 0x6B, 0x4D, 0x73, 0x0C, 0x6B, 0xCB, 0x62, 0x69, 0x52, 0xA6, 0x39, 0xE3, 0x18, 0x20, 0x00,
-    0x62, 0x08, 0xA4, 0x10, 0xE7, 0x20, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x28, 0x21, 0xE6, 0x18, 0xC5, 0x18, 0xA4, 0x10, 0xA3, 0x10, 0x83, 0x10, 0x82, 0x10, 0x82, 0x10,
-    0xA3, 0x10, 0xA3, 0x10, 0xC4, 0x10, 0xE6, 0x18, 0x07, 0x21, 0x49, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x49, 0x29, 0x08, 0x21, 0xE6, 0x18, 0xC5, 0x18, 0xA4, 0x10, 0xA3, 0x10, 0x83, 0x10, 0x82, 0x10,
-    0x82, 0x10, 0xA3, 0x10, 0xA3, 0x10, 0xC4, 0x10, 0xE6, 0x18, 0x07, 0x21, 0x49, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x49, 0x29, 0x07, 0x21, 0xE6, 0x18, 0xC4, 0x10, 0xA3, 0x10, 0xA3, 0x10, 0x82, 0x10,
-    0x82, 0x10, 0x83, 0x10, 0xA3, 0x10, 0xA4, 0x10, 0xC5, 0x18, 0xE6, 0x18, 0x08, 0x21, 0x49, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x49, 0x29, 0x07, 0x21, 0xE6, 0x18, 0xC4, 0x10, 0xA3, 0x10, 0xA3, 0x10,
-    0x82, 0x10, 0x82, 0x10, 0x83, 0x10, 0xA3, 0x10, 0xA4, 0x10, 0xC5, 0x18, 0xE6, 0x18, 0x28, 0x21,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29,
-    0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29, 0x4A, 0x29
+const uint8_t bitmap_pixel_data_bp_coupled[12854] PROGMEM = {
+    0xFF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xBF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xBF,
+    0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xBF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xFF, 0x4A,
+    0x29, 0xBF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xBF, 0x4A, 0x29, 0xFF, 0x4A, 0x29,
+    0xFF, 0x4A, 0x29, 0xBF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xBF, 0x4A, 0x29, 0xFF,
+    0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xBF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xBF, 0x4A,
+    0x29, 0xFF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xBF, 0x4A, 0x29, 0xF5, 0x4A, 0x29, 0x83, 0xC5, 0xFE,
+    0xCB, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xF5, 0x4A, 0x29, 0xF5, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xCB,
+    0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xF5, 0x4A, 0x29, 0xF5, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xCB, 0x4A,
+    0x29, 0x83, 0xC5, 0xFE, 0xF5, 0x4A, 0x29, 0xF5, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xCB, 0x4A, 0x29,
+    0x83, 0xC5, 0xFE, 0xF5, 0x4A, 0x29, 0xF5, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xCB, 0x4A, 0x29, 0x83,
+    0xC5, 0xFE, 0xF5, 0x4A, 0x29, 0xF5, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xCB, 0x4A, 0x29, 0x83, 0xC5,
+    0xFE, 0xF5, 0x4A, 0x29, 0xF5, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xCB, 0x4A, 0x29, 0x83, 0xC5, 0xFE,
+    0xF5, 0x4A, 0x29, 0xF5, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xCB, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xF5,
+    0x4A, 0x29, 0xF5, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xCB, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xF5, 0x4A,
+    0x29, 0xF5, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xCB, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xF5, 0x4A, 0x29,
+    0xF5, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xCB, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xF5, 0x4A, 0x29, 0xF5,
+    0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xCB, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xF5, 0x4A, 0x29, 0xF5, 0x4A,
+    0x29, 0x83, 0xC5, 0xFE, 0xCB, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xF5, 0x4A, 0x29, 0xF5, 0x4A, 0x29,
+    0x83, 0xC5, 0xFE, 0xCB, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xF5, 0x4A, 0x29, 0xF5, 0x4A, 0x29, 0x83,
+    0xC5, 0xFE, 0xCB, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xF5, 0x4A, 0x29, 0xF5, 0x4A, 0x29, 0x83, 0xC5,
+    0xFE, 0xCB, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xF5, 0x4A, 0x29, 0xF5, 0x4A, 0x29, 0x83, 0xC5, 0xFE,
+    0xCB, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xF5, 0x4A, 0x29, 0xF5, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xCB,
+    0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xF5, 0x4A, 0x29, 0xF5, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xCB, 0x4A,
+    0x29, 0x83, 0xC5, 0xFE, 0xF5, 0x4A, 0x29, 0xF5, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0xCB, 0x4A, 0x29,
+    0x83, 0xC5, 0xFE, 0xF5, 0x4A, 0x29, 0xED, 0x4A, 0x29, 0x01, 0x28, 0x4A, 0xC9, 0x39, 0x85, 0x4A,
+    0x29, 0x83, 0xC5, 0xFE, 0x85, 0x4A, 0x29, 0x01, 0xC9, 0x39, 0x28, 0x4A, 0xBB, 0x4A, 0x29, 0x01,
+    0x28, 0x4A, 0xC9, 0x39, 0x85, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0x85, 0x4A, 0x29, 0x01, 0xC9, 0x39,
+    0x28, 0x4A, 0xED, 0x4A, 0x29, 0xED, 0x4A, 0x29, 0x07, 0xC7, 0x62, 0xC5, 0xFE, 0x05, 0xDE, 0x85,
+    0xA4, 0x07, 0x6B, 0xA9, 0x31, 0x4A, 0x29, 0x4A, 0x29, 0x83, 0xC5, 0xFE, 0x07, 0x4A, 0x29, 0x4A,
+    0x29, 0x89, 0x31, 0xC7, 0x5A, 0x26, 0x94, 0xA5, 0xCD, 0xA5, 0xFE, 0xC7, 0x62, 0xBB, 0x4A, 0x29,
+    0x07, 0xC7, 0x62, 0xC5, 0xFE, 0x05, 0xDE, 0x85, 0xA4, 0x07, 0x6B, 0xA9, 0x31, 0x4A, 0x29, 0x4A,
+    0x29, 0x83, 0xC5, 0xFE, 0x07, 0x4A, 0x29, 0x4A, 0x29, 0x89, 0x31, 0xC7, 0x5A, 0x26, 0x94, 0xA5,
+    0xCD, 0xA5, 0xFE, 0xC7, 0x62, 0xED, 0x4A, 0x29, 0xEE, 0x4A, 0x29, 0x00, 0xE5, 0xDD, 0x82, 0xC5,
+    0xFE, 0x02, 0xA5, 0xFE, 0xA5, 0xCD, 0x26, 0x94, 0x83, 0xC5, 0xFE, 0x02, 0xC6, 0x8B, 0x45, 0xC5,
+    0x85, 0xF6, 0x82, 0xC5, 0xFE, 0x00, 0xE5, 0xDD, 0xBD, 0x4A, 0x29, 0x00, 0xE5, 0xDD, 0x82, 0xC5,
+    0xFE, 0x02, 0xA5, 0xFE, 0xA5, 0xCD, 0x26, 0x94, 0x83, 0xC5, 0xFE, 0x02, 0xC6, 0x8B, 0x45, 0xC5,
+    0x85, 0xF6, 0x82, 0xC5, 0xFE, 0x00, 0xE5, 0xDD, 0xEE, 0x4A, 0x29, 0xEE, 0x4A, 0x29, 0x00, 0x86,
+    0x7B, 0x86, 0xC5, 0xFE, 0x01, 0x65, 0xEE, 0x65, 0xEE, 0x86, 0xC5, 0xFE, 0x00, 0x86, 0x7B, 0xBD,
+    0x4A, 0x29, 0x00, 0x86, 0x7B, 0x86, 0xC5, 0xFE, 0x01, 0x65, 0xEE, 0x65, 0xEE, 0x86, 0xC5, 0xFE,
+    0x00, 0x86, 0x7B, 0xEE, 0x4A, 0x29, 0xEE, 0x4A, 0x29, 0x01, 0x89, 0x31, 0x65, 0xEE, 0x8D, 0xC5,
+    0xFE, 0x01, 0x85, 0xF6, 0xA9, 0x31, 0xBD, 0x4A, 0x29, 0x01, 0x89, 0x31, 0x65, 0xEE, 0x8D, 0xC5,
+    0xFE, 0x01, 0x85, 0xF6, 0xA9, 0x31, 0xEE, 0x4A, 0x29, 0xEF, 0x4A, 0x29, 0x00, 0x45, 0x9C, 0x8D,
+    0xC5, 0xFE, 0x00, 0x45, 0x9C, 0xBF, 0x4A, 0x29, 0x00, 0x45, 0x9C, 0x8D, 0xC5, 0xFE, 0x00, 0x45,
+    0x9C, 0xEF, 0x4A, 0x29, 0xEF, 0x4A, 0x29, 0x01, 0x08, 0x42, 0xA5, 0xFE, 0x8C, 0xC5, 0xFE, 0x00,
+    0x08, 0x42, 0xBF, 0x4A, 0x29, 0x01, 0x08, 0x42, 0xA5, 0xFE, 0x8C, 0xC5, 0xFE, 0x00, 0x08, 0x42,
+    0xEF, 0x4A, 0x29, 0xF0, 0x4A, 0x29, 0x00, 0x25, 0xBD, 0x8B, 0xC5, 0xFE, 0x00, 0x25, 0xBD, 0xC1,
+    0x4A, 0x29, 0x00, 0x25, 0xBD, 0x8B, 0xC5, 0xFE, 0x00, 0x25, 0xBD, 0xF0, 0x4A, 0x29, 0xF0, 0x4A,
+    0x29, 0x00, 0xC7, 0x62, 0x8B, 0xC5, 0xFE, 0x00, 0xC7, 0x62, 0xC1, 0x4A, 0x29, 0x00, 0xC7, 0x62,
+    0x8B, 0xC5, 0xFE, 0x00, 0xC7, 0x62, 0xF0, 0x4A, 0x29, 0xCB, 0x4A, 0x29, 0x07, 0x49, 0x29, 0xE6,
+    0x18, 0xA3, 0x10, 0xC2, 0x08, 0xC3, 0x10, 0xC4, 0x10, 0x07, 0x21, 0x49, 0x29, 0x9D, 0x4A, 0x29,
+    0x00, 0xE5, 0xDD, 0x89, 0xC5, 0xFE, 0x01, 0xE5, 0xDD, 0x69, 0x29, 0x9D, 0x4A, 0x29, 0x06, 0x28,
+    0x21, 0xC5, 0x18, 0x83, 0x18, 0x62, 0x10, 0x83, 0x18, 0xC5, 0x18, 0x28, 0x21, 0x9D, 0x4A, 0x29,
+    0x00, 0xE5, 0xDD, 0x89, 0xC5, 0xFE, 0x01, 0xE5, 0xDD, 0x69, 0x29, 0x9E, 0x4A, 0x29, 0x06, 0x07,
+    0x21, 0xC4, 0x10, 0xC3, 0x10, 0xC2, 0x08, 0xC3, 0x10, 0xC6, 0x18, 0x49, 0x29, 0xCA, 0x4A, 0x29,
+    0xCA, 0x4A, 0x29, 0x09, 0xE6, 0x18, 0x61, 0x00, 0x21, 0x01, 0xA2, 0x03, 0x83, 0x04, 0x63, 0x04,
+    0xC2, 0x02, 0x81, 0x00, 0xA2, 0x08, 0x28, 0x21, 0x9C, 0x4A, 0x29, 0x00, 0xA6, 0x83, 0x89, 0xC5,
+    0xFE, 0x00, 0x86, 0x7B, 0x9C, 0x4A, 0x29, 0x0A, 0x49, 0x29, 0xA4, 0x18, 0x00, 0x08, 0x21, 0x38,
+    0x01, 0x78, 0x01, 0x90, 0x01, 0x78, 0x21, 0x40, 0x00, 0x08, 0xA4, 0x18, 0x49, 0x29, 0x9B, 0x4A,
+    0x29, 0x00, 0xA6, 0x83, 0x89, 0xC5, 0xFE, 0x00, 0x86, 0x7B, 0x9D, 0x4A, 0x29, 0x09, 0x28, 0x21,
+    0xA2, 0x08, 0x80, 0x00, 0xA2, 0x02, 0x43, 0x04, 0xA3, 0x04, 0xA2, 0x03, 0x41, 0x01, 0x61, 0x00,
+    0xE6, 0x18, 0xC9, 0x4A, 0x29, 0xC9, 0x4A, 0x29, 0x02, 0xC5, 0x18, 0x80, 0x00, 0x03, 0x05, 0x84,
+    0xE5, 0x07, 0x03, 0x85, 0x07, 0xE2, 0x02, 0x61, 0x08, 0x28, 0x21, 0x9B, 0x4A, 0x29, 0x01, 0x89,
+    0x31, 0x65, 0xEE, 0x87, 0xC5, 0xFE, 0x01, 0x85, 0xF6, 0xA9, 0x31, 0x9B, 0x4A, 0x29, 0x03, 0x49,
+    0x29, 0x83, 0x10, 0x21, 0x20, 0x02, 0xC8, 0x84, 0x03, 0xF8, 0x03, 0x02, 0xD0, 0x21, 0x28, 0x82,
+    0x10, 0x49, 0x29, 0x9A, 0x4A, 0x29, 0x01, 0x89, 0x31, 0x65, 0xEE, 0x87, 0xC5, 0xFE, 0x01, 0x85,
+    0xF6, 0xA9, 0x31, 0x9C, 0x4A, 0x29, 0x03, 0x28, 0x21, 0x81, 0x08, 0x81, 0x02, 0x65, 0x07, 0x84,
+    0xE5, 0x07, 0x02, 0x43, 0x05, 0x81, 0x00, 0xC5, 0x18, 0xC8, 0x4A, 0x29, 0xC8, 0x4A, 0x29, 0x02,
+    0x08, 0x21, 0x40, 0x00, 0xE4, 0x05, 0x87, 0xE5, 0x07, 0x02, 0x02, 0x03, 0xA2, 0x08, 0x49, 0x29,
+    0x9B, 0x4A, 0x29, 0x00, 0x65, 0x9C, 0x87, 0xC5, 0xFE, 0x00, 0x65, 0x9C, 0x9C, 0x4A, 0x29, 0x02,
+    0xC5, 0x18, 0x21, 0x18, 0x02, 0xE0, 0x86, 0x03, 0xF8, 0x02, 0x02, 0xE8, 0x21, 0x20, 0xC5, 0x18,
+    0x9B, 0x4A, 0x29, 0x00, 0x65, 0x9C, 0x87, 0xC5, 0xFE, 0x00, 0x65, 0x9C, 0x9D, 0x4A, 0x29, 0x01,
+    0xA2, 0x08, 0xA2, 0x02, 0x87, 0xE5, 0x07, 0x02, 0x24, 0x06, 0x40, 0x00, 0x07, 0x21, 0xC7, 0x4A,
+    0x29, 0xC8, 0x4A, 0x29, 0x01, 0xC3, 0x10, 0xE2, 0x02, 0x88, 0xE5, 0x07, 0x02, 0x85, 0x07, 0x81,
+    0x00, 0x07, 0x21, 0x9B, 0x4A, 0x29, 0x01, 0x08, 0x42, 0xA5, 0xFE, 0x86, 0xC5, 0xFE, 0x00, 0x28,
+    0x42, 0x9B, 0x4A, 0x29, 0x02, 0x49, 0x29, 0x41, 0x08, 0x02, 0xA0, 0x88, 0x03, 0xF8, 0x02, 0x02,
+    0xB0, 0x21, 0x08, 0x49, 0x29, 0x9A, 0x4A, 0x29, 0x01, 0x08, 0x42, 0xA5, 0xFE, 0x86, 0xC5, 0xFE,
+    0x00, 0x28, 0x42, 0x9C, 0x4A, 0x29, 0x02, 0x07, 0x21, 0x60, 0x00, 0x45, 0x07, 0x88, 0xE5, 0x07,
+    0x01, 0x42, 0x03, 0xC3, 0x10, 0xC7, 0x4A, 0x29, 0xC7, 0x4A, 0x29, 0x02, 0x49, 0x29, 0x61, 0x00,
+    0xC4, 0x05, 0x89, 0xE5, 0x07, 0x01, 0xC2, 0x02, 0xC4, 0x10, 0x9C, 0x4A, 0x29, 0x00, 0x25, 0xBD,
+    0x85, 0xC5, 0xFE, 0x00, 0x25, 0xBD, 0x9C, 0x4A, 0x29, 0x02, 0x07, 0x21, 0x20, 0x10, 0x03, 0xF0,
+    0x89, 0x03, 0xF8, 0x01, 0x21, 0x10, 0x07, 0x21, 0x9B, 0x4A, 0x29, 0x00, 0x25, 0xBD, 0x85, 0xC5,
+    0xFE, 0x00, 0x25, 0xBD, 0x9D, 0x4A, 0x29, 0x01, 0xC5, 0x18, 0x61, 0x02, 0x89, 0xE5, 0x07, 0x02,
+    0x24, 0x06, 0x40, 0x00, 0x49, 0x29, 0xC6, 0x4A, 0x29, 0xC7, 0x4A, 0x29, 0x02, 0x29, 0x29, 0x00,
+    0x00, 0x25, 0x07, 0x89, 0xE5, 0x07, 0x01, 0x23, 0x04, 0xC3, 0x10, 0x9C, 0x4A, 0x29, 0x00, 0xE7,
+    0x62, 0x85, 0xC5, 0xFE, 0x00, 0xE7, 0x62, 0x9C, 0x4A, 0x29, 0x01, 0xE6, 0x18, 0x21, 0x28, 0x8A,
+    0x03, 0xF8, 0x01, 0x21, 0x30, 0xE6, 0x18, 0x9B, 0x4A, 0x29, 0x00, 0xE7, 0x62, 0x85, 0xC5, 0xFE,
+    0x00, 0xE7, 0x62, 0x9D, 0x4A, 0x29, 0x01, 0xC3, 0x10, 0xC2, 0x03, 0x89, 0xE5, 0x07, 0x02, 0xA5,
+    0x07, 0x00, 0x00, 0x28, 0x21, 0xC6, 0x4A, 0x29, 0xC7, 0x4A, 0x29, 0x02, 0x28, 0x21, 0x00, 0x00,
+    0x65, 0x07, 0x89, 0xE5, 0x07, 0x01, 0x83, 0x04, 0xC2, 0x08, 0x9D, 0x4A, 0x29, 0x00, 0xE5, 0xDD,
+    0x83, 0xC5, 0xFE, 0x01, 0x05, 0xDE, 0x69, 0x29, 0x9C, 0x4A, 0x29, 0x01, 0xE6, 0x18, 0x21, 0x30,
+    0x8A, 0x03, 0xF8, 0x01, 0x21, 0x38, 0xC5, 0x18, 0x9C, 0x4A, 0x29, 0x00, 0xE5, 0xDD, 0x83, 0xC5,
+    0xFE, 0x01, 0x05, 0xDE, 0x69, 0x29, 0x9D, 0x4A, 0x29, 0x01, 0xC3, 0x10, 0x02, 0x04, 0x8A, 0xE5,
+    0x07, 0x01, 0x00, 0x00, 0x28, 0x21, 0xC6, 0x4A, 0x29, 0xC7, 0x4A, 0x29, 0x02, 0x49, 0x29, 0x20,
+    0x00, 0x84, 0x06, 0x89, 0xE5, 0x07, 0x01, 0xA2, 0x03, 0xC3, 0x10, 0x9D, 0x4A, 0x29, 0x00, 0xA6,
+    0x83, 0x83, 0xC5, 0xFE, 0x00, 0xA6, 0x83, 0x9D, 0x4A, 0x29, 0x01, 0xE7, 0x20, 0x21, 0x18, 0x8A,
+    0x03, 0xF8, 0x01, 0x21, 0x20, 0xE6, 0x18, 0x9C, 0x4A, 0x29, 0x00, 0xA6, 0x83, 0x83, 0xC5, 0xFE,
+    0x00, 0xA6, 0x83, 0x9E, 0x4A, 0x29, 0x01, 0xA4, 0x10, 0x22, 0x03, 0x89, 0xE5, 0x07, 0x02, 0xE4,
+    0x06, 0x00, 0x00, 0x49, 0x29, 0xC6, 0x4A, 0x29, 0xC8, 0x4A, 0x29, 0x01, 0xA2, 0x08, 0x22, 0x04,
+    0x89, 0xE5, 0x07, 0x01, 0x41, 0x01, 0xE6, 0x18, 0x9D, 0x4A, 0x29, 0x05, 0x89, 0x31, 0x65, 0xEE,
+    0xC5, 0xFE, 0xC5, 0xFE, 0x85, 0xF6, 0xA9, 0x31, 0x9D, 0x4A, 0x29, 0x02, 0x49, 0x29, 0x00, 0x08,
+    0x02, 0xC8, 0x88, 0x03, 0xF8, 0x02, 0x02, 0xD8, 0x00, 0x00, 0x28, 0x21, 0x9C, 0x4A, 0x29, 0x05,
+    0x89, 0x31, 0x65, 0xEE, 0xC5, 0xFE, 0xC5, 0xFE, 0x85, 0xF6, 0xA9, 0x31, 0x9E, 0x4A, 0x29, 0x01,
+    0xE6, 0x18, 0xE1, 0x00, 0x89, 0xE5, 0x07, 0x01, 0xA3, 0x04, 0xA2, 0x08, 0xC7, 0x4A, 0x29, 0xC8,
+    0x4A, 0x29, 0x02, 0xE6, 0x18, 0xC1, 0x00, 0x65, 0x07, 0x87, 0xE5, 0x07, 0x02, 0x23, 0x05, 0x61,
+    0x00, 0x49, 0x29, 0x9E, 0x4A, 0x29, 0x03, 0x65, 0xA4, 0xC5, 0xFE, 0xC5, 0xFE, 0x65, 0x9C, 0x9F,
+    0x4A, 0x29, 0x01, 0x83, 0x10, 0x01, 0x48, 0x88, 0x03, 0xF8, 0x01, 0x01, 0x50, 0x83, 0x10, 0x9E,
+    0x4A, 0x29, 0x03, 0x65, 0xA4, 0xC5, 0xFE, 0xC5, 0xFE, 0x65, 0x9C, 0x9F, 0x4A, 0x29, 0x02, 0x49,
+    0x29, 0x81, 0x08, 0xC3, 0x04, 0x87, 0xE5, 0x07, 0x02, 0xA5, 0x07, 0xE1, 0x00, 0xE6, 0x18, 0xC7,
+    0x4A, 0x29, 0xC8, 0x4A, 0x29, 0x03, 0x49, 0x29, 0xA2, 0x10, 0xC1, 0x01, 0x65, 0x07, 0x85, 0xE5,
+    0x07, 0x02, 0xE4, 0x05, 0x80, 0x00, 0xE6, 0x18, 0x9F, 0x4A, 0x29, 0x03, 0x08, 0x42, 0xA5, 0xFE,
+    0xC5, 0xFE, 0x28, 0x4A, 0x9F, 0x4A, 0x29, 0x02, 0x28, 0x21, 0x41, 0x08, 0x01, 0x70, 0x86, 0x03,
+    0xF8, 0x02, 0x01, 0x78, 0x21, 0x08, 0x28, 0x21, 0x9E, 0x4A, 0x29, 0x03, 0x08, 0x42, 0xA5, 0xFE,
+    0xC5, 0xFE, 0x28, 0x4A, 0xA0, 0x4A, 0x29, 0x02, 0xE6, 0x18, 0x60, 0x00, 0xA3, 0x05, 0x85, 0xE5,
+    0x07, 0x03, 0x85, 0x07, 0x01, 0x02, 0xA2, 0x08, 0x49, 0x29, 0xC7, 0x4A, 0x29, 0xC9, 0x4A, 0x29,
+    0x0A, 0x49, 0x29, 0xA3, 0x10, 0xC1, 0x00, 0x22, 0x04, 0xA4, 0x06, 0xC5, 0x07, 0x65, 0x07, 0xE4,
+    0x05, 0xC2, 0x02, 0x40, 0x00, 0xC5, 0x18, 0xA1, 0x4A, 0x29, 0x01, 0x45, 0xBD, 0x25, 0xBD, 0xA1,
+    0x4A, 0x29, 0x0A, 0x07, 0x21, 0x41, 0x10, 0x21, 0x28, 0x01, 0x98, 0x02, 0xD8, 0x03, 0xF0, 0x02,
+    0xD8, 0x02, 0xA0, 0x21, 0x30, 0x41, 0x10, 0x07, 0x21, 0xA0, 0x4A, 0x29, 0x01, 0x45, 0xBD, 0x25,
+    0xBD, 0xA2, 0x4A, 0x29, 0x0A, 0xE6, 0x18, 0x40, 0x00, 0xA2, 0x02, 0xC4, 0x05, 0x65, 0x07, 0xC5,
+    0x07, 0xA4, 0x06, 0x43, 0x04, 0xC1, 0x00, 0xA2, 0x08, 0x29, 0x29, 0xC8, 0x4A, 0x29, 0xCA, 0x4A,
+    0x29, 0x08, 0x49, 0x29, 0xE6, 0x18, 0xA2, 0x08, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x00,
+    0xC3, 0x10, 0x08, 0x21, 0xA2, 0x4A, 0x29, 0x01, 0xE7, 0x62, 0xE7, 0x62, 0xA2, 0x4A, 0x29, 0x02,
+    0x49, 0x29, 0xC5, 0x18, 0x41, 0x10, 0x82, 0x00, 0x00, 0x02, 0x41, 0x10, 0xC5, 0x18, 0x29, 0x29,
+    0xA1, 0x4A, 0x29, 0x01, 0xE7, 0x62, 0xE7, 0x62, 0xA3, 0x4A, 0x29, 0x08, 0x28, 0x21, 0xC3, 0x10,
+    0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xA2, 0x08, 0xE6, 0x18, 0x49, 0x29, 0xC9, 0x4A,
+    0x29, 0xCD, 0x4A, 0x29, 0x03, 0x49, 0x29, 0x28, 0x21, 0x28, 0x21, 0x49, 0x29, 0xA4, 0x4A, 0x29,
+    0x01, 0x69, 0x29, 0x69, 0x29, 0xA5, 0x4A, 0x29, 0x02, 0x29, 0x21, 0x28, 0x21, 0x29, 0x21, 0xA4,
+    0x4A, 0x29, 0x01, 0x69, 0x29, 0x69, 0x29, 0xA5, 0x4A, 0x29, 0x03, 0x49, 0x29, 0x28, 0x21, 0x28,
+    0x21, 0x49, 0x29, 0xCC, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xBF, 0x4A, 0x29, 0xFF,
+    0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xBF, 0x4A, 0x29, 0x9F, 0x4A, 0x29, 0x04, 0x49, 0x29, 0x07, 0x21,
+    0xE6, 0x18, 0xA4, 0x10, 0xA4, 0x10, 0x82, 0xA3, 0x10, 0x04, 0xA4, 0x10, 0xA4, 0x10, 0xC5, 0x18,
+    0xE7, 0x20, 0x28, 0x21, 0xC3, 0x4A, 0x29, 0x04, 0x29, 0x21, 0x07, 0x21, 0xC6, 0x18, 0xA4, 0x10,
+    0xA4, 0x10, 0x82, 0xA3, 0x10, 0x04, 0xA4, 0x10, 0xA4, 0x10, 0xC5, 0x18, 0x07, 0x21, 0x28, 0x21,
+    0xC3, 0x4A, 0x29, 0x04, 0x28, 0x21, 0x07, 0x21, 0xC5, 0x18, 0xA4, 0x10, 0xA4, 0x10, 0x82, 0xA3,
+    0x10, 0x04, 0xA4, 0x10, 0xA4, 0x10, 0xC6, 0x18, 0x07, 0x21, 0x29, 0x21, 0xC3, 0x4A, 0x29, 0x04,
+    0x28, 0x21, 0xE7, 0x20, 0xC5, 0x18, 0xA4, 0x10, 0xA4, 0x10, 0x82, 0xA3, 0x10, 0x04, 0xA4, 0x10,
+    0xA4, 0x10, 0xE6, 0x18, 0x07, 0x21, 0x49, 0x29, 0x9F, 0x4A, 0x29, 0x9C, 0x4A, 0x29, 0x13, 0x07,
+    0x21, 0xC4, 0x18, 0x82, 0x10, 0x00, 0x00, 0x82, 0x10, 0x04, 0x21, 0xC7, 0x41, 0x49, 0x52, 0x8A,
+    0x5A, 0xAA, 0x5A, 0x8A, 0x5A, 0x49, 0x52, 0x08, 0x42, 0x45, 0x29, 0x82, 0x10, 0x00, 0x00, 0x82,
+    0x10, 0xA4, 0x10, 0x07, 0x21, 0x49, 0x29, 0xBB, 0x4A, 0x29, 0x14, 0x49, 0x29, 0x07, 0x21, 0xA4,
+    0x10, 0x82, 0x10, 0x00, 0x00, 0x82, 0x10, 0x24, 0x21, 0xE7, 0x41, 0x49, 0x52, 0x8A, 0x5A, 0xAA,
+    0x5A, 0x8A, 0x5A, 0x49, 0x52, 0xE7, 0x41, 0x24, 0x29, 0x82, 0x10, 0x00, 0x00, 0x82, 0x10, 0xA4,
+    0x10, 0x07, 0x21, 0x49, 0x29, 0xBB, 0x4A, 0x29, 0x14, 0x49, 0x29, 0x07, 0x21, 0xA4, 0x10, 0x82,
+    0x10, 0x00, 0x00, 0x82, 0x10, 0x25, 0x29, 0xE7, 0x41, 0x49, 0x52, 0x8A, 0x5A, 0xAA, 0x5A, 0x8A,
+    0x5A, 0x49, 0x52, 0xE7, 0x41, 0x24, 0x21, 0x82, 0x10, 0x00, 0x00, 0x82, 0x10, 0xA4, 0x10, 0x07,
+    0x21, 0x49, 0x29, 0xBB, 0x4A, 0x29, 0x13, 0x49, 0x29, 0xE7, 0x20, 0xA4, 0x10, 0x82, 0x10, 0x00,
+    0x00, 0x82, 0x10, 0x45, 0x29, 0x08, 0x42, 0x49, 0x52, 0x8A, 0x5A, 0xAA, 0x5A, 0x8A, 0x5A, 0x49,
+    0x52, 0xC7, 0x41, 0x04, 0x21, 0x82, 0x10, 0x00, 0x00, 0x82, 0x10, 0xC5, 0x18, 0x07, 0x21, 0x9C,
+    0x4A, 0x29, 0x99, 0x4A, 0x29, 0x06, 0x49, 0x29, 0xC5, 0x18, 0x82, 0x10, 0x41, 0x08, 0x86, 0x31,
+    0xEB, 0x62, 0x10, 0x94, 0x8A, 0xF3, 0xAC, 0x06, 0x71, 0x9C, 0x2C, 0x6B, 0xE7, 0x41, 0x82, 0x10,
+    0x62, 0x08, 0xC4, 0x18, 0x28, 0x21, 0xB7, 0x4A, 0x29, 0x06, 0x49, 0x29, 0xC5, 0x18, 0x82, 0x10,
+    0x61, 0x08, 0xA6, 0x39, 0x0C, 0x6B, 0x30, 0x94, 0x8A, 0xF3, 0xAC, 0x06, 0x51, 0x9C, 0x0C, 0x6B,
+    0xC7, 0x39, 0x61, 0x08, 0x62, 0x08, 0xC5, 0x18, 0x29, 0x29, 0xB7, 0x4A, 0x29, 0x06, 0x29, 0x21,
+    0xC5, 0x18, 0x62, 0x08, 0x61, 0x08, 0xC7, 0x39, 0x0C, 0x6B, 0x51, 0x9C, 0x8A, 0xF3, 0xAC, 0x06,
+    0x30, 0x94, 0xEB, 0x6A, 0xA6, 0x39, 0x61, 0x08, 0x82, 0x10, 0xC5, 0x18, 0x49, 0x29, 0xB7, 0x4A,
+    0x29, 0x06, 0x28, 0x21, 0xC4, 0x18, 0x62, 0x08, 0x82, 0x10, 0xE7, 0x41, 0x2C, 0x73, 0x71, 0x9C,
+    0x8A, 0xF3, 0xAC, 0x06, 0x10, 0x94, 0xEB, 0x62, 0x86, 0x31, 0x41, 0x08, 0x82, 0x10, 0xC5, 0x18,
+    0x49, 0x29, 0x99, 0x4A, 0x29, 0x97, 0x4A, 0x29, 0x05, 0x49, 0x29, 0xC5, 0x18, 0x61, 0x08, 0xC3,
+    0x18, 0xEB, 0x62, 0x92, 0xA4, 0x90, 0xF3, 0xAC, 0x05, 0xD3, 0xAC, 0x4D, 0x73, 0x45, 0x29, 0x41,
+    0x08, 0xA4, 0x18, 0x28, 0x21, 0xB3, 0x4A, 0x29, 0x05, 0x49, 0x29, 0xC5, 0x18, 0x61, 0x08, 0xE4,
+    0x20, 0x0C, 0x6B, 0xB2, 0xA4, 0x90, 0xF3, 0xAC, 0x05, 0xB2, 0xA4, 0x0C, 0x6B, 0x04, 0x21, 0x41,
+    0x08, 0xC4, 0x18, 0x29, 0x29, 0xB3, 0x4A, 0x29, 0x05, 0x29, 0x21, 0xC4, 0x18, 0x41, 0x08, 0x24,
+    0x21, 0x2C, 0x6B, 0xB2, 0xA4, 0x90, 0xF3, 0xAC, 0x05, 0x92, 0xA4, 0x0C, 0x6B, 0xE3, 0x20, 0x61,
+    0x08, 0xC5, 0x18, 0x49, 0x29, 0xB3, 0x4A, 0x29, 0x05, 0x28, 0x21, 0xA4, 0x10, 0x41, 0x08, 0x45,
+    0x29, 0x4D, 0x73, 0xD3, 0xAC, 0x90, 0xF3, 0xAC, 0x05, 0x92, 0xA4, 0xCB, 0x62, 0xC3, 0x18, 0x61,
+    0x08, 0xC5, 0x18, 0x49, 0x29, 0x97, 0x4A, 0x29, 0x96, 0x4A, 0x29, 0x03, 0xE6, 0x20, 0x62, 0x10,
+    0xE3, 0x18, 0x4D, 0x73, 0x86, 0xF3, 0xAC, 0x09, 0x51, 0x9C, 0x8E, 0x7B, 0x0C, 0x6B, 0xCB, 0x62,
+    0xAA, 0x5A, 0xAA, 0x5A, 0xEB, 0x6A, 0x6D, 0x7B, 0x30, 0x94, 0xD3, 0xAC, 0x85, 0xF3, 0xAC, 0x04,
+    0xCF, 0x83, 0x65, 0x29, 0x61, 0x08, 0xC5, 0x18, 0x49, 0x29, 0xB0, 0x4A, 0x29, 0x03, 0xE6, 0x18,
+    0x62, 0x08, 0x04, 0x21, 0x6D, 0x7B, 0x85, 0xF3, 0xAC, 0x0A, 0xD3, 0xAC, 0x51, 0x94, 0x8E, 0x7B,
+    0x0C, 0x6B, 0xCB, 0x62, 0xAA, 0x5A, 0xCB, 0x62, 0xEB, 0x6A, 0x8E, 0x7B, 0x30, 0x94, 0xD3, 0xAC,
+    0x85, 0xF3, 0xAC, 0x04, 0x8E, 0x7B, 0x24, 0x29, 0x61, 0x08, 0xE6, 0x18, 0x49, 0x29, 0xAF, 0x4A,
+    0x29, 0x04, 0x49, 0x29, 0xE6, 0x18, 0x61, 0x08, 0x25, 0x29, 0xAE, 0x83, 0x85, 0xF3, 0xAC, 0x09,
+    0xD3, 0xAC, 0x30, 0x94, 0x6D, 0x7B, 0xEB, 0x6A, 0xCB, 0x62, 0xAA, 0x5A, 0xCB, 0x62, 0x0C, 0x6B,
+    0x8E, 0x7B, 0x51, 0x94, 0x86, 0xF3, 0xAC, 0x03, 0x6D, 0x7B, 0x04, 0x21, 0x62, 0x08, 0xE6, 0x18,
+    0xB0, 0x4A, 0x29, 0x04, 0x49, 0x29, 0xC5, 0x18, 0x41, 0x08, 0x65, 0x31, 0xCF, 0x83, 0x85, 0xF3,
+    0xAC, 0x09, 0xD3, 0xAC, 0x30, 0x94, 0x6D, 0x73, 0xEB, 0x6A, 0xAA, 0x5A, 0xAA, 0x5A, 0xCB, 0x62,
+    0x0C, 0x6B, 0x8E, 0x7B, 0x51, 0x9C, 0x85, 0xF3, 0xAC, 0x04, 0xD3, 0xAC, 0x2C, 0x73, 0xC3, 0x18,
+    0x82, 0x10, 0xE7, 0x20, 0x96, 0x4A, 0x29, 0x94, 0x4A, 0x29, 0x04, 0x49, 0x29, 0xA4, 0x10, 0x61,
+    0x08, 0xAA, 0x5A, 0xD3, 0xAC, 0x83, 0xF3, 0xAC, 0x10, 0x92, 0xA4, 0xEB, 0x62, 0x86, 0x39, 0x82,
+    0x10, 0x00, 0x00, 0x41, 0x10, 0x61, 0x28, 0x61, 0x38, 0x61, 0x40, 0x61, 0x38, 0x61, 0x30, 0x61,
+    0x18, 0x00, 0x00, 0x41, 0x08, 0x45, 0x31, 0x8A, 0x5A, 0x30, 0x94, 0x84, 0xF3, 0xAC, 0x03, 0x4D,
+    0x73, 0xA2, 0x10, 0x82, 0x10, 0x28, 0x21, 0xAD, 0x4A, 0x29, 0x03, 0x49, 0x29, 0xA3, 0x10, 0x82,
+    0x10, 0xEB, 0x62, 0x84, 0xF3, 0xAC, 0x05, 0x71, 0x9C, 0xCB, 0x62, 0x65, 0x31, 0x61, 0x08, 0x00,
+    0x00, 0x41, 0x08, 0x85, 0x61, 0x08, 0x04, 0x00, 0x00, 0x61, 0x08, 0x65, 0x31, 0xAA, 0x5A, 0x51,
+    0x9C, 0x84, 0xF3, 0xAC, 0x03, 0x0C, 0x6B, 0x82, 0x10, 0x83, 0x10, 0x28, 0x21, 0xAD, 0x4A, 0x29,
+    0x03, 0x28, 0x21, 0x83, 0x10, 0x82, 0x10, 0x2C, 0x6B, 0x84, 0xF3, 0xAC, 0x10, 0x51, 0x9C, 0xAA,
+    0x5A, 0x65, 0x31, 0x61, 0x10, 0x00, 0x00, 0x61, 0x18, 0x61, 0x30, 0x61, 0x38, 0x61, 0x40, 0x61,
+    0x38, 0x61, 0x30, 0x41, 0x10, 0x00, 0x00, 0x61, 0x10, 0x65, 0x39, 0xCB, 0x62, 0x71, 0x9C, 0x83,
+    0xF3, 0xAC, 0x04, 0xD3, 0xAC, 0xEB, 0x62, 0x62, 0x10, 0xA3, 0x10, 0x49, 0x29, 0xAD, 0x4A, 0x29,
+    0x03, 0x28, 0x21, 0x82, 0x10, 0xA2, 0x10, 0x4D, 0x73, 0x84, 0xF3, 0xAC, 0x04, 0x30, 0x94, 0x8A,
+    0x5A, 0x45, 0x29, 0x41, 0x08, 0x00, 0x00, 0x85, 0x61, 0x08, 0x05, 0x41, 0x08, 0x00, 0x00, 0x82,
+    0x10, 0x86, 0x31, 0xEB, 0x62, 0x92, 0xA4, 0x83, 0xF3, 0xAC, 0x04, 0xD3, 0xAC, 0xAA, 0x5A, 0x61,
+    0x08, 0xA4, 0x10, 0x49, 0x29, 0x94, 0x4A, 0x29, 0x93, 0x4A, 0x29, 0x03, 0x08, 0x21, 0x82, 0x10,
+    0x04, 0x21, 0x30, 0x94, 0x83, 0xF3, 0xAC, 0x06, 0xCF, 0x83, 0x86, 0x39, 0x41, 0x08, 0x61, 0x20,
+    0x01, 0x68, 0x02, 0xA8, 0x02, 0xE0, 0x86, 0x03, 0xF8, 0x06, 0x02, 0xE8, 0x02, 0xB8, 0x01, 0x78,
+    0x61, 0x30, 0x00, 0x00, 0x24, 0x29, 0x4D, 0x73, 0x83, 0xF3, 0xAC, 0x03, 0xB2, 0xA4, 0xA6, 0x39,
+    0x61, 0x08, 0xE6, 0x20, 0xAB, 0x4A, 0x29, 0x03, 0x07, 0x21, 0x62, 0x08, 0x45, 0x29, 0x71, 0x9C,
+    0x83, 0xF3, 0xAC, 0x03, 0x8E, 0x7B, 0x65, 0x31, 0x20, 0x00, 0x61, 0x08, 0x8C, 0x00, 0x00, 0x03,
+    0x61, 0x08, 0x20, 0x00, 0x45, 0x29, 0x6D, 0x7B, 0x83, 0xF3, 0xAC, 0x03, 0x92, 0xA4, 0x65, 0x31,
+    0x62, 0x08, 0x07, 0x21, 0xAB, 0x4A, 0x29, 0x03, 0x07, 0x21, 0x61, 0x08, 0x86, 0x31, 0x92, 0xA4,
+    0x83, 0xF3, 0xAC, 0x06, 0x6D, 0x7B, 0x45, 0x31, 0x20, 0x08, 0x61, 0x30, 0x01, 0x78, 0x02, 0xB8,
+    0x02, 0xE8, 0x86, 0x03, 0xF8, 0x06, 0x02, 0xE0, 0x02, 0xB0, 0x01, 0x70, 0x61, 0x28, 0x20, 0x08,
+    0x65, 0x31, 0xAE, 0x83, 0x83, 0xF3, 0xAC, 0x03, 0x71, 0x9C, 0x45, 0x29, 0x82, 0x10, 0x07, 0x21,
+    0xAB, 0x4A, 0x29, 0x03, 0xE6, 0x18, 0x61, 0x08, 0xC7, 0x39, 0xB2, 0xA4, 0x82, 0xF3, 0xAC, 0x04,
+    0xD3, 0xAC, 0x2C, 0x73, 0x24, 0x21, 0x00, 0x00, 0x61, 0x08, 0x8C, 0x00, 0x00, 0x03, 0x61, 0x08,
+    0x41, 0x08, 0x86, 0x31, 0xCF, 0x83, 0x83, 0xF3, 0xAC, 0x03, 0x30, 0x94, 0x04, 0x21, 0x82, 0x10,
+    0x08, 0x21, 0x93, 0x4A, 0x29, 0x92, 0x4A, 0x29, 0x03, 0x07, 0x21, 0x61, 0x08, 0x08, 0x4A, 0xD3,
+    0xAC, 0x82, 0xF3, 0xAC, 0x04, 0xEF, 0x8B, 0x45, 0x31, 0x20, 0x08, 0x21, 0x58, 0x02, 0xC0, 0x8E,
+    0x03, 0xF8, 0x04, 0x02, 0xD0, 0x01, 0x70, 0x41, 0x10, 0xC3, 0x20, 0x6D, 0x73, 0x83, 0xF3, 0xAC,
+    0x02, 0xEB, 0x62, 0x41, 0x08, 0xE6, 0x18, 0xA9, 0x4A, 0x29, 0x03, 0xE7, 0x20, 0x41, 0x08, 0x69,
+    0x52, 0xD3, 0xAC, 0x82, 0xF3, 0xAC, 0x03, 0xCF, 0x83, 0x04, 0x21, 0x41, 0x08, 0x41, 0x08, 0x90,
+    0x00, 0x00, 0x03, 0x20, 0x00, 0x41, 0x08, 0xE3, 0x20, 0xAE, 0x83, 0x83, 0xF3, 0xAC, 0x02, 0x8A,
+    0x5A, 0x41, 0x08, 0xE6, 0x18, 0xA9, 0x4A, 0x29, 0x02, 0xE6, 0x18, 0x41, 0x08, 0xAA, 0x5A, 0x83,
+    0xF3, 0xAC, 0x04, 0x8E, 0x7B, 0xE3, 0x20, 0x41, 0x10, 0x01, 0x68, 0x02, 0xD0, 0x8E, 0x03, 0xF8,
+    0x04, 0x02, 0xC8, 0x21, 0x60, 0x41, 0x08, 0x24, 0x29, 0xCF, 0x83, 0x82, 0xF3, 0xAC, 0x03, 0xD3,
+    0xAC, 0x49, 0x52, 0x41, 0x08, 0xE7, 0x20, 0xA9, 0x4A, 0x29, 0x02, 0xE5, 0x18, 0x41, 0x08, 0x0C,
+    0x6B, 0x83, 0xF3, 0xAC, 0x02, 0x4D, 0x73, 0xC3, 0x18, 0x41, 0x08, 0x91, 0x00, 0x00, 0x03, 0x41,
+    0x08, 0x20, 0x08, 0x45, 0x29, 0x10, 0x8C, 0x82, 0xF3, 0xAC, 0x03, 0xD3, 0xAC, 0x08, 0x42, 0x61,
+    0x08, 0x07, 0x21, 0x92, 0x4A, 0x29, 0x91, 0x4A, 0x29, 0x02, 0x07, 0x21, 0x41, 0x08, 0x8A, 0x5A,
+    0x82, 0xF3, 0xAC, 0x04, 0xB2, 0xAC, 0x28, 0x4A, 0x41, 0x08, 0x21, 0x58, 0x02, 0xD8, 0x92, 0x03,
+    0xF8, 0x04, 0x02, 0xE8, 0x01, 0x78, 0x41, 0x10, 0x65, 0x39, 0x71, 0x9C, 0x82, 0xF3, 0xAC, 0x02,
+    0x6D, 0x7B, 0x61, 0x08, 0xC5, 0x18, 0xA7, 0x4A, 0x29, 0x02, 0xE6, 0x18, 0x41, 0x08, 0xEB, 0x6A,
+    0x82, 0xF3, 0xAC, 0x03, 0xB2, 0xA4, 0xE7, 0x41, 0x20, 0x00, 0x41, 0x08, 0x94, 0x00, 0x00, 0x03,
+    0x20, 0x00, 0x41, 0x08, 0xA6, 0x39, 0x92, 0xA4, 0x82, 0xF3, 0xAC, 0x02, 0x2C, 0x73, 0x41, 0x08,
+    0xE6, 0x18, 0xA7, 0x4A, 0x29, 0x02, 0xE6, 0x18, 0x41, 0x08, 0x4D, 0x73, 0x82, 0xF3, 0xAC, 0x04,
+    0x92, 0xA4, 0xA6, 0x39, 0x41, 0x08, 0x01, 0x70, 0x02, 0xE8, 0x92, 0x03, 0xF8, 0x04, 0x02, 0xE0,
+    0x01, 0x60, 0x20, 0x08, 0xE7, 0x49, 0xB2, 0xA4, 0x82, 0xF3, 0xAC, 0x02, 0xEB, 0x62, 0x41, 0x08,
+    0xE6, 0x18, 0xA7, 0x4A, 0x29, 0x02, 0xC5, 0x18, 0x61, 0x08, 0x8E, 0x7B, 0x82, 0xF3, 0xAC, 0x03,
+    0x51, 0x9C, 0x65, 0x31, 0x41, 0x08, 0x20, 0x00, 0x94, 0x00, 0x00, 0x03, 0x41, 0x08, 0x41, 0x08,
+    0x28, 0x4A, 0xD3, 0xAC, 0x82, 0xF3, 0xAC, 0x02, 0x8A, 0x5A, 0x41, 0x08, 0x07, 0x21, 0x91, 0x4A,
+    0x29, 0x90, 0x4A, 0x29, 0x02, 0x07, 0x21, 0x41, 0x08, 0xEB, 0x62, 0x82, 0xF3, 0xAC, 0x03, 0x30,
+    0x94, 0xE3, 0x20, 0x41, 0x28, 0x02, 0xB8, 0x96, 0x03, 0xF8, 0x03, 0x02, 0xD8, 0x41, 0x40, 0x82,
+    0x10, 0x8E, 0x7B, 0x82, 0xF3, 0xAC, 0x02, 0xCF, 0x83, 0x61, 0x08, 0xE6, 0x18, 0xA5, 0x4A, 0x29,
+    0x02, 0x07, 0x21, 0x41, 0x08, 0x2C, 0x73, 0x82, 0xF3, 0xAC, 0x02, 0xEF, 0x8B, 0xC3, 0x18, 0x61,
+    0x08, 0x98, 0x00, 0x00, 0x02, 0x61, 0x08, 0xA2, 0x10, 0xCF, 0x83, 0x82, 0xF3, 0xAC, 0x02, 0x8E,
+    0x7B, 0x41, 0x08, 0xE6, 0x18, 0xA5, 0x4A, 0x29, 0x02, 0xE6, 0x18, 0x41, 0x08, 0x8E, 0x7B, 0x82,
+    0xF3, 0xAC, 0x03, 0xAE, 0x83, 0xA2, 0x18, 0x41, 0x38, 0x02, 0xD0, 0x96, 0x03, 0xF8, 0x03, 0x02,
+    0xC8, 0x41, 0x30, 0xC3, 0x20, 0xF0, 0x8B, 0x82, 0xF3, 0xAC, 0x02, 0x2C, 0x73, 0x41, 0x08, 0x07,
+    0x21, 0xA5, 0x4A, 0x29, 0x02, 0xE5, 0x18, 0x61, 0x08, 0xCF, 0x83, 0x82, 0xF3, 0xAC, 0x02, 0x8E,
+    0x7B, 0x82, 0x10, 0x41, 0x08, 0x98, 0x00, 0x00, 0x02, 0x61, 0x08, 0xE3, 0x20, 0x30, 0x94, 0x82,
+    0xF3, 0xAC, 0x02, 0xCB, 0x62, 0x41, 0x08, 0x07, 0x21, 0x90, 0x4A, 0x29, 0x8F, 0x4A, 0x29, 0x02,
+    0x28, 0x21, 0x61, 0x08, 0x8A, 0x52, 0x82, 0xF3, 0xAC, 0x03, 0xAE, 0x83, 0x61, 0x10, 0x21, 0x58,
+    0x03, 0xE8, 0x99, 0x03, 0xF8, 0x02, 0x01, 0x80, 0x41, 0x08, 0xEB, 0x62, 0x82, 0xF3, 0xAC, 0x02,
+    0x8E, 0x7B, 0x41, 0x08, 0xE6, 0x20, 0xA3, 0x4A, 0x29, 0x02, 0x08, 0x21, 0x41, 0x08, 0xEB, 0x62,
+    0x82, 0xF3, 0xAC, 0x02, 0x6D, 0x7B, 0x41, 0x08, 0x41, 0x08, 0x9A, 0x00, 0x00, 0x02, 0x20, 0x00,
+    0x41, 0x08, 0x2C, 0x73, 0x82, 0xF3, 0xAC, 0x02, 0x2C, 0x73, 0x41, 0x08, 0x07, 0x21, 0xA3, 0x4A,
+    0x29, 0x02, 0x07, 0x21, 0x41, 0x08, 0x2C, 0x73, 0x82, 0xF3, 0xAC, 0x03, 0x2C, 0x6B, 0x41, 0x08,
+    0x01, 0x70, 0x03, 0xF0, 0x98, 0x03, 0xF8, 0x03, 0x03, 0xF0, 0x21, 0x60, 0x61, 0x10, 0x8E, 0x7B,
+    0x82, 0xF3, 0xAC, 0x02, 0xCB, 0x62, 0x41, 0x08, 0x08, 0x21, 0xA3, 0x4A, 0x29, 0x02, 0xE6, 0x18,
+    0x41, 0x08, 0x8E, 0x7B, 0x82, 0xF3, 0xAC, 0x02, 0xCB, 0x62, 0x41, 0x08, 0x20, 0x00, 0x9A, 0x00,
+    0x00, 0x02, 0x41, 0x08, 0x61, 0x10, 0xCF, 0x83, 0x82, 0xF3, 0xAC, 0x02, 0x69, 0x52, 0x61, 0x08,
+    0x28, 0x21, 0x8F, 0x4A, 0x29, 0x8E, 0x4A, 0x29, 0x02, 0x49, 0x29, 0x82, 0x10, 0xE7, 0x41, 0x82,
+    0xF3, 0xAC, 0x02, 0x8E, 0x7B, 0x61, 0x08, 0x01, 0x78, 0x9C, 0x03, 0xF8, 0x02, 0x02, 0xA8, 0x41,
+    0x10, 0x8A, 0x5A, 0x82, 0xF3, 0xAC, 0x02, 0xEB, 0x6A, 0x61, 0x08, 0x28, 0x21, 0xA1, 0x4A, 0x29,
+    0x02, 0x49, 0x29, 0x82, 0x10, 0x29, 0x4A, 0x82, 0xF3, 0xAC, 0x02, 0x2C, 0x73, 0x41, 0x08, 0x20,
+    0x00, 0x9D, 0x00, 0x00, 0x01, 0x41, 0x08, 0xEB, 0x62, 0x82, 0xF3, 0xAC, 0x02, 0x8A, 0x5A, 0x62,
+    0x08, 0x29, 0x21, 0xA1, 0x4A, 0x29, 0x02, 0x28, 0x21, 0x62, 0x08, 0xAA, 0x5A, 0x82, 0xF3, 0xAC,
+    0x02, 0xEB, 0x62, 0x41, 0x08, 0x02, 0xA0, 0x9C, 0x03, 0xF8, 0x02, 0x01, 0x88, 0x41, 0x08, 0x2C,
+    0x73, 0x82, 0xF3, 0xAC, 0x02, 0x28, 0x4A, 0x82, 0x10, 0x49, 0x29, 0xA1, 0x4A, 0x29, 0x02, 0x28,
+    0x21, 0x61, 0x08, 0x0C, 0x6B, 0x82, 0xF3, 0xAC, 0x01, 0x8A, 0x5A, 0x41, 0x08, 0x9D, 0x00, 0x00,
+    0x02, 0x20, 0x00, 0x41, 0x08, 0x8E, 0x7B, 0x82, 0xF3, 0xAC, 0x02, 0xC7, 0x39, 0x82, 0x10, 0x49,
+    0x29, 0x8E, 0x4A, 0x29, 0x8E, 0x4A, 0x29, 0x07, 0xA4, 0x10, 0xE3, 0x18, 0xB2, 0xA4, 0xF3, 0xAC,
+    0xF3, 0xAC, 0xCF, 0x83, 0x61, 0x10, 0x01, 0x88, 0x9E, 0x03, 0xF8, 0x02, 0x02, 0xB8, 0x41, 0x10,
+    0xCB, 0x62, 0x82, 0xF3, 0xAC, 0x02, 0xC7, 0x39, 0x82, 0x10, 0x49, 0x29, 0xA0, 0x4A, 0x29, 0x06,
+    0xA4, 0x10, 0x24, 0x29, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x7B, 0x41, 0x08, 0xA0, 0x00,
+    0x00, 0x01, 0x41, 0x08, 0x2C, 0x73, 0x82, 0xF3, 0xAC, 0x02, 0x65, 0x31, 0xA3, 0x10, 0x49, 0x29,
+    0x9F, 0x4A, 0x29, 0x02, 0x49, 0x29, 0xA3, 0x10, 0x65, 0x31, 0x82, 0xF3, 0xAC, 0x02, 0x2C, 0x73,
+    0x41, 0x08, 0x02, 0xA8, 0x9E, 0x03, 0xF8, 0x07, 0x01, 0x98, 0x41, 0x08, 0x8E, 0x7B, 0xF3, 0xAC,
+    0xF3, 0xAC, 0xD3, 0xAC, 0x24, 0x21, 0xA4, 0x10, 0xA0, 0x4A, 0x29, 0x02, 0x49, 0x29, 0x82, 0x10,
+    0xC7, 0x41, 0x82, 0xF3, 0xAC, 0x01, 0xCB, 0x62, 0x41, 0x08, 0x9F, 0x00, 0x00, 0x07, 0x20, 0x00,
+    0x61, 0x08, 0xCF, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0xB2, 0xA4, 0xE3, 0x18, 0xC4, 0x18, 0x8E, 0x4A,
+    0x29, 0x8D, 0x4A, 0x29, 0x07, 0x07, 0x21, 0x41, 0x08, 0x10, 0x8C, 0xF3, 0xAC, 0xF3, 0xAC, 0x51,
+    0x9C, 0x82, 0x10, 0x01, 0x78, 0xA0, 0x03, 0xF8, 0x07, 0x02, 0xA8, 0x41, 0x08, 0x6D, 0x7B, 0xF3,
+    0xAC, 0xF3, 0xAC, 0xB2, 0xA4, 0xA3, 0x18, 0xC5, 0x18, 0x9F, 0x4A, 0x29, 0x07, 0xE6, 0x20, 0x61,
+    0x08, 0x51, 0x9C, 0xF3, 0xAC, 0xF3, 0xAC, 0x10, 0x8C, 0x61, 0x08, 0x20, 0x00, 0xA1, 0x00, 0x00,
+    0x06, 0x41, 0x08, 0xCF, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4, 0x82, 0x10, 0xE6, 0x18, 0x9F,
+    0x4A, 0x29, 0x07, 0xE6, 0x18, 0x82, 0x10, 0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xCF, 0x83, 0x41,
+    0x08, 0x02, 0x98, 0xA0, 0x03, 0xF8, 0x07, 0x01, 0x88, 0x61, 0x10, 0x10, 0x94, 0xF3, 0xAC, 0xF3,
+    0xAC, 0x51, 0x94, 0x61, 0x08, 0xE7, 0x20, 0x9F, 0x4A, 0x29, 0x06, 0xC5, 0x18, 0xC3, 0x18, 0xB2,
+    0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x7B, 0x41, 0x08, 0xA1, 0x00, 0x00, 0x07, 0x20, 0x00, 0x82,
+    0x10, 0x51, 0x9C, 0xF3, 0xAC, 0xF3, 0xAC, 0x10, 0x8C, 0x41, 0x08, 0x07, 0x21, 0x8D, 0x4A, 0x29,
+    0x8C, 0x4A, 0x29, 0x07, 0x49, 0x29, 0x82, 0x10, 0x49, 0x52, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC,
+    0x24, 0x29, 0x41, 0x48, 0xA2, 0x03, 0xF8, 0x07, 0x01, 0x80, 0x61, 0x10, 0x51, 0x9C, 0xF3, 0xAC,
+    0xF3, 0xAC, 0x4D, 0x73, 0x41, 0x08, 0x28, 0x21, 0x9D, 0x4A, 0x29, 0x07, 0x49, 0x29, 0x62, 0x08,
+    0xAA, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC, 0xB2, 0xA4, 0xC3, 0x18, 0x41, 0x08, 0xA2, 0x00, 0x00, 0x07,
+    0x20, 0x00, 0xA2, 0x10, 0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0x0C, 0x6B, 0x61, 0x08, 0x49, 0x29,
+    0x9D, 0x4A, 0x29, 0x07, 0x49, 0x29, 0x61, 0x08, 0x0C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4,
+    0xA2, 0x18, 0x01, 0x70, 0xA2, 0x03, 0xF8, 0x07, 0x21, 0x58, 0xC3, 0x20, 0xB2, 0xA4, 0xF3, 0xAC,
+    0xF3, 0xAC, 0x8A, 0x5A, 0x82, 0x10, 0x49, 0x29, 0x9D, 0x4A, 0x29, 0x07, 0x28, 0x21, 0x41, 0x08,
+    0x6D, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0x71, 0x9C, 0x82, 0x10, 0x20, 0x00, 0xA2, 0x00, 0x00, 0x07,
+    0x41, 0x08, 0x04, 0x21, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x49, 0x4A, 0x82, 0x10, 0x49, 0x29,
+    0x8C, 0x4A, 0x29, 0x8C, 0x4A, 0x29, 0x07, 0xE6, 0x18, 0xA2, 0x10, 0xB2, 0xA4, 0xF3, 0xAC, 0xF3,
+    0xAC, 0x8A, 0x5A, 0x61, 0x20, 0x02, 0xE8, 0xA3, 0x03, 0xF8, 0x01, 0x41, 0x48, 0x65, 0x31, 0x82,
+    0xF3, 0xAC, 0x01, 0x65, 0x31, 0xA4, 0x10, 0x9D, 0x4A, 0x29, 0x06, 0xC5, 0x18, 0xC3, 0x18, 0xD3,
+    0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x08, 0x4A, 0x61, 0x08, 0xA4, 0x00, 0x00, 0x01, 0x61, 0x08, 0xC7,
+    0x39, 0x82, 0xF3, 0xAC, 0x01, 0x04, 0x21, 0xC5, 0x18, 0x9D, 0x4A, 0x29, 0x01, 0xC4, 0x18, 0x24,
+    0x21, 0x82, 0xF3, 0xAC, 0x02, 0xA6, 0x39, 0x41, 0x38, 0x03, 0xF0, 0xA2, 0x03, 0xF8, 0x07, 0x03,
+    0xF0, 0x41, 0x28, 0x28, 0x4A, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0xC3, 0x18, 0xC5, 0x18, 0x9D,
+    0x4A, 0x29, 0x01, 0xA4, 0x10, 0x86, 0x31, 0x82, 0xF3, 0xAC, 0x01, 0x45, 0x29, 0x61, 0x08, 0xA4,
+    0x00, 0x00, 0x06, 0x61, 0x08, 0x8A, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC, 0xB2, 0xA4, 0x82, 0x10, 0xE6,
+    0x18, 0x8C, 0x4A, 0x29, 0x8B, 0x4A, 0x29, 0x07, 0x49, 0x29, 0x82, 0x10, 0xCB, 0x62, 0xF3, 0xAC,
+    0xF3, 0xAC, 0x30, 0x94, 0x41, 0x08, 0x02, 0xA8, 0xA4, 0x03, 0xF8, 0x07, 0x02, 0xD8, 0x41, 0x10,
+    0x4D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xEF, 0x8B, 0x20, 0x00, 0x28, 0x21, 0x9B, 0x4A, 0x29, 0x06,
+    0x49, 0x29, 0x62, 0x08, 0x2C, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xEF, 0x8B, 0x41, 0x08, 0xA6, 0x00,
+    0x00, 0x06, 0x41, 0x08, 0xAE, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x7B, 0x61, 0x08, 0x49, 0x29,
+    0x9B, 0x4A, 0x29, 0x07, 0x49, 0x29, 0x61, 0x08, 0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xAE, 0x83,
+    0x41, 0x08, 0x02, 0xD0, 0xA4, 0x03, 0xF8, 0x07, 0x02, 0xC0, 0x41, 0x08, 0xF0, 0x8B, 0xF3, 0xAC,
+    0xF3, 0xAC, 0x0C, 0x6B, 0x62, 0x08, 0x49, 0x29, 0x9B, 0x4A, 0x29, 0x06, 0x28, 0x21, 0x21, 0x08,
+    0xEF, 0x8B, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0x41, 0x08, 0xA6, 0x00, 0x00, 0x06, 0x41, 0x08,
+    0x51, 0x94, 0xF3, 0xAC, 0xF3, 0xAC, 0xAA, 0x5A, 0x82, 0x10, 0x49, 0x29, 0x8B, 0x4A, 0x29, 0x8B,
+    0x4A, 0x29, 0x06, 0xE6, 0x18, 0x82, 0x10, 0xB2, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xA6, 0x39, 0x41,
+    0x48, 0x8F, 0x03, 0xF8, 0x07, 0x02, 0xC0, 0x01, 0x80, 0x01, 0x60, 0x00, 0x48, 0x01, 0x58, 0x01,
+    0x78, 0x02, 0xB0, 0x03, 0xF0, 0x8E, 0x03, 0xF8, 0x06, 0x01, 0x80, 0xC3, 0x18, 0xD3, 0xAC, 0xF3,
+    0xAC, 0xF3, 0xAC, 0x45, 0x29, 0xC4, 0x18, 0x9B, 0x4A, 0x29, 0x06, 0xE6, 0x18, 0xC3, 0x18, 0xD3,
+    0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x45, 0x29, 0x41, 0x08, 0x8E, 0x00, 0x00, 0x08, 0x41, 0x08, 0x08,
+    0x42, 0xEF, 0x7B, 0xD3, 0x9C, 0x75, 0xAD, 0xF3, 0x9C, 0xEF, 0x7B, 0x28, 0x42, 0x61, 0x08, 0x8E,
+    0x00, 0x00, 0x01, 0x20, 0x00, 0x04, 0x21, 0x82, 0xF3, 0xAC, 0x01, 0x04, 0x21, 0xC5, 0x18, 0x9B,
+    0x4A, 0x29, 0x01, 0xC5, 0x18, 0x04, 0x21, 0x82, 0xF3, 0xAC, 0x01, 0xE3, 0x20, 0x01, 0x70, 0x8E,
+    0x03, 0xF8, 0x07, 0x03, 0xF0, 0x02, 0xB0, 0x01, 0x78, 0x01, 0x58, 0x00, 0x48, 0x01, 0x60, 0x01,
+    0x78, 0x02, 0xB8, 0x8F, 0x03, 0xF8, 0x06, 0x21, 0x58, 0x65, 0x31, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3,
+    0xAC, 0xA3, 0x18, 0xE6, 0x18, 0x9B, 0x4A, 0x29, 0x06, 0xC4, 0x18, 0x65, 0x31, 0xF3, 0xAC, 0xF3,
+    0xAC, 0xD3, 0xAC, 0xA2, 0x18, 0x20, 0x00, 0x8E, 0x00, 0x00, 0x08, 0x82, 0x08, 0x49, 0x42, 0x10,
+    0x74, 0xF3, 0x8C, 0x75, 0x9D, 0xB2, 0x84, 0xCF, 0x6B, 0xC7, 0x31, 0x20, 0x00, 0x8E, 0x00, 0x00,
+    0x06, 0x41, 0x08, 0xC7, 0x39, 0xF3, 0xAC, 0xF3, 0xAC, 0xB2, 0xA4, 0x82, 0x10, 0xE6, 0x18, 0x8B,
+    0x4A, 0x29, 0x8B, 0x4A, 0x29, 0x06, 0xA3, 0x10, 0x49, 0x52, 0xF3, 0xAC, 0xF3, 0xAC, 0x30, 0x94,
+    0x20, 0x08, 0x02, 0xC8, 0x8C, 0x03, 0xF8, 0x04, 0x03, 0xF0, 0x01, 0x88, 0x00, 0x18, 0x00, 0x08,
+    0x00, 0x10, 0x82, 0x00, 0x00, 0x04, 0x00, 0x08, 0x00, 0x08, 0x00, 0x10, 0x01, 0x68, 0x02, 0xE8,
+    0x8C, 0x03, 0xF8, 0x07, 0x03, 0xF0, 0x61, 0x18, 0x2C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x73,
+    0x61, 0x08, 0x49, 0x29, 0x9A, 0x4A, 0x29, 0x05, 0x82, 0x10, 0xAA, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC,
+    0xEF, 0x8B, 0x20, 0x00, 0x8D, 0x00, 0x00, 0x0C, 0x82, 0x10, 0xAE, 0x73, 0x5D, 0xEF, 0xBE, 0xF7,
+    0xB6, 0xB5, 0xB2, 0x94, 0x10, 0x84, 0x92, 0x94, 0x96, 0xB5, 0x9E, 0xF7, 0x7D, 0xEF, 0xEF, 0x7B,
+    0xA2, 0x10, 0x8D, 0x00, 0x00, 0x06, 0x41, 0x08, 0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0x0C, 0x6B,
+    0x82, 0x10, 0x49, 0x29, 0x99, 0x4A, 0x29, 0x07, 0x49, 0x29, 0x82, 0x10, 0x0C, 0x6B, 0xF3, 0xAC,
+    0xF3, 0xAC, 0x6D, 0x7B, 0x41, 0x10, 0x02, 0xE0, 0x8C, 0x03, 0xF8, 0x04, 0x03, 0xE8, 0x01, 0x78,
+    0x00, 0x10, 0x00, 0x08, 0x00, 0x08, 0x82, 0x00, 0x00, 0x04, 0x00, 0x10, 0x00, 0x08, 0x00, 0x10,
+    0x01, 0x80, 0x03, 0xF0, 0x8C, 0x03, 0xF8, 0x06, 0x02, 0xD8, 0x20, 0x08, 0xEF, 0x8B, 0xF3, 0xAC,
+    0xF3, 0xAC, 0xAA, 0x5A, 0x83, 0x10, 0x9A, 0x4A, 0x29, 0x06, 0x49, 0x29, 0x61, 0x08, 0x6D, 0x7B,
+    0xF3, 0xAC, 0xF3, 0xAC, 0x0C, 0x6B, 0x41, 0x08, 0x8D, 0x00, 0x00, 0x0C, 0xC3, 0x10, 0x51, 0x7C,
+    0x9E, 0xD7, 0x7D, 0xD7, 0x75, 0x9D, 0x92, 0x84, 0x10, 0x74, 0xD3, 0x84, 0xD7, 0xA5, 0xDF, 0xDF,
+    0x1C, 0xC7, 0x4D, 0x5B, 0x61, 0x08, 0x8D, 0x00, 0x00, 0x05, 0x20, 0x00, 0x30, 0x94, 0xF3, 0xAC,
+    0xF3, 0xAC, 0x49, 0x4A, 0xA3, 0x10, 0x8B, 0x4A, 0x29, 0x8A, 0x4A, 0x29, 0x06, 0x29, 0x21, 0x20,
+    0x00, 0x10, 0x8C, 0xF3, 0xAC, 0xF3, 0xAC, 0x28, 0x4A, 0x41, 0x40, 0x8C, 0x03, 0xF8, 0x02, 0x02,
+    0xD0, 0x00, 0x20, 0x00, 0x08, 0x88, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x10, 0x02, 0xA8, 0x8C,
+    0x03, 0xF8, 0x06, 0x01, 0x78, 0xE3, 0x28, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x82, 0x10, 0xE7,
+    0x20, 0x99, 0x4A, 0x29, 0x06, 0x08, 0x21, 0x20, 0x00, 0x71, 0x9C, 0xF3, 0xAC, 0xF3, 0xAC, 0xA6,
+    0x39, 0x41, 0x08, 0x8C, 0x00, 0x00, 0x04, 0xA6, 0x31, 0xFB, 0xDE, 0xFB, 0xDE, 0xEB, 0x5A, 0x82,
+    0x10, 0x84, 0x00, 0x00, 0x04, 0x82, 0x10, 0xAA, 0x52, 0xBA, 0xD6, 0x3C, 0xE7, 0x08, 0x42, 0x8C,
+    0x00, 0x00, 0x06, 0x20, 0x00, 0x45, 0x29, 0xF3, 0xAC, 0xF3, 0xAC, 0xB2, 0xA4, 0x61, 0x08, 0x07,
+    0x21, 0x99, 0x4A, 0x29, 0x06, 0x07, 0x21, 0x61, 0x08, 0xB2, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0x45,
+    0x31, 0x01, 0x68, 0x8C, 0x03, 0xF8, 0x02, 0x02, 0xB8, 0x00, 0x10, 0x00, 0x08, 0x88, 0x00, 0x00,
+    0x02, 0x00, 0x08, 0x00, 0x18, 0x02, 0xC8, 0x8C, 0x03, 0xF8, 0x06, 0x21, 0x58, 0xA6, 0x41, 0xF3,
+    0xAC, 0xF3, 0xAC, 0x71, 0x9C, 0x20, 0x00, 0x28, 0x21, 0x99, 0x4A, 0x29, 0x06, 0xE6, 0x18, 0x82,
+    0x10, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xE3, 0x20, 0x20, 0x00, 0x8C, 0x00, 0x00, 0x04, 0x69,
+    0x42, 0x7D, 0xD7, 0x59, 0xB6, 0x69, 0x42, 0x61, 0x08, 0x84, 0x00, 0x00, 0x04, 0xA2, 0x10, 0x4D,
+    0x5B, 0x3C, 0xCF, 0xBA, 0xBE, 0x45, 0x21, 0x8C, 0x00, 0x00, 0x06, 0x61, 0x08, 0x28, 0x4A, 0xF3,
+    0xAC, 0xF3, 0xAC, 0x10, 0x8C, 0x20, 0x00, 0x29, 0x21, 0x8A, 0x4A, 0x29, 0x8A, 0x4A, 0x29, 0x06,
+    0xE6, 0x18, 0xE3, 0x20, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x82, 0x10, 0x02, 0xA0, 0x8B, 0x03,
+    0xF8, 0x02, 0x02, 0xB8, 0x00, 0x10, 0x00, 0x08, 0x8B, 0x00, 0x00, 0x01, 0x00, 0x08, 0x01, 0x88,
+    0x8B, 0x03, 0xF8, 0x06, 0x02, 0xE0, 0x20, 0x08, 0x10, 0x8C, 0xF3, 0xAC, 0xF3, 0xAC, 0x08, 0x42,
+    0xA4, 0x10, 0x99, 0x4A, 0x29, 0x05, 0xC5, 0x18, 0x45, 0x29, 0xF3, 0xAC, 0xF3, 0xAC, 0xB2, 0xA4,
+    0x41, 0x08, 0x8C, 0x00, 0x00, 0x03, 0x69, 0x4A, 0xBE, 0xF7, 0x71, 0x8C, 0x61, 0x08, 0x88, 0x00,
+    0x00, 0x03, 0x61, 0x08, 0xEF, 0x7B, 0xBE, 0xF7, 0xEB, 0x5A, 0x8C, 0x00, 0x00, 0x05, 0x20, 0x00,
+    0x71, 0x9C, 0xF3, 0xAC, 0xF3, 0xAC, 0xA6, 0x39, 0xC4, 0x18, 0x99, 0x4A, 0x29, 0x06, 0xA4, 0x10,
+    0xA6, 0x39, 0xF3, 0xAC, 0xF3, 0xAC, 0x71, 0x9C, 0x20, 0x08, 0x02, 0xC8, 0x8B, 0x03, 0xF8, 0x02,
+    0x02, 0x98, 0x00, 0x08, 0x00, 0x08, 0x8A, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x08, 0x02, 0xA8,
+    0x8B, 0x03, 0xF8, 0x06, 0x02, 0xB8, 0x61, 0x08, 0xB2, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0x25, 0x29,
+    0xC5, 0x18, 0x99, 0x4A, 0x29, 0x05, 0xA4, 0x10, 0x08, 0x4A, 0xF3, 0xAC, 0xF3, 0xAC, 0x10, 0x94,
+    0x20, 0x00, 0x8C, 0x00, 0x00, 0x03, 0x6D, 0x63, 0xDF, 0xDF, 0x6D, 0x63, 0x20, 0x00, 0x88, 0x00,
+    0x00, 0x03, 0x82, 0x10, 0x14, 0x8D, 0x7D, 0xD7, 0x08, 0x3A, 0x8C, 0x00, 0x00, 0x05, 0x82, 0x10,
+    0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xE3, 0x18, 0xE6, 0x18, 0x8A, 0x4A, 0x29, 0x8A, 0x4A, 0x29,
+    0x06, 0xA4, 0x10, 0x49, 0x52, 0xF3, 0xAC, 0xF3, 0xAC, 0x8E, 0x7B, 0x41, 0x10, 0x03, 0xF0, 0x8A,
+    0x03, 0xF8, 0x01, 0x02, 0xD0, 0x00, 0x10, 0x8E, 0x00, 0x00, 0x01, 0x00, 0x08, 0x02, 0xA8, 0x8B,
+    0x03, 0xF8, 0x05, 0x61, 0x40, 0x69, 0x52, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0x62, 0x08, 0x99,
+    0x4A, 0x29, 0x05, 0xA3, 0x10, 0xAA, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC, 0x0C, 0x6B, 0x61, 0x08, 0x8B,
+    0x00, 0x00, 0x02, 0xA6, 0x31, 0x9E, 0xF7, 0x6D, 0x6B, 0x8C, 0x00, 0x00, 0x02, 0xEB, 0x5A, 0xDF,
+    0xFF, 0x08, 0x42, 0x8B, 0x00, 0x00, 0x05, 0x61, 0x08, 0xCB, 0x62, 0xF3, 0xAC, 0xF3, 0xAC, 0xEB,
+    0x62, 0x82, 0x10, 0x99, 0x4A, 0x29, 0x05, 0x82, 0x10, 0x0C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0xAA,
+    0x62, 0x61, 0x30, 0x8B, 0x03, 0xF8, 0x01, 0x02, 0xB8, 0x00, 0x08, 0x8E, 0x00, 0x00, 0x01, 0x00,
+    0x08, 0x02, 0xC8, 0x8B, 0x03, 0xF8, 0x05, 0x61, 0x18, 0x2C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0x8A,
+    0x5A, 0xA3, 0x10, 0x99, 0x4A, 0x29, 0x05, 0x62, 0x08, 0x6D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0x49,
+    0x52, 0x61, 0x08, 0x8B, 0x00, 0x00, 0x02, 0x8A, 0x4A, 0xDF, 0xDF, 0x49, 0x42, 0x8C, 0x00, 0x00,
+    0x02, 0x10, 0x74, 0x7D, 0xCF, 0x24, 0x21, 0x8B, 0x00, 0x00, 0x05, 0x41, 0x08, 0x8E, 0x7B, 0xF3,
+    0xAC, 0xF3, 0xAC, 0x28, 0x4A, 0xA4, 0x10, 0x8A, 0x4A, 0x29, 0x89, 0x4A, 0x29, 0x06, 0x49, 0x29,
+    0x61, 0x08, 0x6D, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0x28, 0x4A, 0x41, 0x48, 0x8B, 0x03, 0xF8, 0x01,
+    0x00, 0x28, 0x00, 0x08, 0x8F, 0x00, 0x00, 0x01, 0x00, 0x10, 0x02, 0xE0, 0x8A, 0x03, 0xF8, 0x06,
+    0x01, 0x80, 0x04, 0x29, 0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4, 0x20, 0x00, 0x28, 0x21, 0x97, 0x4A,
+    0x29, 0x06, 0x49, 0x29, 0x41, 0x08, 0xEF, 0x8B, 0xF3, 0xAC, 0xF3, 0xAC, 0xC7, 0x39, 0x41, 0x08,
+    0x8A, 0x00, 0x00, 0x02, 0x61, 0x08, 0xFB, 0xDE, 0x92, 0x94, 0x8E, 0x00, 0x00, 0x02, 0xEF, 0x7B,
+    0x3C, 0xE7, 0xA2, 0x10, 0x8B, 0x00, 0x00, 0x05, 0x65, 0x31, 0xF3, 0xAC, 0xF3, 0xAC, 0x30, 0x94,
+    0x00, 0x00, 0x29, 0x29, 0x97, 0x4A, 0x29, 0x06, 0x29, 0x21, 0x00, 0x00, 0x30, 0x94, 0xF3, 0xAC,
+    0xF3, 0xAC, 0x65, 0x31, 0x01, 0x70, 0x8A, 0x03, 0xF8, 0x02, 0x02, 0xE8, 0x00, 0x10, 0x00, 0x08,
+    0x8E, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x20, 0x03, 0xF0, 0x8A, 0x03, 0xF8, 0x06, 0x21, 0x58,
+    0xE7, 0x41, 0xF3, 0xAC, 0xF3, 0xAC, 0xCF, 0x83, 0x41, 0x08, 0x49, 0x29, 0x97, 0x4A, 0x29, 0x05,
+    0x28, 0x21, 0x20, 0x00, 0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0x04, 0x21, 0x8B, 0x00, 0x00, 0x02,
+    0x04, 0x19, 0x9E, 0xD7, 0x4D, 0x5B, 0x8D, 0x00, 0x00, 0x03, 0x20, 0x00, 0x34, 0x95, 0x59, 0xB6,
+    0x41, 0x08, 0x8A, 0x00, 0x00, 0x05, 0x61, 0x08, 0x49, 0x52, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x7B,
+    0x62, 0x08, 0x8A, 0x4A, 0x29, 0x89, 0x4A, 0x29, 0x06, 0x28, 0x21, 0x00, 0x00, 0x92, 0xA4, 0xF3,
+    0xAC, 0xF3, 0xAC, 0xE3, 0x28, 0x01, 0x88, 0x8A, 0x03, 0xF8, 0x01, 0x01, 0x98, 0x00, 0x08, 0x90,
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x01, 0x60, 0x8A, 0x03, 0xF8, 0x06, 0x02, 0xC8, 0x20, 0x08, 0xB2,
+    0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xC3, 0x18, 0xE6, 0x18, 0x97, 0x4A, 0x29, 0x05, 0x08, 0x21, 0x41,
+    0x08, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xA2, 0x10, 0x8B, 0x00, 0x00, 0x02, 0x8E, 0x73, 0x1C,
+    0xE7, 0x82, 0x10, 0x8E, 0x00, 0x00, 0x02, 0x41, 0x08, 0x79, 0xCE, 0x10, 0x84, 0x8B, 0x00, 0x00,
+    0x05, 0x61, 0x08, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x82, 0x10, 0x07, 0x21, 0x97, 0x4A, 0x29,
+    0x06, 0x07, 0x21, 0x82, 0x10, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x61, 0x10, 0x02, 0xB0, 0x8A,
+    0x03, 0xF8, 0x01, 0x01, 0x70, 0x00, 0x10, 0x90, 0x00, 0x00, 0x01, 0x00, 0x08, 0x01, 0x88, 0x8A,
+    0x03, 0xF8, 0x06, 0x02, 0xA0, 0xA2, 0x18, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x20, 0x00, 0x08,
+    0x21, 0x97, 0x4A, 0x29, 0x05, 0xE6, 0x18, 0xC3, 0x18, 0xF3, 0xAC, 0xF3, 0xAC, 0xB2, 0xA4, 0x20,
+    0x00, 0x8B, 0x00, 0x00, 0x01, 0xD3, 0x84, 0xF7, 0xAD, 0x8F, 0x00, 0x00, 0x02, 0xA2, 0x10, 0x7D,
+    0xCF, 0xCB, 0x52, 0x8B, 0x00, 0x00, 0x05, 0x04, 0x21, 0xF3, 0xAC, 0xF3, 0xAC, 0x71, 0x9C, 0x00,
+    0x00, 0x28, 0x21, 0x89, 0x4A, 0x29, 0x89, 0x4A, 0x29, 0x01, 0x07, 0x21, 0x82, 0x10, 0x82, 0xF3,
+    0xAC, 0x01, 0x41, 0x08, 0x02, 0xC0, 0x8A, 0x03, 0xF8, 0x00, 0x00, 0x28, 0x92, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x02, 0xE8, 0x89, 0x03, 0xF8, 0x06, 0x03, 0xF0, 0x20, 0x08, 0xEF, 0x8B, 0xF3, 0xAC,
+    0xF3, 0xAC, 0x65, 0x31, 0xC5, 0x18, 0x97, 0x4A, 0x29, 0x04, 0xE6, 0x18, 0xC3, 0x18, 0xF3, 0xAC,
+    0xF3, 0xAC, 0x92, 0xA4, 0x8B, 0x00, 0x00, 0x02, 0x20, 0x00, 0x1C, 0xE7, 0x0C, 0x63, 0x90, 0x00,
+    0x00, 0x02, 0x8A, 0x52, 0x9E, 0xF7, 0x61, 0x08, 0x8B, 0x00, 0x00, 0x04, 0x51, 0x94, 0xF3, 0xAC,
+    0xF3, 0xAC, 0x04, 0x21, 0xE6, 0x18, 0x97, 0x4A, 0x29, 0x06, 0xC6, 0x18, 0x24, 0x21, 0xF3, 0xAC,
+    0xF3, 0xAC, 0x30, 0x94, 0x00, 0x00, 0x02, 0xE8, 0x89, 0x03, 0xF8, 0x01, 0x03, 0xF0, 0x00, 0x10,
+    0x92, 0x00, 0x00, 0x00, 0x00, 0x18, 0x8A, 0x03, 0xF8, 0x06, 0x02, 0xD0, 0x00, 0x00, 0xB2, 0xA4,
+    0xF3, 0xAC, 0xF3, 0xAC, 0xC3, 0x18, 0xE6, 0x18, 0x97, 0x4A, 0x29, 0x05, 0xC5, 0x18, 0x86, 0x31,
+    0xF3, 0xAC, 0xF3, 0xAC, 0xCF, 0x83, 0x20, 0x08, 0x8A, 0x00, 0x00, 0x02, 0xC3, 0x18, 0xDF, 0xDF,
+    0xE7, 0x31, 0x90, 0x00, 0x00, 0x01, 0xCF, 0x6B, 0x79, 0xB6, 0x8B, 0x00, 0x00, 0x00, 0x61, 0x08,
+    0x82, 0xF3, 0xAC, 0x01, 0x62, 0x10, 0x07, 0x21, 0x89, 0x4A, 0x29, 0x89, 0x4A, 0x29, 0x06, 0xE6,
+    0x18, 0x04, 0x21, 0xF3, 0xAC, 0xF3, 0xAC, 0x51, 0x94, 0x00, 0x00, 0x02, 0xE0, 0x89, 0x03, 0xF8,
+    0x00, 0x02, 0xD8, 0x93, 0x00, 0x00, 0x01, 0x00, 0x10, 0x02, 0x98, 0x8A, 0x03, 0xF8, 0x05, 0x61,
+    0x20, 0x2C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0x28, 0x4A, 0xA4, 0x10, 0x97, 0x4A, 0x29, 0x05, 0xC5,
+    0x18, 0x66, 0x31, 0xF3, 0xAC, 0xF3, 0xAC, 0xEF, 0x8B, 0x20, 0x00, 0x8A, 0x00, 0x00, 0x02, 0xC7,
+    0x39, 0xDF, 0xFF, 0xA2, 0x10, 0x90, 0x00, 0x00, 0x02, 0x61, 0x08, 0x7D, 0xEF, 0x49, 0x4A, 0x8A,
+    0x00, 0x00, 0x05, 0x61, 0x08, 0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xC7, 0x41, 0xA4, 0x10, 0x97,
+    0x4A, 0x29, 0x05, 0xA4, 0x10, 0xE7, 0x41, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x7B, 0x61, 0x18, 0x8A,
+    0x03, 0xF8, 0x01, 0x02, 0xA8, 0x00, 0x08, 0x92, 0x00, 0x00, 0x01, 0x00, 0x08, 0x02, 0xC0, 0x89,
+    0x03, 0xF8, 0x06, 0x03, 0xF0, 0x20, 0x08, 0xEF, 0x8B, 0xF3, 0xAC, 0xF3, 0xAC, 0x65, 0x31, 0xC5,
+    0x18, 0x97, 0x4A, 0x29, 0x05, 0xA4, 0x10, 0x49, 0x52, 0xF3, 0xAC, 0xF3, 0xAC, 0x0C, 0x6B, 0x61,
+    0x08, 0x8A, 0x00, 0x00, 0x01, 0x0C, 0x53, 0xFB, 0xC6, 0x91, 0x00, 0x00, 0x02, 0x04, 0x19, 0xFF,
+    0xDF, 0x24, 0x21, 0x8B, 0x00, 0x00, 0x04, 0x51, 0x9C, 0xF3, 0xAC, 0xF3, 0xAC, 0x04, 0x21, 0xE6,
+    0x18, 0x89, 0x4A, 0x29, 0x89, 0x4A, 0x29, 0x05, 0xC5, 0x18, 0x66, 0x31, 0xF3, 0xAC, 0xF3, 0xAC,
+    0xAE, 0x83, 0x41, 0x10, 0x8A, 0x03, 0xF8, 0x01, 0x01, 0x98, 0x00, 0x10, 0x92, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x01, 0x58, 0x8A, 0x03, 0xF8, 0x05, 0x61, 0x40, 0xAA, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC,
+    0x8A, 0x5A, 0xA3, 0x10, 0x97, 0x4A, 0x29, 0x05, 0xA4, 0x10, 0xE7, 0x41, 0xF3, 0xAC, 0xF3, 0xAC,
+    0x4D, 0x73, 0x61, 0x08, 0x8A, 0x00, 0x00, 0x01, 0xAE, 0x73, 0xF7, 0xBD, 0x92, 0x00, 0x00, 0x01,
+    0x55, 0xAD, 0x51, 0x8C, 0x8A, 0x00, 0x00, 0x05, 0x61, 0x08, 0x0C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC,
+    0x49, 0x4A, 0xA4, 0x10, 0x97, 0x4A, 0x29, 0x05, 0xA4, 0x10, 0x49, 0x52, 0xF3, 0xAC, 0xF3, 0xAC,
+    0xEB, 0x6A, 0x61, 0x30, 0x8A, 0x03, 0xF8, 0x01, 0x01, 0x70, 0x00, 0x08, 0x92, 0x00, 0x00, 0x01,
+    0x00, 0x10, 0x01, 0x80, 0x8A, 0x03, 0xF8, 0x05, 0x61, 0x18, 0x4D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC,
+    0xC7, 0x41, 0xA4, 0x10, 0x97, 0x4A, 0x29, 0x05, 0xA3, 0x10, 0xAA, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC,
+    0x8A, 0x5A, 0x61, 0x08, 0x8A, 0x00, 0x00, 0x01, 0xF3, 0x8C, 0xB2, 0x84, 0x92, 0x00, 0x00, 0x01,
+    0x9A, 0xBE, 0x0C, 0x53, 0x8A, 0x00, 0x00, 0x05, 0x41, 0x08, 0xCF, 0x83, 0xF3, 0xAC, 0xF3, 0xAC,
+    0x65, 0x31, 0xC5, 0x18, 0x89, 0x4A, 0x29, 0x89, 0x4A, 0x29, 0x05, 0xC5, 0x18, 0xA6, 0x39, 0xF3,
+    0xAC, 0xF3, 0xAC, 0x6D, 0x7B, 0x61, 0x18, 0x8A, 0x03, 0xF8, 0x01, 0x01, 0x78, 0x00, 0x10, 0x93,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x8A, 0x03, 0xF8, 0x05, 0x41, 0x50, 0x69, 0x52, 0xF3, 0xAC, 0xF3,
+    0xAC, 0xEB, 0x62, 0xA3, 0x10, 0x97, 0x4A, 0x29, 0x05, 0xA4, 0x10, 0x28, 0x4A, 0xF3, 0xAC, 0xF3,
+    0xAC, 0x0C, 0x6B, 0x61, 0x08, 0x8A, 0x00, 0x00, 0x01, 0x92, 0x94, 0xF3, 0x9C, 0x92, 0x00, 0x00,
+    0x01, 0x51, 0x8C, 0x34, 0xA5, 0x8A, 0x00, 0x00, 0x05, 0x61, 0x08, 0xCB, 0x62, 0xF3, 0xAC, 0xF3,
+    0xAC, 0x8A, 0x5A, 0xA4, 0x10, 0x97, 0x4A, 0x29, 0x05, 0xA4, 0x10, 0x8A, 0x5A, 0xF3, 0xAC, 0xF3,
+    0xAC, 0xAA, 0x5A, 0x61, 0x38, 0x8A, 0x03, 0xF8, 0x00, 0x00, 0x50, 0x93, 0x00, 0x00, 0x01, 0x00,
+    0x08, 0x01, 0x68, 0x8A, 0x03, 0xF8, 0x05, 0x61, 0x28, 0x2C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0x08,
+    0x4A, 0xA4, 0x10, 0x97, 0x4A, 0x29, 0x05, 0xA3, 0x10, 0xEB, 0x62, 0xF3, 0xAC, 0xF3, 0xAC, 0x69,
+    0x52, 0x61, 0x08, 0x8A, 0x00, 0x00, 0x01, 0xD7, 0xA5, 0xAE, 0x63, 0x92, 0x00, 0x00, 0x01, 0x96,
+    0x9D, 0xEF, 0x6B, 0x8A, 0x00, 0x00, 0x05, 0x61, 0x08, 0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xA6,
+    0x39, 0xC5, 0x18, 0x89, 0x4A, 0x29, 0x89, 0x4A, 0x29, 0x05, 0xA4, 0x10, 0xE7, 0x41, 0xF3, 0xAC,
+    0xF3, 0xAC, 0x4D, 0x73, 0x61, 0x20, 0x8A, 0x03, 0xF8, 0x01, 0x01, 0x68, 0x00, 0x08, 0x93, 0x00,
+    0x00, 0x00, 0x00, 0x28, 0x8A, 0x03, 0xF8, 0x05, 0x21, 0x58, 0x28, 0x4A, 0xF3, 0xAC, 0xF3, 0xAC,
+    0x0C, 0x6B, 0x83, 0x10, 0x97, 0x4A, 0x29, 0x05, 0xA4, 0x10, 0x49, 0x52, 0xF3, 0xAC, 0xF3, 0xAC,
+    0xEB, 0x62, 0x61, 0x08, 0x8A, 0x00, 0x00, 0x01, 0x34, 0xA5, 0x51, 0x8C, 0x92, 0x00, 0x00, 0x01,
+    0xAE, 0x73, 0xD7, 0xBD, 0x8A, 0x00, 0x00, 0x05, 0x61, 0x08, 0x8A, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC,
+    0xAA, 0x5A, 0xA3, 0x10, 0x97, 0x4A, 0x29, 0x05, 0xA3, 0x10, 0xAA, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC,
+    0x8A, 0x5A, 0x61, 0x40, 0x8A, 0x03, 0xF8, 0x00, 0x00, 0x38, 0x94, 0x00, 0x00, 0x00, 0x01, 0x50,
+    0x8A, 0x03, 0xF8, 0x05, 0x61, 0x30, 0xEB, 0x62, 0xF3, 0xAC, 0xF3, 0xAC, 0x49, 0x52, 0xA4, 0x10,
+    0x97, 0x4A, 0x29, 0x05, 0x83, 0x10, 0x0C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0x28, 0x4A, 0x41, 0x08,
+    0x8A, 0x00, 0x00, 0x01, 0x79, 0xB6, 0x0C, 0x53, 0x92, 0x00, 0x00, 0x01, 0xF3, 0x8C, 0x92, 0x7C,
+    0x8A, 0x00, 0x00, 0x05, 0x61, 0x08, 0x4D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xE7, 0x41, 0xA4, 0x10,
+    0x89, 0x4A, 0x29, 0x89, 0x4A, 0x29, 0x05, 0xC5, 0x18, 0xC7, 0x39, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D,
+    0x7B, 0x61, 0x18, 0x8A, 0x03, 0xF8, 0x01, 0x01, 0x78, 0x00, 0x08, 0x93, 0x00, 0x00, 0x00, 0x00,
+    0x38, 0x8A, 0x03, 0xF8, 0x05, 0x41, 0x50, 0x69, 0x52, 0xF3, 0xAC, 0xF3, 0xAC, 0xEB, 0x62, 0xA3,
+    0x10, 0x97, 0x4A, 0x29, 0x05, 0xA4, 0x10, 0x28, 0x4A, 0xF3, 0xAC, 0xF3, 0xAC, 0x0C, 0x6B, 0x61,
+    0x08, 0x8A, 0x00, 0x00, 0x01, 0x92, 0x94, 0xD3, 0x9C, 0x92, 0x00, 0x00, 0x01, 0x30, 0x84, 0x34,
+    0xA5, 0x8A, 0x00, 0x00, 0x05, 0x61, 0x08, 0xAA, 0x62, 0xF3, 0xAC, 0xF3, 0xAC, 0x8A, 0x5A, 0xA3,
+    0x10, 0x97, 0x4A, 0x29, 0x05, 0xA4, 0x10, 0x8A, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC, 0xAA, 0x5A, 0x61,
+    0x40, 0x8A, 0x03, 0xF8, 0x00, 0x00, 0x48, 0x93, 0x00, 0x00, 0x01, 0x00, 0x08, 0x01, 0x68, 0x8A,
+    0x03, 0xF8, 0x05, 0x61, 0x28, 0x0C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0x28, 0x4A, 0xA4, 0x10, 0x97,
+    0x4A, 0x29, 0x05, 0xA3, 0x10, 0xEB, 0x62, 0xF3, 0xAC, 0xF3, 0xAC, 0x49, 0x52, 0x41, 0x08, 0x8A,
+    0x00, 0x00, 0x01, 0xF7, 0xA5, 0x8E, 0x63, 0x92, 0x00, 0x00, 0x01, 0x96, 0x9D, 0xEF, 0x6B, 0x8A,
+    0x00, 0x00, 0x05, 0x61, 0x08, 0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xA6, 0x39, 0xC5, 0x18, 0x89,
+    0x4A, 0x29, 0x89, 0x4A, 0x29, 0x05, 0xC5, 0x18, 0x66, 0x31, 0xF3, 0xAC, 0xF3, 0xAC, 0xAE, 0x83,
+    0x41, 0x10, 0x8A, 0x03, 0xF8, 0x01, 0x01, 0x90, 0x00, 0x10, 0x93, 0x00, 0x00, 0x00, 0x01, 0x58,
+    0x8A, 0x03, 0xF8, 0x05, 0x61, 0x40, 0x8A, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC, 0xAA, 0x5A, 0xA3, 0x10,
+    0x97, 0x4A, 0x29, 0x05, 0xA4, 0x10, 0xE7, 0x41, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0x61, 0x08,
+    0x8A, 0x00, 0x00, 0x01, 0xCF, 0x7B, 0xD7, 0xBD, 0x92, 0x00, 0x00, 0x01, 0x34, 0xA5, 0x71, 0x8C,
+    0x8A, 0x00, 0x00, 0x05, 0x61, 0x08, 0xEB, 0x6A, 0xF3, 0xAC, 0xF3, 0xAC, 0x49, 0x4A, 0xA4, 0x10,
+    0x97, 0x4A, 0x29, 0x05, 0xA4, 0x10, 0x49, 0x52, 0xF3, 0xAC, 0xF3, 0xAC, 0xEB, 0x62, 0x61, 0x30,
+    0x8A, 0x03, 0xF8, 0x01, 0x01, 0x68, 0x00, 0x08, 0x92, 0x00, 0x00, 0x01, 0x00, 0x10, 0x01, 0x80,
+    0x8A, 0x03, 0xF8, 0x05, 0x61, 0x20, 0x4D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xE7, 0x41, 0xA4, 0x10,
+    0x97, 0x4A, 0x29, 0x05, 0xA3, 0x10, 0xAA, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC, 0x8A, 0x5A, 0x61, 0x08,
+    0x8A, 0x00, 0x00, 0x01, 0x14, 0x8D, 0x71, 0x7C, 0x92, 0x00, 0x00, 0x01, 0x79, 0xB6, 0x2C, 0x5B,
+    0x8A, 0x00, 0x00, 0x05, 0x41, 0x08, 0xCF, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0x65, 0x31, 0xC5, 0x18,
+    0x89, 0x4A, 0x29, 0x89, 0x4A, 0x29, 0x06, 0xC6, 0x18, 0x24, 0x21, 0xF3, 0xAC, 0xF3, 0xAC, 0x30,
+    0x94, 0x00, 0x00, 0x02, 0xE8, 0x89, 0x03, 0xF8, 0x00, 0x02, 0xD0, 0x93, 0x00, 0x00, 0x01, 0x00,
+    0x10, 0x01, 0x90, 0x8A, 0x03, 0xF8, 0x05, 0x61, 0x28, 0x0C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0x49,
+    0x52, 0xA4, 0x10, 0x97, 0x4A, 0x29, 0x05, 0xC5, 0x18, 0x86, 0x31, 0xF3, 0xAC, 0xF3, 0xAC, 0xCF,
+    0x83, 0x41, 0x08, 0x8A, 0x00, 0x00, 0x02, 0x08, 0x42, 0xBE, 0xF7, 0x82, 0x10, 0x90, 0x00, 0x00,
+    0x02, 0x41, 0x08, 0x5D, 0xEF, 0x8A, 0x52, 0x8A, 0x00, 0x00, 0x05, 0x61, 0x08, 0x6D, 0x7B, 0xF3,
+    0xAC, 0xF3, 0xAC, 0xE7, 0x41, 0xA4, 0x10, 0x97, 0x4A, 0x29, 0x05, 0xA4, 0x10, 0xE7, 0x41, 0xF3,
+    0xAC, 0xF3, 0xAC, 0x6D, 0x73, 0x61, 0x18, 0x8A, 0x03, 0xF8, 0x01, 0x02, 0xA8, 0x00, 0x08, 0x92,
+    0x00, 0x00, 0x01, 0x00, 0x08, 0x02, 0xB8, 0x8A, 0x03, 0xF8, 0x05, 0x20, 0x08, 0xCF, 0x83, 0xF3,
+    0xAC, 0xF3, 0xAC, 0x65, 0x31, 0xC5, 0x18, 0x97, 0x4A, 0x29, 0x05, 0xA4, 0x10, 0x49, 0x52, 0xF3,
+    0xAC, 0xF3, 0xAC, 0x0C, 0x6B, 0x61, 0x08, 0x8A, 0x00, 0x00, 0x01, 0x2C, 0x5B, 0xBA, 0xBE, 0x91,
+    0x00, 0x00, 0x02, 0xE3, 0x18, 0xFF, 0xDF, 0x45, 0x21, 0x8B, 0x00, 0x00, 0x04, 0x30, 0x94, 0xF3,
+    0xAC, 0xF3, 0xAC, 0x04, 0x21, 0xE6, 0x18, 0x89, 0x4A, 0x29, 0x89, 0x4A, 0x29, 0x06, 0x07, 0x21,
+    0x82, 0x10, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x41, 0x08, 0x02, 0xC0, 0x8A, 0x03, 0xF8, 0x00,
+    0x00, 0x20, 0x93, 0x00, 0x00, 0x00, 0x02, 0xE0, 0x8A, 0x03, 0xF8, 0x05, 0x41, 0x08, 0xCF, 0x83,
+    0xF3, 0xAC, 0xF3, 0xAC, 0x86, 0x31, 0xC5, 0x18, 0x97, 0x4A, 0x29, 0x04, 0xE6, 0x18, 0xE3, 0x18,
+    0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4, 0x8B, 0x00, 0x00, 0x02, 0x41, 0x08, 0x5D, 0xEF, 0xCB, 0x5A,
+    0x90, 0x00, 0x00, 0x02, 0x28, 0x42, 0xBE, 0xF7, 0x82, 0x10, 0x8B, 0x00, 0x00, 0x04, 0x30, 0x94,
+    0xF3, 0xAC, 0xF3, 0xAC, 0x24, 0x21, 0xC6, 0x18, 0x97, 0x4A, 0x29, 0x06, 0xC5, 0x18, 0x25, 0x29,
+    0xF3, 0xAC, 0xF3, 0xAC, 0x30, 0x94, 0x00, 0x00, 0x02, 0xE8, 0x89, 0x03, 0xF8, 0x01, 0x03, 0xE8,
+    0x00, 0x08, 0x92, 0x00, 0x00, 0x00, 0x00, 0x10, 0x8A, 0x03, 0xF8, 0x06, 0x02, 0xD0, 0x00, 0x00,
+    0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xC3, 0x18, 0xE6, 0x18, 0x97, 0x4A, 0x29, 0x05, 0xC5, 0x18,
+    0xA6, 0x39, 0xF3, 0xAC, 0xF3, 0xAC, 0xCF, 0x83, 0x41, 0x08, 0x8A, 0x00, 0x00, 0x02, 0xE3, 0x18,
+    0xFF, 0xDF, 0x86, 0x29, 0x90, 0x00, 0x00, 0x01, 0x6D, 0x63, 0xDA, 0xBE, 0x8B, 0x00, 0x00, 0x05,
+    0x41, 0x08, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x82, 0x10, 0x07, 0x21, 0x89, 0x4A, 0x29, 0x89,
+    0x4A, 0x29, 0x06, 0x28, 0x21, 0x00, 0x00, 0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xE3, 0x20, 0x01,
+    0x90, 0x8A, 0x03, 0xF8, 0x01, 0x01, 0x90, 0x00, 0x08, 0x90, 0x00, 0x00, 0x01, 0x00, 0x08, 0x01,
+    0x50, 0x8A, 0x03, 0xF8, 0x06, 0x02, 0xC8, 0x20, 0x08, 0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xC3,
+    0x18, 0xE6, 0x18, 0x97, 0x4A, 0x29, 0x05, 0x07, 0x21, 0x41, 0x08, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3,
+    0xAC, 0x82, 0x10, 0x8B, 0x00, 0x00, 0x02, 0xEF, 0x7B, 0xBA, 0xD6, 0x61, 0x08, 0x8E, 0x00, 0x00,
+    0x02, 0x20, 0x00, 0x38, 0xC6, 0x71, 0x8C, 0x8B, 0x00, 0x00, 0x05, 0x61, 0x08, 0xD3, 0xAC, 0xF3,
+    0xAC, 0xF3, 0xAC, 0x82, 0x10, 0x07, 0x21, 0x97, 0x4A, 0x29, 0x06, 0x07, 0x21, 0x82, 0x10, 0xF3,
+    0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x61, 0x08, 0x02, 0xB8, 0x8A, 0x03, 0xF8, 0x01, 0x01, 0x60, 0x00,
+    0x08, 0x90, 0x00, 0x00, 0x01, 0x00, 0x10, 0x01, 0x78, 0x8A, 0x03, 0xF8, 0x06, 0x02, 0xA0, 0x82,
+    0x18, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x41, 0x08, 0x08, 0x21, 0x97, 0x4A, 0x29, 0x05, 0xE6,
+    0x18, 0xE3, 0x18, 0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4, 0x20, 0x00, 0x8B, 0x00, 0x00, 0x01, 0x34,
+    0x95, 0x96, 0x9D, 0x8F, 0x00, 0x00, 0x02, 0x82, 0x10, 0x3C, 0xCF, 0x2C, 0x5B, 0x8B, 0x00, 0x00,
+    0x05, 0xE3, 0x18, 0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4, 0x00, 0x00, 0x28, 0x21, 0x89, 0x4A, 0x29,
+    0x89, 0x4A, 0x29, 0x06, 0x49, 0x29, 0x61, 0x08, 0xAE, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0x08, 0x4A,
+    0x41, 0x50, 0x8A, 0x03, 0xF8, 0x02, 0x03, 0xF0, 0x00, 0x20, 0x00, 0x08, 0x8F, 0x00, 0x00, 0x01,
+    0x00, 0x08, 0x02, 0xD8, 0x8A, 0x03, 0xF8, 0x06, 0x01, 0x88, 0xE3, 0x28, 0xF3, 0xAC, 0xF3, 0xAC,
+    0xB2, 0xA4, 0x41, 0x08, 0x08, 0x21, 0x97, 0x4A, 0x29, 0x06, 0x49, 0x29, 0x21, 0x08, 0xF0, 0x8B,
+    0xF3, 0xAC, 0xF3, 0xAC, 0xA6, 0x39, 0x20, 0x00, 0x8A, 0x00, 0x00, 0x02, 0x82, 0x10, 0x3C, 0xE7,
+    0xEF, 0x7B, 0x8E, 0x00, 0x00, 0x02, 0x4D, 0x6B, 0x7D, 0xEF, 0xC3, 0x18, 0x8B, 0x00, 0x00, 0x05,
+    0x65, 0x29, 0xF3, 0xAC, 0xF3, 0xAC, 0x51, 0x9C, 0x00, 0x00, 0x28, 0x21, 0x97, 0x4A, 0x29, 0x06,
+    0x28, 0x21, 0x00, 0x00, 0x51, 0x9C, 0xF3, 0xAC, 0xF3, 0xAC, 0x45, 0x31, 0x01, 0x78, 0x8A, 0x03,
+    0xF8, 0x01, 0x02, 0xE0, 0x00, 0x10, 0x90, 0x00, 0x00, 0x01, 0x00, 0x18, 0x03, 0xE8, 0x8A, 0x03,
+    0xF8, 0x06, 0x01, 0x60, 0xC7, 0x41, 0xF3, 0xAC, 0xF3, 0xAC, 0xEF, 0x8B, 0x41, 0x08, 0x49, 0x29,
+    0x97, 0x4A, 0x29, 0x05, 0x08, 0x21, 0x41, 0x08, 0xB2, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xE3, 0x18,
+    0x8B, 0x00, 0x00, 0x02, 0x24, 0x21, 0xBE, 0xDF, 0xAA, 0x4A, 0x8E, 0x00, 0x00, 0x02, 0x92, 0x84,
+    0xBA, 0xBE, 0x61, 0x08, 0x8A, 0x00, 0x00, 0x06, 0x41, 0x08, 0x28, 0x4A, 0xF3, 0xAC, 0xF3, 0xAC,
+    0x8E, 0x7B, 0x61, 0x08, 0x49, 0x29, 0x89, 0x4A, 0x29, 0x8A, 0x4A, 0x29, 0x06, 0xA3, 0x10, 0x69,
+    0x52, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x73, 0x61, 0x18, 0x03, 0xF0, 0x8A, 0x03, 0xF8, 0x01, 0x02,
+    0xC8, 0x00, 0x08, 0x8E, 0x00, 0x00, 0x01, 0x00, 0x08, 0x01, 0x98, 0x8B, 0x03, 0xF8, 0x06, 0x41,
+    0x40, 0x49, 0x52, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D, 0x7B, 0x62, 0x08, 0x49, 0x29, 0x98, 0x4A, 0x29,
+    0x05, 0x83, 0x10, 0xCB, 0x62, 0xF3, 0xAC, 0xF3, 0xAC, 0x0C, 0x6B, 0x61, 0x08, 0x8B, 0x00, 0x00,
+    0x02, 0x08, 0x42, 0xBE, 0xF7, 0xAA, 0x52, 0x8C, 0x00, 0x00, 0x02, 0x49, 0x4A, 0xDF, 0xFF, 0x8A,
+    0x52, 0x8B, 0x00, 0x00, 0x05, 0x61, 0x08, 0xAA, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC, 0x0C, 0x6B, 0x82,
+    0x10, 0x99, 0x4A, 0x29, 0x05, 0x82, 0x10, 0x2C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0xAA, 0x5A, 0x61,
+    0x38, 0x8B, 0x03, 0xF8, 0x01, 0x02, 0xA8, 0x00, 0x08, 0x8E, 0x00, 0x00, 0x01, 0x00, 0x08, 0x02,
+    0xB8, 0x8B, 0x03, 0xF8, 0x05, 0x61, 0x20, 0x0C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0xAA, 0x5A, 0xA3,
+    0x10, 0x98, 0x4A, 0x29, 0x06, 0x49, 0x29, 0x61, 0x08, 0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0x49,
+    0x4A, 0x61, 0x08, 0x8B, 0x00, 0x00, 0x02, 0x0C, 0x5B, 0xBE, 0xD7, 0xC7, 0x31, 0x8C, 0x00, 0x00,
+    0x02, 0x4D, 0x5B, 0x9E, 0xD7, 0x86, 0x29, 0x8B, 0x00, 0x00, 0x05, 0x61, 0x08, 0x6D, 0x7B, 0xF3,
+    0xAC, 0xF3, 0xAC, 0x49, 0x52, 0xA4, 0x10, 0x8A, 0x4A, 0x29, 0x8A, 0x4A, 0x29, 0x06, 0xC5, 0x18,
+    0x04, 0x21, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x61, 0x10, 0x02, 0xB0, 0x8B, 0x03, 0xF8, 0x02,
+    0x02, 0xA8, 0x00, 0x08, 0x00, 0x08, 0x8B, 0x00, 0x00, 0x01, 0x00, 0x08, 0x01, 0x70, 0x8B, 0x03,
+    0xF8, 0x06, 0x02, 0xE0, 0x20, 0x08, 0xEF, 0x8B, 0xF3, 0xAC, 0xF3, 0xAC, 0x28, 0x4A, 0xA4, 0x10,
+    0x99, 0x4A, 0x29, 0x05, 0xC5, 0x18, 0x66, 0x31, 0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4, 0x41, 0x08,
+    0x8C, 0x00, 0x00, 0x03, 0x0C, 0x63, 0xDF, 0xFF, 0xAE, 0x73, 0x20, 0x00, 0x89, 0x00, 0x00, 0x02,
+    0x2C, 0x63, 0xDF, 0xFF, 0x8E, 0x73, 0x8C, 0x00, 0x00, 0x05, 0x20, 0x00, 0x51, 0x94, 0xF3, 0xAC,
+    0xF3, 0xAC, 0xC7, 0x39, 0xA4, 0x10, 0x99, 0x4A, 0x29, 0x06, 0xA4, 0x10, 0xC7, 0x41, 0xF3, 0xAC,
+    0xF3, 0xAC, 0x30, 0x94, 0x00, 0x00, 0x02, 0xD0, 0x8B, 0x03, 0xF8, 0x01, 0x01, 0x80, 0x00, 0x08,
+    0x8C, 0x00, 0x00, 0x01, 0x00, 0x08, 0x01, 0x98, 0x8B, 0x03, 0xF8, 0x06, 0x02, 0xC0, 0x41, 0x08,
+    0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0x65, 0x29, 0xC5, 0x18, 0x99, 0x4A, 0x29, 0x05, 0xA3, 0x10,
+    0x49, 0x4A, 0xF3, 0xAC, 0xF3, 0xAC, 0xEF, 0x8B, 0x20, 0x00, 0x8C, 0x00, 0x00, 0x02, 0x30, 0x74,
+    0xBE, 0xD7, 0xAA, 0x4A, 0x89, 0x00, 0x00, 0x03, 0x41, 0x08, 0x30, 0x74, 0xBE, 0xDF, 0x8A, 0x42,
+    0x8C, 0x00, 0x00, 0x05, 0x61, 0x08, 0xB2, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x04, 0x21, 0xE6, 0x18,
+    0x8A, 0x4A, 0x29, 0x8A, 0x4A, 0x29, 0x06, 0x28, 0x21, 0x20, 0x00, 0x30, 0x94, 0xF3, 0xAC, 0xF3,
+    0xAC, 0xE7, 0x41, 0x41, 0x48, 0x8C, 0x03, 0xF8, 0x02, 0x02, 0xC0, 0x00, 0x18, 0x00, 0x08, 0x88,
+    0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x08, 0x01, 0x90, 0x8C, 0x03, 0xF8, 0x01, 0x01, 0x88, 0xC3,
+    0x20, 0x82, 0xF3, 0xAC, 0x01, 0xA2, 0x10, 0xE6, 0x18, 0x99, 0x4A, 0x29, 0x06, 0x07, 0x21, 0x41,
+    0x08, 0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0x86, 0x31, 0x41, 0x08, 0x8C, 0x00, 0x00, 0x04, 0x49,
+    0x4A, 0x7D, 0xEF, 0x59, 0xCE, 0x28, 0x42, 0x41, 0x08, 0x85, 0x00, 0x00, 0x03, 0xE7, 0x39, 0xF7,
+    0xBD, 0x9E, 0xF7, 0xAA, 0x52, 0x8D, 0x00, 0x00, 0x05, 0x24, 0x29, 0xF3, 0xAC, 0xF3, 0xAC, 0xB2,
+    0xA4, 0x61, 0x08, 0x07, 0x21, 0x99, 0x4A, 0x29, 0x06, 0x07, 0x21, 0x61, 0x08, 0xB2, 0xAC, 0xF3,
+    0xAC, 0xF3, 0xAC, 0x24, 0x29, 0x01, 0x78, 0x8C, 0x03, 0xF8, 0x02, 0x02, 0xA0, 0x00, 0x08, 0x00,
+    0x08, 0x88, 0x00, 0x00, 0x02, 0x00, 0x08, 0x00, 0x10, 0x02, 0xB0, 0x8C, 0x03, 0xF8, 0x06, 0x21,
+    0x60, 0x86, 0x39, 0xF3, 0xAC, 0xF3, 0xAC, 0x71, 0x9C, 0x41, 0x08, 0x08, 0x21, 0x99, 0x4A, 0x29,
+    0x05, 0xE6, 0x18, 0xA2, 0x10, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0xC3, 0x18, 0x8D, 0x00, 0x00,
+    0x03, 0x2C, 0x5B, 0xDF, 0xDF, 0x96, 0x9D, 0xA6, 0x29, 0x85, 0x00, 0x00, 0x04, 0x41, 0x08, 0x69,
+    0x42, 0x9A, 0xBE, 0x3C, 0xCF, 0xC7, 0x31, 0x8C, 0x00, 0x00, 0x06, 0x41, 0x08, 0xE7, 0x41, 0xF3,
+    0xAC, 0xF3, 0xAC, 0x30, 0x94, 0x20, 0x00, 0x28, 0x21, 0x8A, 0x4A, 0x29, 0x8B, 0x4A, 0x29, 0x06,
+    0xA3, 0x10, 0x8A, 0x5A, 0xF3, 0xAC, 0xF3, 0xAC, 0x10, 0x8C, 0x20, 0x08, 0x02, 0xD0, 0x8C, 0x03,
+    0xF8, 0x01, 0x02, 0xE8, 0x01, 0x70, 0x82, 0x00, 0x08, 0x83, 0x00, 0x00, 0x03, 0x00, 0x10, 0x00,
+    0x00, 0x01, 0x50, 0x02, 0xD8, 0x8C, 0x03, 0xF8, 0x07, 0x03, 0xF0, 0x61, 0x18, 0xEB, 0x62, 0xF3,
+    0xAC, 0xF3, 0xAC, 0x8E, 0x7B, 0x61, 0x08, 0x49, 0x29, 0x9A, 0x4A, 0x29, 0x05, 0x82, 0x10, 0xEB,
+    0x62, 0xF3, 0xAC, 0xF3, 0xAC, 0xAE, 0x83, 0x41, 0x08, 0x8D, 0x00, 0x00, 0x0C, 0xC3, 0x18, 0x71,
+    0x8C, 0xDF, 0xFF, 0x3C, 0xE7, 0xF3, 0x9C, 0xEF, 0x7B, 0x2C, 0x63, 0xCF, 0x7B, 0xD3, 0x9C, 0x1C,
+    0xE7, 0xDF, 0xFF, 0xD3, 0x9C, 0x04, 0x21, 0x8D, 0x00, 0x00, 0x06, 0x41, 0x08, 0x4D, 0x73, 0xF3,
+    0xAC, 0xF3, 0xAC, 0x2C, 0x73, 0x62, 0x08, 0x49, 0x29, 0x99, 0x4A, 0x29, 0x07, 0x49, 0x29, 0x62,
+    0x08, 0x4D, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0x41, 0x10, 0x02, 0xE8, 0x8C, 0x03, 0xF8,
+    0x04, 0x02, 0xD8, 0x01, 0x58, 0x00, 0x08, 0x00, 0x10, 0x00, 0x08, 0x82, 0x00, 0x00, 0x82, 0x00,
+    0x08, 0x01, 0x01, 0x68, 0x02, 0xE0, 0x8C, 0x03, 0xF8, 0x06, 0x02, 0xE0, 0x41, 0x08, 0xAE, 0x83,
+    0xF3, 0xAC, 0xF3, 0xAC, 0xCB, 0x62, 0x82, 0x10, 0x9A, 0x4A, 0x29, 0x06, 0x49, 0x29, 0x41, 0x08,
+    0xAE, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0xEB, 0x62, 0x61, 0x08, 0x8D, 0x00, 0x00, 0x0C, 0x24, 0x21,
+    0x34, 0x95, 0xFF, 0xDF, 0xDB, 0xBE, 0xB2, 0x84, 0xAE, 0x6B, 0x2C, 0x5B, 0xEF, 0x6B, 0x14, 0x8D,
+    0x5D, 0xCF, 0x9E, 0xD7, 0x10, 0x74, 0xA2, 0x10, 0x8D, 0x00, 0x00, 0x05, 0x20, 0x00, 0x10, 0x8C,
+    0xF3, 0xAC, 0xF3, 0xAC, 0x69, 0x52, 0xA3, 0x10, 0x8B, 0x4A, 0x29, 0x8B, 0x4A, 0x29, 0x06, 0xE6,
+    0x18, 0xA2, 0x10, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x65, 0x39, 0x21, 0x58, 0x8E, 0x03, 0xF8,
+    0x08, 0x03, 0xF0, 0x02, 0xA8, 0x01, 0x60, 0x00, 0x40, 0x00, 0x28, 0x00, 0x38, 0x01, 0x58, 0x01,
+    0x90, 0x02, 0xE0, 0x8E, 0x03, 0xF8, 0x06, 0x01, 0x90, 0x82, 0x18, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3,
+    0xAC, 0x86, 0x31, 0xA4, 0x10, 0x9B, 0x4A, 0x29, 0x01, 0xC5, 0x18, 0xE3, 0x18, 0x82, 0xF3, 0xAC,
+    0x01, 0x04, 0x21, 0x20, 0x00, 0x8E, 0x00, 0x00, 0x08, 0xA2, 0x10, 0xCB, 0x5A, 0xD3, 0x9C, 0x96,
+    0xB5, 0x59, 0xCE, 0xB6, 0xB5, 0xD3, 0x9C, 0xEB, 0x5A, 0xC3, 0x18, 0x8F, 0x00, 0x00, 0x00, 0xC3,
+    0x18, 0x82, 0xF3, 0xAC, 0x01, 0x24, 0x29, 0xC5, 0x18, 0x9B, 0x4A, 0x29, 0x06, 0xC5, 0x18, 0x45,
+    0x29, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0xC3, 0x20, 0x01, 0x80, 0x8E, 0x03, 0xF8, 0x08, 0x02,
+    0xE8, 0x01, 0x98, 0x01, 0x58, 0x00, 0x38, 0x00, 0x28, 0x00, 0x40, 0x01, 0x60, 0x02, 0xA0, 0x02,
+    0xE8, 0x8E, 0x03, 0xF8, 0x01, 0x21, 0x68, 0x24, 0x29, 0x82, 0xF3, 0xAC, 0x01, 0xE3, 0x18, 0xC5,
+    0x18, 0x9B, 0x4A, 0x29, 0x05, 0xA4, 0x10, 0xA6, 0x39, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0x82,
+    0x10, 0x8F, 0x00, 0x00, 0x08, 0xE3, 0x18, 0x2C, 0x5B, 0xF3, 0x8C, 0xD7, 0xA5, 0x59, 0xB6, 0x96,
+    0x9D, 0xB2, 0x84, 0x8A, 0x4A, 0x82, 0x10, 0x8E, 0x00, 0x00, 0x06, 0x41, 0x08, 0x86, 0x31, 0xF3,
+    0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0xA2, 0x10, 0xE6, 0x18, 0x8B, 0x4A, 0x29, 0x8B, 0x4A, 0x29, 0x07,
+    0x49, 0x29, 0x62, 0x08, 0x0C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0x10, 0x94, 0x41, 0x08, 0x02, 0xB8,
+    0xA4, 0x03, 0xF8, 0x07, 0x02, 0xE8, 0x61, 0x18, 0x0C, 0x6B, 0xF3, 0xAC, 0xF3, 0xAC, 0x10, 0x94,
+    0x20, 0x00, 0x28, 0x21, 0x9B, 0x4A, 0x29, 0x06, 0x49, 0x29, 0x61, 0x08, 0x6D, 0x73, 0xF3, 0xAC,
+    0xF3, 0xAC, 0xCF, 0x83, 0x20, 0x08, 0xA6, 0x00, 0x00, 0x06, 0x41, 0x08, 0x6D, 0x7B, 0xF3, 0xAC,
+    0xF3, 0xAC, 0xAE, 0x83, 0x41, 0x08, 0x28, 0x21, 0x9B, 0x4A, 0x29, 0x07, 0x28, 0x21, 0x41, 0x08,
+    0xCF, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0x41, 0x10, 0x02, 0xD8, 0xA4, 0x03, 0xF8, 0x07,
+    0x02, 0xC8, 0x20, 0x08, 0xAE, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73, 0x61, 0x08, 0x49, 0x29,
+    0x9B, 0x4A, 0x29, 0x06, 0x28, 0x21, 0x20, 0x00, 0x10, 0x94, 0xF3, 0xAC, 0xF3, 0xAC, 0xEB, 0x6A,
+    0x41, 0x08, 0xA6, 0x00, 0x00, 0x06, 0x41, 0x08, 0x10, 0x8C, 0xF3, 0xAC, 0xF3, 0xAC, 0xEB, 0x62,
+    0x62, 0x08, 0x49, 0x29, 0x8B, 0x4A, 0x29, 0x8C, 0x4A, 0x29, 0x07, 0xC5, 0x18, 0xC3, 0x18, 0xD3,
+    0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x28, 0x52, 0x41, 0x28, 0x03, 0xF0, 0xA3, 0x03, 0xF8, 0x01, 0x21,
+    0x50, 0x24, 0x29, 0x82, 0xF3, 0xAC, 0x01, 0xA6, 0x39, 0xA4, 0x10, 0x9D, 0x4A, 0x29, 0x01, 0xC5,
+    0x18, 0x04, 0x21, 0x82, 0xF3, 0xAC, 0x01, 0xC7, 0x39, 0x61, 0x08, 0xA4, 0x00, 0x00, 0x01, 0x61,
+    0x08, 0x65, 0x31, 0x82, 0xF3, 0xAC, 0x01, 0x45, 0x29, 0xA4, 0x18, 0x9D, 0x4A, 0x29, 0x01, 0xA4,
+    0x18, 0x65, 0x29, 0x82, 0xF3, 0xAC, 0x01, 0x65, 0x31, 0x41, 0x40, 0xA3, 0x03, 0xF8, 0x07, 0x03,
+    0xF0, 0x41, 0x30, 0xC7, 0x41, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0xE4, 0x20, 0xC5, 0x18, 0x9D,
+    0x4A, 0x29, 0x01, 0xA3, 0x10, 0xC7, 0x39, 0x82, 0xF3, 0xAC, 0x01, 0x04, 0x21, 0x41, 0x08, 0xA4,
+    0x00, 0x00, 0x06, 0x61, 0x08, 0x49, 0x4A, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0xC3, 0x18, 0xC6,
+    0x18, 0x8C, 0x4A, 0x29, 0x8C, 0x4A, 0x29, 0x07, 0x49, 0x29, 0x82, 0x10, 0x8A, 0x5A, 0xF3, 0xAC,
+    0xF3, 0xAC, 0xB2, 0xA4, 0xE3, 0x20, 0x21, 0x58, 0xA2, 0x03, 0xF8, 0x07, 0x01, 0x90, 0x61, 0x10,
+    0x10, 0x94, 0xF3, 0xAC, 0xF3, 0xAC, 0xAE, 0x83, 0x41, 0x08, 0x28, 0x21, 0x9D, 0x4A, 0x29, 0x07,
+    0x49, 0x29, 0x62, 0x08, 0xEB, 0x6A, 0xF3, 0xAC, 0xF3, 0xAC, 0x92, 0xA4, 0xA2, 0x18, 0x20, 0x00,
+    0xA2, 0x00, 0x00, 0x07, 0x20, 0x00, 0x82, 0x10, 0x71, 0x9C, 0xF3, 0xAC, 0xF3, 0xAC, 0x4D, 0x73,
+    0x61, 0x08, 0x28, 0x21, 0x9D, 0x4A, 0x29, 0x07, 0x28, 0x21, 0x41, 0x08, 0x4D, 0x73, 0xF3, 0xAC,
+    0xF3, 0xAC, 0x71, 0x9C, 0x82, 0x10, 0x01, 0x80, 0xA2, 0x03, 0xF8, 0x07, 0x01, 0x68, 0xA2, 0x18,
+    0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xEB, 0x62, 0x62, 0x08, 0x49, 0x29, 0x9D, 0x4A, 0x29, 0x06,
+    0x28, 0x21, 0x41, 0x08, 0xAE, 0x83, 0xF3, 0xAC, 0xF3, 0xAC, 0x30, 0x94, 0x61, 0x08, 0xA3, 0x00,
+    0x00, 0x07, 0x41, 0x08, 0xE3, 0x18, 0xB2, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0x8A, 0x5A, 0x82, 0x10,
+    0x49, 0x29, 0x8C, 0x4A, 0x29, 0x8D, 0x4A, 0x29, 0x07, 0xE7, 0x20, 0x61, 0x08, 0x51, 0x94, 0xF3,
+    0xAC, 0xF3, 0xAC, 0x10, 0x94, 0x61, 0x10, 0x01, 0x88, 0xA0, 0x03, 0xF8, 0x07, 0x02, 0xB8, 0x41,
+    0x10, 0x2C, 0x73, 0xF3, 0xAC, 0xF3, 0xAC, 0xD3, 0xAC, 0xE3, 0x18, 0xC5, 0x18, 0x9F, 0x4A, 0x29,
+    0x06, 0xE6, 0x18, 0x82, 0x10, 0x92, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0xCF, 0x83, 0x41, 0x08, 0xA2,
+    0x00, 0x00, 0x06, 0x41, 0x08, 0x8E, 0x7B, 0xF3, 0xAC, 0xF3, 0xAC, 0xB2, 0xA4, 0xA2, 0x10, 0xC5,
+    0x18, 0x9F, 0x4A, 0x29, 0x07, 0xC5, 0x18, 0xA2, 0x18, 0xB2, 0xA4, 0xF3, 0xAC, 0xF3, 0xAC, 0x6D,
+    0x7B, 0x41, 0x08, 0x02, 0xB0, 0xA0, 0x03, 0xF8, 0x07, 0x01, 0x98, 0x41, 0x08, 0xEF, 0x8B, 0xF3,
+    0xAC, 0xF3, 0xAC, 0x71, 0x9C, 0x82, 0x10, 0xE6, 0x18, 0x9F, 0x4A, 0x29, 0x06, 0xC5, 0x18, 0xE3,
+    0x18, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC, 0x0C, 0x6B, 0x41, 0x08, 0xA1, 0x00, 0x00, 0x07, 0x20,
+    0x00, 0x61, 0x08, 0x10, 0x94, 0xF3, 0xAC, 0xF3, 0xAC, 0x30, 0x94, 0x61, 0x08, 0x07, 0x21, 0x8D,
+    0x4A, 0x29, 0x8E, 0x4A, 0x29, 0x07, 0xA4, 0x10, 0x24, 0x21, 0xD3, 0xAC, 0xF3, 0xAC, 0xF3, 0xAC,
+    0x6D, 0x7B, 0x41, 0x08, 0x02, 0xA0, 0x9E, 0x03, 0xF8, 0x02, 0x02, 0xC8, 0x41, 0x10, 0x69, 0x52,
+    0x82, 0xF3, 0xAC, 0x02, 0x28, 0x4A, 0x82, 0x10, 0x49, 0x29, 0x9F, 0x4A, 0x29, 0x02, 0x49, 0x29,
+    0xA3, 0x10, 0x65, 0x31, 0x82, 0xF3, 0xAC, 0x01, 0x2C, 0x6B, 0x41, 0x08, 0xA0, 0x00, 0x00, 0x01,
+    0x41, 0x08, 0xCB, 0x62, 0x82, 0xF3, 0xAC, 0x02, 0xA7, 0x39, 0x82, 0x10, 0x49, 0x29, 0x9F, 0x4A,
+    0x29, 0x02, 0x49, 0x29, 0x82, 0x10, 0xC7, 0x39, 0x82, 0xF3, 0xAC, 0x02, 0xCB, 0x62, 0x41, 0x10,
+    0x02, 0xC0, 0x9E, 0x03, 0xF8, 0x02, 0x02, 0xB0, 0x41, 0x08, 0x2C, 0x73, 0x82, 0xF3, 0xAC, 0x01,
+    0x65, 0x31, 0xA3, 0x10, 0xA0, 0x4A, 0x29, 0x02, 0x49, 0x29, 0x82, 0x10, 0x28, 0x4A, 0x82, 0xF3,
+    0xAC, 0x01, 0x69, 0x52, 0x61, 0x08, 0xA0, 0x00, 0x00, 0x06, 0x41, 0x08, 0x8E, 0x7B, 0xF3, 0xAC,
+    0xF3, 0xAC, 0xD3, 0xAC, 0x04, 0x21, 0xA4, 0x10, 0x8E, 0x4A, 0x29, 0x8E, 0x4A, 0x29, 0x02, 0x49,
+    0x29, 0x82, 0x10, 0x29, 0x4A, 0x82, 0xF3, 0xAC, 0x02, 0x0C, 0x6B, 0x41, 0x08, 0x01, 0x90, 0x9C,
+    0x03, 0xF8, 0x02, 0x02, 0xB8, 0x41, 0x10, 0x08, 0x4A, 0x82, 0xF3, 0xAC, 0x02, 0x4D, 0x73, 0x41,
+    0x08, 0x08, 0x21, 0xA1, 0x4A, 0x29, 0x02, 0x29, 0x21, 0x62, 0x08, 0xAA, 0x5A, 0x82, 0xF3, 0xAC,
+    0x01, 0xCB, 0x62, 0x41, 0x08, 0x9E, 0x00, 0x00, 0x01, 0x41, 0x08, 0x69, 0x52, 0x82, 0xF3, 0xAC,
+    0x02, 0xEB, 0x6A, 0x61, 0x08, 0x28, 0x21, 0xA1, 0x4A, 0x29, 0x02, 0x28, 0x21, 0x61, 0x08, 0x0C,
+    0x6B, 0x82, 0xF3, 0xAC, 0x02, 0x69, 0x52, 0x41, 0x10, 0x02, 0xB0, 0x9C, 0x03, 0xF8, 0x02, 0x02,
+    0xA0, 0x41, 0x08, 0xCB, 0x62, 0x82, 0xF3, 0xAC, 0x02, 0x8A, 0x5A, 0x62, 0x08, 0x29, 0x21, 0xA1,
+    0x4A, 0x29, 0x02, 0x08, 0x21, 0x41, 0x08, 0x6D, 0x73, 0x82, 0xF3, 0xAC, 0x01, 0x08, 0x42, 0x41,
+    0x08, 0x9E, 0x00, 0x00, 0x01, 0x41, 0x08, 0x2C, 0x6B, 0x82, 0xF3, 0xAC, 0x02, 0x28, 0x4A, 0x82,
+    0x10, 0x49, 0x29, 0x8E, 0x4A, 0x29, 0x8F, 0x4A, 0x29, 0x02, 0x07, 0x21, 0x41, 0x08, 0xEB, 0x62,
+    0x82, 0xF3, 0xAC, 0x03, 0x4D, 0x73, 0x41, 0x08, 0x01, 0x68, 0x03, 0xF0, 0x99, 0x03, 0xF8, 0x02,
+    0x01, 0x98, 0x41, 0x10, 0x69, 0x52, 0x82, 0xF3, 0xAC, 0x02, 0xEF, 0x8B, 0x61, 0x08, 0xE6, 0x18,
+    0xA3, 0x4A, 0x29, 0x02, 0x07, 0x21, 0x41, 0x08, 0x4D, 0x73, 0x82, 0xF3, 0xAC, 0x02, 0x0C, 0x6B,
+    0x41, 0x08, 0x20, 0x00, 0x9A, 0x00, 0x00, 0x02, 0x20, 0x00, 0x41, 0x08, 0xCB, 0x62, 0x82, 0xF3,
+    0xAC, 0x02, 0x8E, 0x7B, 0x41, 0x08, 0xE6, 0x18, 0xA3, 0x4A, 0x29, 0x02, 0xE6, 0x18, 0x41, 0x08,
+    0x8E, 0x7B, 0x82, 0xF3, 0xAC, 0x02, 0xAA, 0x5A, 0x41, 0x08, 0x01, 0x88, 0x9A, 0x03, 0xF8, 0x02,
+    0x01, 0x78, 0x41, 0x08, 0x0C, 0x6B, 0x82, 0xF3, 0xAC, 0x02, 0x4D, 0x73, 0x41, 0x08, 0x07, 0x21,
+    0xA3, 0x4A, 0x29, 0x02, 0xE6, 0x18, 0x61, 0x08, 0xEF, 0x8B, 0x82, 0xF3, 0xAC, 0x01, 0x49, 0x52,
+    0x41, 0x08, 0x9B, 0x00, 0x00, 0x02, 0x41, 0x08, 0x41, 0x08, 0x6D, 0x73, 0x82, 0xF3, 0xAC, 0x02,
+    0xEB, 0x62, 0x41, 0x08, 0x08, 0x21, 0x8F, 0x4A, 0x29, 0x90, 0x4A, 0x29, 0x02, 0xE7, 0x20, 0x41,
+    0x08, 0x4D, 0x73, 0x82, 0xF3, 0xAC, 0x03, 0xCF, 0x83, 0xA2, 0x18, 0x61, 0x38, 0x02, 0xD0, 0x96,
+    0x03, 0xF8, 0x03, 0x02, 0xE8, 0x21, 0x58, 0x61, 0x10, 0x2C, 0x6B, 0x82, 0xF3, 0xAC, 0x02, 0x10,
+    0x94, 0x82, 0x10, 0xC5, 0x18, 0xA5, 0x4A, 0x29, 0x02, 0xE6, 0x18, 0x41, 0x08, 0xAE, 0x7B, 0x82,
+    0xF3, 0xAC, 0x02, 0x8E, 0x7B, 0x82, 0x10, 0x61, 0x08, 0x98, 0x00, 0x00, 0x02, 0x41, 0x08, 0x61,
+    0x10, 0x6D, 0x7B, 0x82, 0xF3, 0xAC, 0x02, 0xEF, 0x8B, 0x61, 0x08, 0xC5, 0x18, 0xA5, 0x4A, 0x29,
+    0x02, 0xC5, 0x18, 0x61, 0x08, 0xEF, 0x8B, 0x82, 0xF3, 0xAC, 0x03, 0x4D, 0x73, 0x61, 0x10, 0x41,
+    0x48, 0x02, 0xE0, 0x96, 0x03, 0xF8, 0x03, 0x02, 0xD8, 0x41, 0x40, 0x82, 0x18, 0xAE, 0x83, 0x82,
+    0xF3, 0xAC, 0x02, 0xAE, 0x7B, 0x41, 0x08, 0xE6, 0x18, 0xA5, 0x4A, 0x29, 0x02, 0xC5, 0x18, 0x82,
+    0x10, 0x10, 0x94, 0x82, 0xF3, 0xAC, 0x02, 0x0C, 0x6B, 0x61, 0x08, 0x41, 0x08, 0x98, 0x00, 0x00,
+    0x02, 0x61, 0x08, 0xA2, 0x18, 0xEF, 0x8B, 0x82, 0xF3, 0xAC, 0x02, 0x4D, 0x73, 0x41, 0x08, 0xE7,
+    0x20, 0x90, 0x4A, 0x29, 0x91, 0x4A, 0x29, 0x02, 0xE6, 0x18, 0x41, 0x08, 0x0C, 0x6B, 0x82, 0xF3,
+    0xAC, 0x04, 0x92, 0xA4, 0xA6, 0x39, 0x41, 0x08, 0x01, 0x70, 0x02, 0xE8, 0x92, 0x03, 0xF8, 0x04,
+    0x03, 0xF0, 0x01, 0x90, 0x41, 0x10, 0x04, 0x29, 0x10, 0x94, 0x82, 0xF3, 0xAC, 0x02, 0xEF, 0x8B,
+    0x82, 0x10, 0xA4, 0x18, 0xA7, 0x4A, 0x29, 0x02, 0xC5, 0x18, 0x41, 0x08, 0x6D, 0x73, 0x82, 0xF3,
+    0xAC, 0x03, 0x71, 0x9C, 0x65, 0x31, 0x41, 0x08, 0x20, 0x00, 0x95, 0x00, 0x00, 0x02, 0x41, 0x08,
+    0x24, 0x29, 0x51, 0x9C, 0x82, 0xF3, 0xAC, 0x02, 0xAE, 0x83, 0x61, 0x08, 0xC5, 0x18, 0xA7, 0x4A,
+    0x29, 0x02, 0xC5, 0x18, 0x61, 0x08, 0xAE, 0x83, 0x82, 0xF3, 0xAC, 0x04, 0x51, 0x94, 0x24, 0x29,
+    0x41, 0x10, 0x01, 0x88, 0x03, 0xF0, 0x92, 0x03, 0xF8, 0x04, 0x03, 0xE8, 0x01, 0x78, 0x41, 0x10,
+    0x65, 0x39, 0x71, 0x9C, 0x82, 0xF3, 0xAC, 0x02, 0x4D, 0x73, 0x41, 0x08, 0xC5, 0x18, 0xA7, 0x4A,
+    0x29, 0x02, 0xA4, 0x10, 0x82, 0x10, 0xEF, 0x8B, 0x82, 0xF3, 0xAC, 0x02, 0x10, 0x94, 0x04, 0x21,
+    0x61, 0x08, 0x95, 0x00, 0x00, 0x03, 0x20, 0x00, 0x20, 0x00, 0xA6, 0x39, 0x92, 0xA4, 0x82, 0xF3,
+    0xAC, 0x02, 0x0C, 0x6B, 0x41, 0x08, 0xE6, 0x18, 0x91, 0x4A, 0x29, 0x92, 0x4A, 0x29, 0x02, 0xE6,
+    0x18, 0x41, 0x08, 0x8A, 0x5A, 0x83, 0xF3, 0xAC, 0x04, 0x8E, 0x7B, 0xE3, 0x20, 0x41, 0x10, 0x01,
+    0x70, 0x02, 0xD8, 0x8E, 0x03, 0xF8, 0x04, 0x02, 0xE8, 0x01, 0x88, 0x61, 0x20, 0x82, 0x10, 0xEB,
+    0x62, 0x83, 0xF3, 0xAC, 0x02, 0x6D, 0x73, 0x61, 0x08, 0xC5, 0x18, 0xA9, 0x4A, 0x29, 0x02, 0xE6,
+    0x18, 0x41, 0x08, 0xEB, 0x62, 0x83, 0xF3, 0xAC, 0x03, 0x4D, 0x73, 0xC3, 0x18, 0x61, 0x08, 0x20,
+    0x00, 0x91, 0x00, 0x00, 0x02, 0x61, 0x08, 0xA2, 0x10, 0x2C, 0x6B, 0x83, 0xF3, 0xAC, 0x02, 0x0C,
+    0x6B, 0x41, 0x08, 0xC5, 0x18, 0xA9, 0x4A, 0x29, 0x02, 0xC5, 0x18, 0x41, 0x08, 0x2C, 0x73, 0x83,
+    0xF3, 0xAC, 0x04, 0x0C, 0x6B, 0xA2, 0x18, 0x61, 0x18, 0x01, 0x80, 0x02, 0xE0, 0x8E, 0x03, 0xF8,
+    0x04, 0x02, 0xD8, 0x01, 0x78, 0x61, 0x10, 0xC3, 0x20, 0x6D, 0x73, 0x83, 0xF3, 0xAC, 0x02, 0xCB,
+    0x62, 0x41, 0x08, 0xE6, 0x18, 0xA9, 0x4A, 0x29, 0x02, 0xC5, 0x18, 0x61, 0x08, 0x6D, 0x7B, 0x82,
+    0xF3, 0xAC, 0x03, 0xD3, 0xAC, 0xEB, 0x62, 0x82, 0x10, 0x61, 0x08, 0x92, 0x00, 0x00, 0x02, 0x41,
+    0x08, 0xE3, 0x18, 0xAE, 0x7B, 0x83, 0xF3, 0xAC, 0x02, 0x6A, 0x5A, 0x41, 0x08, 0xE6, 0x20, 0x92,
+    0x4A, 0x29, 0x93, 0x4A, 0x29, 0x03, 0x07, 0x21, 0x62, 0x08, 0x65, 0x31, 0x92, 0xA4, 0x83, 0xF3,
+    0xAC, 0x06, 0x4D, 0x73, 0x04, 0x29, 0x00, 0x00, 0x61, 0x38, 0x01, 0x80, 0x02, 0xC0, 0x03, 0xF0,
+    0x87, 0x03, 0xF8, 0x06, 0x02, 0xD0, 0x01, 0x90, 0x41, 0x48, 0x41, 0x08, 0xA2, 0x18, 0xCB, 0x62,
+    0xB2, 0xA4, 0x82, 0xF3, 0xAC, 0x03, 0xD3, 0xAC, 0x28, 0x4A, 0x41, 0x08, 0xE6, 0x18, 0xAB, 0x4A,
+    0x29, 0x03, 0xE7, 0x20, 0x61, 0x08, 0xA6, 0x39, 0xB2, 0xA4, 0x82, 0xF3, 0xAC, 0x04, 0xD3, 0xAC,
+    0x0C, 0x6B, 0xE3, 0x20, 0x20, 0x00, 0x61, 0x08, 0x8C, 0x00, 0x00, 0x04, 0x61, 0x08, 0x20, 0x00,
+    0xC3, 0x18, 0xEB, 0x6A, 0xD3, 0xAC, 0x82, 0xF3, 0xAC, 0x03, 0xB2, 0xA4, 0xE7, 0x41, 0x61, 0x08,
+    0xE6, 0x18, 0xAB, 0x4A, 0x29, 0x03, 0xE6, 0x18, 0x41, 0x08, 0xE8, 0x41, 0xB2, 0xAC, 0x82, 0xF3,
+    0xAC, 0x06, 0xD3, 0xAC, 0xEB, 0x6A, 0xC3, 0x20, 0x20, 0x08, 0x41, 0x48, 0x01, 0x88, 0x02, 0xD0,
+    0x88, 0x03, 0xF8, 0x06, 0x02, 0xC8, 0x01, 0x88, 0x41, 0x40, 0x20, 0x08, 0xE3, 0x28, 0x2C, 0x6B,
+    0xD3, 0xAC, 0x82, 0xF3, 0xAC, 0x03, 0xB2, 0xA4, 0xA6, 0x39, 0x61, 0x08, 0x07, 0x21, 0xAB, 0x4A,
+    0x29, 0x03, 0xE6, 0x18, 0x41, 0x08, 0x49, 0x4A, 0xD3, 0xAC, 0x82, 0xF3, 0xAC, 0x04, 0xB2, 0xA4,
+    0xCB, 0x62, 0xA2, 0x18, 0x41, 0x08, 0x61, 0x08, 0x8C, 0x00, 0x00, 0x03, 0x61, 0x08, 0x00, 0x00,
+    0x04, 0x21, 0x4D, 0x73, 0x83, 0xF3, 0xAC, 0x03, 0x71, 0x9C, 0x65, 0x31, 0x62, 0x08, 0x07, 0x21,
+    0x93, 0x4A, 0x29, 0x94, 0x4A, 0x29, 0x03, 0x28, 0x21, 0xA3, 0x10, 0x82, 0x10, 0xEB, 0x6A, 0x84,
+    0xF3, 0xAC, 0x10, 0x30, 0x94, 0x8A, 0x52, 0x04, 0x29, 0x20, 0x08, 0x20, 0x08, 0x61, 0x28, 0x61,
+    0x40, 0x41, 0x50, 0x01, 0x60, 0x41, 0x50, 0x61, 0x48, 0x61, 0x30, 0x41, 0x10, 0x00, 0x00, 0xC3,
+    0x20, 0x28, 0x4A, 0xCF, 0x83, 0x84, 0xF3, 0xAC, 0x03, 0xEF, 0x8B, 0x04, 0x21, 0x62, 0x10, 0x07,
+    0x21, 0xAD, 0x4A, 0x29, 0x03, 0x28, 0x21, 0x83, 0x10, 0xA2, 0x10, 0x0C, 0x6B, 0x84, 0xF3, 0xAC,
+    0x10, 0x10, 0x8C, 0x49, 0x52, 0xE3, 0x20, 0x20, 0x00, 0x41, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41,
+    0x08, 0x00, 0x00, 0x41, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x00, 0x00, 0xE3, 0x18, 0x49,
+    0x4A, 0xEF, 0x8B, 0x84, 0xF3, 0xAC, 0x03, 0xAE, 0x83, 0xE3, 0x18, 0x82, 0x10, 0x28, 0x21, 0xAD,
+    0x4A, 0x29, 0x03, 0x28, 0x21, 0x82, 0x10, 0xC3, 0x18, 0x8E, 0x7B, 0x84, 0xF3, 0xAC, 0x10, 0xEF,
+    0x8B, 0x49, 0x4A, 0xE3, 0x20, 0x00, 0x00, 0x41, 0x10, 0x61, 0x28, 0x61, 0x48, 0x41, 0x50, 0x01,
+    0x60, 0x41, 0x50, 0x61, 0x40, 0x61, 0x28, 0x41, 0x08, 0x20, 0x08, 0x04, 0x29, 0x69, 0x52, 0x10,
+    0x8C, 0x84, 0xF3, 0xAC, 0x03, 0x6D, 0x7B, 0xA3, 0x18, 0x83, 0x10, 0x28, 0x21, 0xAD, 0x4A, 0x29,
+    0x03, 0x08, 0x21, 0x82, 0x10, 0xE4, 0x20, 0xCF, 0x83, 0x84, 0xF3, 0xAC, 0x08, 0xCF, 0x83, 0x08,
+    0x4A, 0xC3, 0x18, 0x00, 0x00, 0x41, 0x08, 0x61, 0x08, 0x61, 0x08, 0x41, 0x08, 0x00, 0x00, 0x82,
+    0x61, 0x08, 0x04, 0x20, 0x00, 0x20, 0x08, 0x04, 0x21, 0x8A, 0x5A, 0x30, 0x94, 0x84, 0xF3, 0xAC,
+    0x03, 0x4D, 0x73, 0x82, 0x10, 0xA3, 0x10, 0x29, 0x21, 0x94, 0x4A, 0x29, 0x95, 0x4A, 0x29, 0x04,
+    0x49, 0x29, 0xE6, 0x18, 0x61, 0x08, 0x45, 0x29, 0xCF, 0x83, 0x85, 0xF3, 0xAC, 0x0A, 0xB2, 0xA4,
+    0xCF, 0x83, 0x0C, 0x6B, 0x8A, 0x5A, 0x49, 0x52, 0x08, 0x42, 0x49, 0x4A, 0x8A, 0x5A, 0xEB, 0x62,
+    0xAE, 0x83, 0x71, 0x9C, 0x85, 0xF3, 0xAC, 0x04, 0x30, 0x94, 0xC7, 0x41, 0x41, 0x08, 0xC4, 0x18,
+    0x49, 0x29, 0xAF, 0x4A, 0x29, 0x04, 0x49, 0x29, 0xC5, 0x18, 0x41, 0x08, 0x65, 0x31, 0xEF, 0x8B,
+    0x85, 0xF3, 0xAC, 0x0A, 0x92, 0xA4, 0xCF, 0x83, 0x0C, 0x6B, 0x8A, 0x5A, 0x49, 0x52, 0x08, 0x42,
+    0x49, 0x52, 0x8A, 0x5A, 0x0C, 0x6B, 0xAE, 0x83, 0x92, 0xA4, 0x85, 0xF3, 0xAC, 0x04, 0x10, 0x8C,
+    0xA6, 0x39, 0x41, 0x08, 0xC5, 0x18, 0x49, 0x29, 0xAF, 0x4A, 0x29, 0x04, 0x49, 0x29, 0xC5, 0x18,
+    0x41, 0x08, 0xA6, 0x39, 0x10, 0x94, 0x85, 0xF3, 0xAC, 0x0A, 0x92, 0xA4, 0xAE, 0x83, 0x0C, 0x6B,
+    0x8A, 0x5A, 0x49, 0x52, 0x08, 0x42, 0x49, 0x52, 0x8A, 0x5A, 0x0C, 0x6B, 0xCF, 0x83, 0x92, 0xA4,
+    0x85, 0xF3, 0xAC, 0x04, 0xEF, 0x8B, 0x65, 0x31, 0x41, 0x08, 0xC5, 0x18, 0x49, 0x29, 0xAF, 0x4A,
+    0x29, 0x04, 0x49, 0x29, 0xC4, 0x18, 0x41, 0x08, 0xE7, 0x41, 0x30, 0x94, 0x85, 0xF3, 0xAC, 0x0A,
+    0x71, 0x9C, 0xAE, 0x83, 0xEB, 0x62, 0x8A, 0x5A, 0x49, 0x4A, 0x08, 0x42, 0x49, 0x52, 0x8A, 0x5A,
+    0x0C, 0x6B, 0xEF, 0x8B, 0xB2, 0xA4, 0x85, 0xF3, 0xAC, 0x04, 0xAE, 0x83, 0x25, 0x29, 0x61, 0x08,
+    0xE6, 0x18, 0x49, 0x29, 0x95, 0x4A, 0x29, 0x97, 0x4A, 0x29, 0x05, 0x29, 0x21, 0xA4, 0x10, 0x41,
+    0x08, 0x25, 0x29, 0x4D, 0x73, 0xD3, 0xAC, 0x91, 0xF3, 0xAC, 0x04, 0xCF, 0x83, 0xC7, 0x39, 0x20,
+    0x00, 0xA3, 0x10, 0x08, 0x21, 0xB3, 0x4A, 0x29, 0x05, 0x28, 0x21, 0xA4, 0x10, 0x20, 0x00, 0x65,
+    0x31, 0x8E, 0x7B, 0xD3, 0xAC, 0x91, 0xF3, 0xAC, 0x04, 0xAE, 0x83, 0x86, 0x31, 0x20, 0x00, 0xA4,
+    0x10, 0x28, 0x21, 0xB3, 0x4A, 0x29, 0x04, 0x28, 0x21, 0xA4, 0x10, 0x20, 0x00, 0xA6, 0x39, 0xAE,
+    0x83, 0x91, 0xF3, 0xAC, 0x05, 0xD3, 0xAC, 0x6D, 0x7B, 0x65, 0x31, 0x41, 0x08, 0xA4, 0x10, 0x28,
+    0x21, 0xB3, 0x4A, 0x29, 0x04, 0x08, 0x21, 0xA3, 0x10, 0x41, 0x08, 0xC7, 0x39, 0xCF, 0x83, 0x91,
+    0xF3, 0xAC, 0x05, 0xD3, 0xAC, 0x4D, 0x73, 0x25, 0x29, 0x41, 0x08, 0xC4, 0x18, 0x29, 0x29, 0x97,
+    0x4A, 0x29, 0x99, 0x4A, 0x29, 0x06, 0x28, 0x21, 0xC4, 0x18, 0x61, 0x08, 0x82, 0x10, 0x08, 0x4A,
+    0x6D, 0x73, 0x92, 0xA4, 0x8A, 0xF3, 0xAC, 0x06, 0xD3, 0xAC, 0xAE, 0x83, 0x69, 0x52, 0xC3, 0x18,
+    0x41, 0x08, 0xA4, 0x10, 0x08, 0x21, 0xB7, 0x4A, 0x29, 0x06, 0x28, 0x21, 0xC4, 0x10, 0x61, 0x08,
+    0x82, 0x10, 0x28, 0x4A, 0x6D, 0x7B, 0xB2, 0xA4, 0x8A, 0xF3, 0xAC, 0x06, 0xB2, 0xA4, 0x8E, 0x7B,
+    0x49, 0x4A, 0xA2, 0x10, 0x41, 0x08, 0xA4, 0x10, 0x28, 0x21, 0xB7, 0x4A, 0x29, 0x06, 0x28, 0x21,
+    0xA4, 0x10, 0x41, 0x08, 0xA2, 0x10, 0x49, 0x52, 0x8E, 0x7B, 0xB2, 0xA4, 0x8A, 0xF3, 0xAC, 0x06,
+    0xB2, 0xA4, 0x6D, 0x7B, 0x28, 0x4A, 0x82, 0x10, 0x61, 0x08, 0xA4, 0x18, 0x28, 0x21, 0xB7, 0x4A,
+    0x29, 0x06, 0x08, 0x21, 0xA4, 0x10, 0x41, 0x08, 0xC3, 0x18, 0x69, 0x52, 0xAE, 0x83, 0xD3, 0xAC,
+    0x8A, 0xF3, 0xAC, 0x06, 0x92, 0xA4, 0x4D, 0x73, 0x08, 0x42, 0x82, 0x10, 0x61, 0x08, 0xC4, 0x18,
+    0x28, 0x21, 0x99, 0x4A, 0x29, 0x9B, 0x4A, 0x29, 0x14, 0x49, 0x29, 0xE7, 0x20, 0xA4, 0x10, 0x62,
+    0x08, 0x20, 0x00, 0xE3, 0x18, 0xA6, 0x39, 0x69, 0x52, 0xCB, 0x62, 0x0C, 0x6B, 0x4D, 0x73, 0x0C,
+    0x6B, 0xEB, 0x62, 0x8A, 0x5A, 0xC7, 0x39, 0x04, 0x21, 0x61, 0x08, 0x41, 0x08, 0xA3, 0x10, 0xE6,
+    0x18, 0x49, 0x29, 0xBB, 0x4A, 0x29, 0x14, 0x49, 0x29, 0xE6, 0x18, 0xA4, 0x10, 0x61, 0x08, 0x41,
+    0x08, 0xE3, 0x20, 0xA6, 0x39, 0x69, 0x52, 0xCB, 0x62, 0x0C, 0x6B, 0x4D, 0x73, 0x0C, 0x6B, 0xCB,
+    0x62, 0x8A, 0x52, 0xA6, 0x39, 0xE4, 0x20, 0x41, 0x08, 0x61, 0x08, 0xA3, 0x10, 0xE6, 0x18, 0x49,
+    0x29, 0xBB, 0x4A, 0x29, 0x14, 0x49, 0x29, 0xE6, 0x18, 0xA3, 0x10, 0x61, 0x08, 0x41, 0x08, 0xE4,
+    0x20, 0xA6, 0x39, 0x8A, 0x52, 0xCB, 0x62, 0x0C, 0x6B, 0x4D, 0x73, 0x0C, 0x6B, 0xCB, 0x62, 0x69,
+    0x52, 0xA6, 0x39, 0xE3, 0x20, 0x41, 0x08, 0x61, 0x08, 0xA4, 0x10, 0xE6, 0x18, 0x49, 0x29, 0xBB,
+    0x4A, 0x29, 0x14, 0x49, 0x29, 0xE6, 0x18, 0xA3, 0x10, 0x41, 0x08, 0x61, 0x08, 0x04, 0x21, 0xC7,
+    0x39, 0x8A, 0x5A, 0xEB, 0x62, 0x0C, 0x6B, 0x4D, 0x73, 0x0C, 0x6B, 0xCB, 0x62, 0x69, 0x52, 0xA6,
+    0x39, 0xE3, 0x18, 0x20, 0x00, 0x62, 0x08, 0xA4, 0x10, 0xE7, 0x20, 0x49, 0x29, 0x9B, 0x4A, 0x29,
+    0x9F, 0x4A, 0x29, 0x0D, 0x28, 0x21, 0xE6, 0x18, 0xC5, 0x18, 0xA4, 0x10, 0xA3, 0x10, 0x83, 0x10,
+    0x82, 0x10, 0x82, 0x10, 0xA3, 0x10, 0xA3, 0x10, 0xC4, 0x10, 0xE6, 0x18, 0x07, 0x21, 0x49, 0x29,
+    0xC1, 0x4A, 0x29, 0x0E, 0x49, 0x29, 0x08, 0x21, 0xE6, 0x18, 0xC5, 0x18, 0xA4, 0x10, 0xA3, 0x10,
+    0x83, 0x10, 0x82, 0x10, 0x82, 0x10, 0xA3, 0x10, 0xA3, 0x10, 0xC4, 0x10, 0xE6, 0x18, 0x07, 0x21,
+    0x49, 0x29, 0xC1, 0x4A, 0x29, 0x0E, 0x49, 0x29, 0x07, 0x21, 0xE6, 0x18, 0xC4, 0x10, 0xA3, 0x10,
+    0xA3, 0x10, 0x82, 0x10, 0x82, 0x10, 0x83, 0x10, 0xA3, 0x10, 0xA4, 0x10, 0xC5, 0x18, 0xE6, 0x18,
+    0x08, 0x21, 0x49, 0x29, 0xC1, 0x4A, 0x29, 0x0D, 0x49, 0x29, 0x07, 0x21, 0xE6, 0x18, 0xC4, 0x10,
+    0xA3, 0x10, 0xA3, 0x10, 0x82, 0x10, 0x82, 0x10, 0x83, 0x10, 0xA3, 0x10, 0xA4, 0x10, 0xC5, 0x18,
+    0xE6, 0x18, 0x28, 0x21, 0x9F, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xBF, 0x4A, 0x29,
+    0xFF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xBF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xBF,
+    0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xBF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xFF, 0x4A,
+    0x29, 0xBF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xFF, 0x4A, 0x29, 0xBF, 0x4A, 0x29, 0xFF, 0x4A, 0x29,
+    0xFF, 0x4A, 0x29, 0xBF, 0x4A, 0x29
 };
 
 Bitmap bitmaps[] = {
-    { 48, 48, bitmap_pixel_data_logo },
-    { 320, 120, bitmap_pixel_data_bp_coupled }
+    { 48, 48, bitmap_pixel_data_logo, BITMAP_COMPRESSION_RLE },
+    { 320, 120, bitmap_pixel_data_bp_coupled, BITMAP_COMPRESSION_RLE }
 };
 
 // STYLES DEFINITION
@@ -430,10 +430,17 @@ enum PagesEnum {
 
 extern const uint8_t *fonts[];
 
+enum BitmapCompression {
+    BITMAP_COMPRESSION_NONE,
+    /// See compress-gui-bitmaps.py for the format.
+    BITMAP_COMPRESSION_RLE
+};
+
 struct Bitmap {
     uint16_t w;
     uint16_t h;
     const uint8_t *pixels PROGMEM;
+    BitmapCompression compression;
 };
 
 extern Bitmap bitmaps[];
@@ -58,6 +58,9 @@ void drawText(const char *text, int textLength, int x, int y, int w, int h, cons
 void fillRect(int x, int y, int w, int h);
 
 void pushSelectFromEnumPage(const data::EnumItem *enumDefinition, uint8_t currentValue, uint8_t disabledValue, void (*onSet)(uint8_t));
+#if DEBUG_PROFILING
+void pushProfilePage();
+#endif
 
 void infoMessage(data::Value value, void (*ok_callback)() = 0);
 void infoMessageP(const char *message PROGMEM, void (*ok_callback)() = 0);
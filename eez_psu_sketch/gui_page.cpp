@@ -224,6 +224,73 @@ void SelectFromEnumPage::getItemLabel(int itemIndex, char *text, int count) {
     text[count - 1] = 0;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+
+#if DEBUG_PROFILING
+
+ProfilePage::ProfilePage() : firstLine(0), numVisibleLines(0), lastRefreshTime(0) {
+}
+
+void ProfilePage::refresh() {
+    DECL_STYLE(style, STYLE_ID_EDIT_VALUE_S_LEFT);
+
+    int lineHeight = styleGetFont(style).getHeight();
+    int width = lcd::lcd.getDisplayXSize();
+    int height = lcd::lcd.getDisplayYSize();
+
+    char text[64];
+
+    strcpy_P(text, PSTR("Task: min avg max p99 [us]"));
+    drawText(text, -1, 0, 0, width, lineHeight, style, true);
+
+    numVisibleLines = height / lineHeight - 1;
+
+    int y = lineHeight;
+    for (int i = firstLine; i < debug::getNumProfileVariables() && y + lineHeight <= height; ++i, y += lineHeight) {
+        debug::DebugDurationVariable *variable = debug::getProfileVariable(i);
+
+        strcpy(text, variable->name());
+        strcat(text, ": ");
+        variable->dump1sec(text);
+
+        drawText(text, -1, 0, y, width, lineHeight, style, false);
+    }
+
+    if (y < height) {
+        lcd::lcd.setColor(style->background_color);
+        lcd::lcd.fillRect(0, y, width - 1, height - 1);
+    }
+
+    lastRefreshTime = micros();
+}
+
+bool ProfilePage::drawTick() {
+    // statistics are updated once per second
+    if (micros() - lastRefreshTime >= 1000000L) {
+        refresh();
+    }
+    return false;
+}
+
+WidgetCursor ProfilePage::findWidget(int x, int y) {
+    return WidgetCursor(1, x, y, -1, 0, 0);
+}
+
+void ProfilePage::drawWidget(const WidgetCursor &widgetCursor, bool selected) {
+}
+
+ActionType ProfilePage::getAction(const WidgetCursor &widgetCursor) {
+    return ACTION_ID_SHOW_PREVIOUS_PAGE;
+}
+
+bool ProfilePage::onEncoder(int counter) {
+    firstLine = MIN(MAX(firstLine + counter, 0), MAX(debug::getNumProfileVariables() - numVisibleLines, 0));
+    refresh();
+    return true;
+}
+
+#endif
+
 }
 }
 } // namespace eez::psu::gui
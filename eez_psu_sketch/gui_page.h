@@ -100,6 +100,28 @@ private:
     void getItemLabel(int itemIndex, char *text, int count);
 };
 
+#if DEBUG_PROFILING
+/// Execution time of every scheduler task in the last second, same as DEBUG:PROFile?
+/// Opened by the encoder click on the system info page, encoder scrolls the list
+/// and touch anywhere closes it.
+class ProfilePage : public InternalPage {
+public:
+    ProfilePage();
+
+    void refresh();
+    bool drawTick();
+    WidgetCursor findWidget(int x, int y);
+    void drawWidget(const WidgetCursor &widgetCursor, bool selected);
+    ActionType getAction(const WidgetCursor &widgetCursor);
+    bool onEncoder(int counter);
+
+private:
+    int firstLine;
+    int numVisibleLines;
+    uint32_t lastRefreshTime;
+};
+#endif
+
 }
 }
 } // namespace eez::psu::gui
@@ -105,6 +105,13 @@ data::Value SysInfoPage::getData(const data::Cursor &cursor, uint8_t id) {
 	return data::Value();
 }
 
+#if DEBUG_PROFILING
+bool SysInfoPage::onEncoderClicked() {
+	pushProfilePage();
+	return true;
+}
+#endif
+
 }
 }
 } // namespace eez::psu::gui
@@ -27,6 +27,9 @@ namespace gui {
 class SysInfoPage: public Page {
 public:
 	data::Value getData(const data::Cursor &cursor, uint8_t id);
+#if DEBUG_PROFILING
+	bool onEncoderClicked();
+#endif
 };
 
 }
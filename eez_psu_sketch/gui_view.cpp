@@ -30,12 +30,16 @@
 #include "front_panel/control.h"
 #endif
 
-#define CONF_GUI_ENUM_WIDGETS_STACK_SIZE 5
+#define CONF_GUI_ENUM_WIDGETS_STACK_SIZE 8
 #define CONF_GUI_BLINK_TIME 400000UL // 400ms
 #define CONF_GUI_YT_GRAPH_BLANK_PIXELS_AFTER_CURSOR 10
 
 #define CONF_MAX_STATE_SIZE 2048
 
+#if GUI_DRAW_LIST_SIZE > 256
+#error "Hit test grid stores draw list item indexes as uint8_t"
+#endif
+
 namespace eez {
 namespace psu {
 namespace gui {
@@ -333,7 +337,11 @@ void drawBitmap(uint8_t bitmapIndex, int x, int y, int w, int h, const Style *st
         lcd::lcd.setBackColor(style->background_color);
         lcd::lcd.setColor(style->color);
     }
-    lcd::lcd.drawBitmap(x_offset, y_offset, width, height, (bitmapdatatype)bitmap.pixels, 1);
+    if (bitmap.compression == BITMAP_COMPRESSION_RLE) {
+        lcd::lcd.drawRleBitmap(x_offset, y_offset, width, height, bitmap.pixels);
+    } else {
+        lcd::lcd.drawBitmap(x_offset, y_offset, width, height, (bitmapdatatype)bitmap.pixels, 1);
+    }
 }
 
 void drawRectangle(int x, int y, int w, int h, const Style *style, bool inverse) {
@@ -1636,141 +1644,656 @@ WidgetState *next(WidgetState *p) {
     return p ? (WidgetState *)(((uint8_t *)p) + p->size) : 0;
 }
 
-void enumWidget(OBJ_OFFSET widgetOffset, int x, int y, data::Cursor &cursor, WidgetState *previousState, WidgetState *currentState, EnumWidgetsCallback callback);
+enum DrawListOp {
+    /// Leaf widget.
+    DRAW_LIST_OP_WIDGET,
+    /// Container, custom or list widget, its children follow until the matching DRAW_LIST_OP_END.
+    DRAW_LIST_OP_BEGIN,
+    /// Select widget, its selected child follows until the matching DRAW_LIST_OP_END.
+    DRAW_LIST_OP_SELECT,
+    DRAW_LIST_OP_END
+};
+
+struct DrawListItem {
+    uint8_t op;
+    uint8_t type;
+    uint8_t data;
+    OBJ_OFFSET widgetOffset;
+    int16_t x;
+    int16_t y;
+    uint16_t w;
+    uint16_t h;
+    data::Cursor cursor;
+    /// Selected index for the select widget, number of items for the list widget.
+    /// Draw list has to be compiled again when it changes.
+    data::Value value;
+};
+
+/// Widgets of the page in the enumeration order, with the absolute positions and data cursors resolved.
+/// It is compiled when the page is activated and then used instead of walking the document every frame,
+/// until the selected widget of some select widget or the number of items of some list widget changes.
+class DrawList {
+public:
+    DrawList() : m_pageId(-1) {}
+
+    /// Compile draw list again if page is changed or page structure is not the same anymore.
+    /// \returns false if draw list can't be used for the page (too many widgets).
+    bool validate(int pageId);
+
+    int getNumItems() { return m_numItems; }
+    const DrawListItem &getItem(int i) { return m_items[i]; }
+
+    /// Find the last leaf widget which contains the point.
+    /// \returns index of the draw list item or -1 if there is no such widget.
+    int findWidgetItem(int x, int y);
+
+    void add(uint8_t op, OBJ_OFFSET widgetOffset, const Widget *widget, int x, int y, const data::Cursor &cursor, const data::Value &value);
+
+private:
+    DrawListItem m_items[GUI_DRAW_LIST_SIZE];
+    int m_numItems;
+    int m_pageId;
+    bool m_overflow;
+
+    /// Uniform grid over the display used for hit testing. Items of the cell i
+    /// are m_gridItems[m_gridCellFirst[i]] .. m_gridItems[m_gridCellFirst[i + 1] - 1],
+    /// in the draw list order.
+    int m_gridColumns;
+    int m_gridRows;
+    uint16_t m_gridCellFirst[GUI_HIT_GRID_MAX_CELLS + 1];
+    uint8_t m_gridItems[GUI_HIT_GRID_SIZE];
+    bool m_gridOverflow;
+
+    void compile(int pageId);
+    bool isStructureChanged();
+    bool getGridCells(const DrawListItem &item, int &column1, int &row1, int &column2, int &row2);
+    void buildGrid();
+};
+
+static DrawList g_drawList;
+
+/// Enumerates leaf widgets of the page, depth first.
+/// Explicit stack is used instead of recursion, so that enumeration
+/// can be suspended after any widget and resumed later (see drawTick).
+class WidgetIterator {
+public:
+    /// \param drawList If set, all the enumerated widgets are added to it.
+    void begin(int pageIndex, WidgetState *previousState, WidgetState *currentState, DrawList *drawList = 0);
+
+    /// Move to the next leaf widget.
+    /// \returns false if there are no more widgets.
+    bool next(WidgetCursor &widgetCursor);
+
+private:
+    /// Container, custom, list or select widget whose children are being enumerated.
+    struct Frame {
+        OBJ_OFFSET widgetOffset;
+        uint8_t type;
+        int x;
+        int y;
+        int index;
+        int xOffset;
+        int yOffset;
+        WidgetState *previousState;
+        WidgetState *currentState;
+        WidgetState *savedCurrentState;
+        WidgetState *endOfContainerInPreviousState;
+    };
+
+    Frame m_stack[CONF_GUI_ENUM_WIDGETS_STACK_SIZE];
+    int m_depth;
+    data::Cursor m_cursor;
+    DrawList *m_drawList;
+
+    /// Widget to be entered on the next call to next().
+    bool m_hasPending;
+    OBJ_OFFSET m_pendingWidgetOffset;
+    int m_pendingX;
+    int m_pendingY;
+    WidgetState *m_pendingPreviousState;
+    WidgetState *m_pendingCurrentState;
+
+    void setPending(OBJ_OFFSET widgetOffset, int x, int y, WidgetState *previousState, WidgetState *currentState);
+    bool enter(WidgetCursor &widgetCursor);
+    Frame *push(OBJ_OFFSET widgetOffset, uint8_t type, int x, int y, WidgetState *previousState, WidgetState *currentState);
+    bool nextChild(Frame &frame);
+    void leaveChild(Frame &frame);
+    void leave(Frame &frame);
+};
+
+void WidgetIterator::begin(int pageIndex, WidgetState *previousState, WidgetState *currentState, DrawList *drawList) {
+    m_depth = 0;
+    m_cursor.reset();
+    m_drawList = drawList;
+    setPending(getPageOffset(pageIndex), 0, 0, previousState, currentState);
+}
+
+void WidgetIterator::setPending(OBJ_OFFSET widgetOffset, int x, int y, WidgetState *previousState, WidgetState *currentState) {
+    m_hasPending = true;
+    m_pendingWidgetOffset = widgetOffset;
+    m_pendingX = x;
+    m_pendingY = y;
+    m_pendingPreviousState = previousState;
+    m_pendingCurrentState = currentState;
+}
 
-void enumContainer(List widgets, int x, int y, data::Cursor &cursor, WidgetState *previousState, WidgetState *currentState, EnumWidgetsCallback callback) {
-    WidgetState *savedCurrentState = currentState;
+WidgetIterator::Frame *WidgetIterator::push(OBJ_OFFSET widgetOffset, uint8_t type, int x, int y, WidgetState *previousState, WidgetState *currentState) {
+    if (m_depth == CONF_GUI_ENUM_WIDGETS_STACK_SIZE) {
+        DebugTrace("Widgets nested too deep, increase CONF_GUI_ENUM_WIDGETS_STACK_SIZE");
+        return 0;
+    }
 
-    WidgetState *endOfContainerInPreviousState;
-    if (previousState) endOfContainerInPreviousState = next(previousState);
+    Frame &frame = m_stack[m_depth++];
+
+    frame.widgetOffset = widgetOffset;
+    frame.type = type;
+    frame.x = x;
+    frame.y = y;
+    frame.index = 0;
+    frame.xOffset = 0;
+    frame.yOffset = 0;
+    frame.savedCurrentState = currentState;
+
+    if (previousState) frame.endOfContainerInPreviousState = gui::next(previousState);
 
     // move to the first child widget state
-    if (previousState) ++previousState;
-    if (currentState) ++currentState;
+    frame.previousState = previousState ? previousState + 1 : 0;
+    frame.currentState = currentState ? currentState + 1 : 0;
+
+    return &frame;
+}
+
+/// Enter the pending widget.
+/// \returns true if it is a leaf widget.
+bool WidgetIterator::enter(WidgetCursor &widgetCursor) {
+    m_hasPending = false;
 
-    for (int index = 0; index < widgets.count; ++index) {
-        OBJ_OFFSET childWidgetOffset = getListItemOffset(widgets, index, sizeof(Widget));
-        enumWidget(childWidgetOffset, x, y, cursor, previousState, currentState, callback);
+    OBJ_OFFSET widgetOffset = m_pendingWidgetOffset;
+    WidgetState *previousState = m_pendingPreviousState;
+    WidgetState *currentState = m_pendingCurrentState;
+
+    DECL_WIDGET(widget, widgetOffset);
 
-        if (previousState) {
-            previousState = next(previousState);
-            if (previousState >= endOfContainerInPreviousState) previousState = 0;
+    int x = m_pendingX + widget->x;
+    int y = m_pendingY + widget->y;
+
+    if (widget->type == WIDGET_TYPE_CONTAINER || widget->type == WIDGET_TYPE_CUSTOM || widget->type == WIDGET_TYPE_LIST) {
+        if (push(widgetOffset, widget->type, x, y, previousState, currentState) && m_drawList) {
+            data::Value value;
+            if (widget->type == WIDGET_TYPE_LIST) {
+                value = data::Value(data::count(widget->data));
+            }
+            m_drawList->add(DRAW_LIST_OP_BEGIN, widgetOffset, widget, x, y, m_cursor, value);
         }
-        
-        currentState = next(currentState);
+        return false;
     }
+    
+    if (widget->type == WIDGET_TYPE_SELECT) {
+        data::Value indexValue = data::get(m_cursor, widget->data);
 
-    if (currentState) {
-        savedCurrentState->size = ((uint8_t *)currentState) - ((uint8_t *)savedCurrentState);
+        if (currentState) {
+            currentState->data = indexValue;
+        }
+
+        if (previousState && previousState->data != currentState->data) {
+            previousState = 0;
+        }
+
+        Frame *frame = push(widgetOffset, widget->type, x, y, previousState, currentState);
+        if (frame) {
+            if (m_drawList) {
+                m_drawList->add(DRAW_LIST_OP_SELECT, widgetOffset, widget, x, y, m_cursor, indexValue);
+            }
+
+            int index = indexValue.getInt();
+            data::select(m_cursor, widget->data, index);
+            DECL_WIDGET_SPECIFIC(ContainerWidget, containerWidget, widget);
+            OBJ_OFFSET selectedWidgetOffset = getListItemOffset(containerWidget->widgets, index, sizeof(Widget));
+
+            // selected widget is the only child
+            frame->index = 1;
+            setPending(selectedWidgetOffset, x, y, frame->previousState, frame->currentState);
+        }
+        return false;
+    }
+
+    if (m_drawList) {
+        m_drawList->add(DRAW_LIST_OP_WIDGET, widgetOffset, widget, x, y, m_cursor, data::Value());
     }
+
+    widgetCursor = WidgetCursor(widgetOffset, x, y, m_cursor, previousState, currentState);
+    return true;
 }
 
-void enumWidget(OBJ_OFFSET widgetOffset, int x, int y, data::Cursor &cursor, WidgetState *previousState, WidgetState *currentState, EnumWidgetsCallback callback) {
-    psu::criticalTick();
+/// Make the next child of the frame pending.
+/// \returns false if there are no more children.
+bool WidgetIterator::nextChild(Frame &frame) {
+    DECL_WIDGET(widget, frame.widgetOffset);
 
-    DECL_WIDGET(widget, widgetOffset);
+    if (frame.type == WIDGET_TYPE_CONTAINER || frame.type == WIDGET_TYPE_CUSTOM) {
+        List widgets;
+        if (frame.type == WIDGET_TYPE_CONTAINER) {
+            DECL_WIDGET_SPECIFIC(ContainerWidget, container, widget);
+            widgets = container->widgets;
+        } else {
+            DECL_WIDGET_SPECIFIC(CustomWidgetSpecific, customWidgetSpecific, widget);
+            DECL_CUSTOM_WIDGET(customWidget, customWidgetSpecific->customWidget);
+            widgets = customWidget->widgets;
+        }
 
-    x += widget->x;
-    y += widget->y;
+        if (frame.index >= widgets.count) {
+            return false;
+        }
 
-    if (widget->type == WIDGET_TYPE_CONTAINER) {
-        DECL_WIDGET_SPECIFIC(ContainerWidget, container, widget);
-        enumContainer(container->widgets, x, y, cursor, previousState, currentState, callback);
+        OBJ_OFFSET childWidgetOffset = getListItemOffset(widgets, frame.index++, sizeof(Widget));
+        setPending(childWidgetOffset, frame.x, frame.y, frame.previousState, frame.currentState);
+        return true;
     }
-    else if (widget->type == WIDGET_TYPE_CUSTOM) {
-        DECL_WIDGET_SPECIFIC(CustomWidgetSpecific, customWidgetSpecific, widget);
-        DECL_CUSTOM_WIDGET(customWidget, customWidgetSpecific->customWidget);
-        enumContainer(customWidget->widgets, x, y, cursor, previousState, currentState, callback);
+    
+    if (frame.type == WIDGET_TYPE_LIST) {
+        if (frame.index >= data::count(widget->data)) {
+            return false;
+        }
+
+        data::select(m_cursor, widget->data, frame.index++);
+
+        DECL_WIDGET_SPECIFIC(ListWidget, listWidget, widget);
+        OBJ_OFFSET childWidgetOffset = listWidget->item_widget;
+        DECL_WIDGET(childWidget, childWidgetOffset);
+
+        if (listWidget->listType == LIST_TYPE_VERTICAL) {
+            if (frame.yOffset >= widget->h) {
+                // TODO: add vertical scroll
+                return false;
+            }
+            setPending(childWidgetOffset, frame.x + frame.xOffset, frame.y + frame.yOffset, frame.previousState, frame.currentState);
+            frame.yOffset += childWidget->h;
+        } else {
+            if (frame.xOffset >= widget->w) {
+                // TODO: add horizontal scroll
+                return false;
+            }
+            setPending(childWidgetOffset, frame.x + frame.xOffset, frame.y + frame.yOffset, frame.previousState, frame.currentState);
+            frame.xOffset += childWidget->w;
+        }
+
+        return true;
     }
-    else if (widget->type == WIDGET_TYPE_LIST) {
-        WidgetState *savedCurrentState = currentState;
 
-        WidgetState *endOfContainerInPreviousState;
-        if (previousState) endOfContainerInPreviousState = next(previousState);
+    // WIDGET_TYPE_SELECT, selected widget was made pending when frame was entered
+    return false;
+}
 
-        // move to the first child widget state
-        if (previousState) ++previousState;
-        if (currentState) ++currentState;
-
-        int xOffset = 0;
-        int yOffset = 0;
-        for (int index = 0; index < data::count(widget->data); ++index) {
-            data::select(cursor, widget->data, index);
-
-            DECL_WIDGET_SPECIFIC(ListWidget, listWidget, widget);
-            OBJ_OFFSET childWidgetOffset = listWidget->item_widget;
-
-            if (listWidget->listType == LIST_TYPE_VERTICAL) {
-                DECL_WIDGET(childWidget, childWidgetOffset);
-                if (yOffset < widget->h) {
-                    enumWidget(childWidgetOffset, x + xOffset, y + yOffset, cursor, previousState, currentState, callback);
-                    yOffset += childWidget->h;
-                } else {
-                    // TODO: add vertical scroll
-                    break;
-                }
-            } else {
-                DECL_WIDGET(childWidget, childWidgetOffset);
-                if (xOffset < widget->w) {
-                    enumWidget(childWidgetOffset, x + xOffset, y + yOffset, cursor, previousState, currentState, callback);
-                    xOffset += childWidget->w;
-                } else {
-                    // TODO: add horizontal scroll
-                    break;
+/// Move to the next child widget state after the child was enumerated.
+void WidgetIterator::leaveChild(Frame &frame) {
+    if (frame.type == WIDGET_TYPE_SELECT) {
+        return;
+    }
+
+    if (frame.previousState) {
+        frame.previousState = gui::next(frame.previousState);
+        if (frame.previousState >= frame.endOfContainerInPreviousState) frame.previousState = 0;
+    }
+
+    frame.currentState = gui::next(frame.currentState);
+}
+
+void WidgetIterator::leave(Frame &frame) {
+    if (m_drawList) {
+        m_drawList->add(DRAW_LIST_OP_END, frame.widgetOffset, 0, frame.x, frame.y, m_cursor, data::Value());
+    }
+
+    if (frame.type == WIDGET_TYPE_SELECT) {
+        if (frame.currentState) {
+            frame.savedCurrentState->size = sizeof(WidgetState) + frame.currentState->size;
+        }
+        return;
+    }
+
+    if (frame.currentState) {
+        frame.savedCurrentState->size = ((uint8_t *)frame.currentState) - ((uint8_t *)frame.savedCurrentState);
+    }
+
+    if (frame.type == WIDGET_TYPE_LIST) {
+        DECL_WIDGET(widget, frame.widgetOffset);
+        data::select(m_cursor, widget->data, -1);
+    }
+}
+
+bool WidgetIterator::next(WidgetCursor &widgetCursor) {
+    while (true) {
+        if (m_hasPending) {
+            if (enter(widgetCursor)) {
+                return true;
+            }
+            continue;
+        }
+
+        if (m_depth == 0) {
+            return false;
+        }
+
+        Frame &frame = m_stack[m_depth - 1];
+
+        // child of this frame, entered before, is enumerated
+        if (frame.index > 0) {
+            leaveChild(frame);
+        }
+
+        if (!nextChild(frame)) {
+            leave(frame);
+            --m_depth;
+        }
+    }
+}
+
+void enumWidgets(int pageIndex, WidgetState *previousState, WidgetState *currentState, EnumWidgetsCallback callback) {
+    WidgetIterator iterator;
+    iterator.begin(pageIndex, previousState, currentState);
+
+    WidgetCursor widgetCursor;
+    while (iterator.next(widgetCursor)) {
+        callback(widgetCursor);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void DrawList::add(uint8_t op, OBJ_OFFSET widgetOffset, const Widget *widget, int x, int y, const data::Cursor &cursor, const data::Value &value) {
+    if (m_numItems == GUI_DRAW_LIST_SIZE) {
+        m_overflow = true;
+        return;
+    }
+
+    DrawListItem &item = m_items[m_numItems++];
+    item.op = op;
+    item.widgetOffset = widgetOffset;
+    item.x = x;
+    item.y = y;
+    item.cursor = cursor;
+    item.value = value;
+    if (widget) {
+        item.type = widget->type;
+        item.data = widget->data;
+        item.w = widget->w;
+        item.h = widget->h;
+    }
+}
+
+void DrawList::compile(int pageId) {
+    m_pageId = pageId;
+    m_numItems = 0;
+    m_overflow = false;
+
+    WidgetIterator iterator;
+    iterator.begin(pageId, 0, 0, this);
+
+    WidgetCursor widgetCursor;
+    while (iterator.next(widgetCursor)) {
+    }
+
+    if (m_overflow) {
+        DebugTraceF("Page %d not compiled to draw list, increase GUI_DRAW_LIST_SIZE", pageId);
+    } else {
+        buildGrid();
+    }
+}
+
+/// Range of the grid cells covered by the leaf widget.
+/// \returns false if widget is outside of the display.
+bool DrawList::getGridCells(const DrawListItem &item, int &column1, int &row1, int &column2, int &row2) {
+    if (item.op != DRAW_LIST_OP_WIDGET || item.w == 0 || item.h == 0) {
+        return false;
+    }
+
+    int x1 = MAX(item.x, 0);
+    int y1 = MAX(item.y, 0);
+    int x2 = MIN(item.x + item.w - 1, m_gridColumns * GUI_HIT_GRID_CELL_SIZE - 1);
+    int y2 = MIN(item.y + item.h - 1, m_gridRows * GUI_HIT_GRID_CELL_SIZE - 1);
+    if (x1 > x2 || y1 > y2) {
+        return false;
+    }
+
+    column1 = x1 / GUI_HIT_GRID_CELL_SIZE;
+    row1 = y1 / GUI_HIT_GRID_CELL_SIZE;
+    column2 = x2 / GUI_HIT_GRID_CELL_SIZE;
+    row2 = y2 / GUI_HIT_GRID_CELL_SIZE;
+    return true;
+}
+
+void DrawList::buildGrid() {
+    m_gridColumns = (lcd::lcd.getDisplayXSize() + GUI_HIT_GRID_CELL_SIZE - 1) / GUI_HIT_GRID_CELL_SIZE;
+    m_gridRows = (lcd::lcd.getDisplayYSize() + GUI_HIT_GRID_CELL_SIZE - 1) / GUI_HIT_GRID_CELL_SIZE;
+    m_gridOverflow = false;
+
+    int numCells = m_gridColumns * m_gridRows;
+    if (numCells > GUI_HIT_GRID_MAX_CELLS) {
+        DebugTrace("Hit test grid not built, increase GUI_HIT_GRID_MAX_CELLS");
+        m_gridOverflow = true;
+        return;
+    }
+
+    // count items per cell
+    memset(m_gridCellFirst, 0, sizeof(m_gridCellFirst));
+
+    int column1, row1, column2, row2;
+    for (int i = 0; i < m_numItems; ++i) {
+        if (getGridCells(m_items[i], column1, row1, column2, row2)) {
+            for (int row = row1; row <= row2; ++row) {
+                for (int column = column1; column <= column2; ++column) {
+                    ++m_gridCellFirst[row * m_gridColumns + column + 1];
                 }
             }
+        }
+    }
+
+    for (int cell = 0; cell < numCells; ++cell) {
+        m_gridCellFirst[cell + 1] += m_gridCellFirst[cell];
+    }
+
+    if (m_gridCellFirst[numCells] > GUI_HIT_GRID_SIZE) {
+        DebugTraceF("Hit test grid of page %d not built, increase GUI_HIT_GRID_SIZE", m_pageId);
+        m_gridOverflow = true;
+        return;
+    }
 
-            if (previousState) {
-                previousState = next(previousState);
-                if (previousState >= endOfContainerInPreviousState) previousState = 0;
+    // fill cells, m_gridCellFirst[cell] is used as the fill position
+    // and restored afterwards by shifting
+    for (int i = 0; i < m_numItems; ++i) {
+        if (getGridCells(m_items[i], column1, row1, column2, row2)) {
+            for (int row = row1; row <= row2; ++row) {
+                for (int column = column1; column <= column2; ++column) {
+                    m_gridItems[m_gridCellFirst[row * m_gridColumns + column]++] = i;
+                }
             }
-        
-            currentState = next(currentState);
         }
+    }
 
-        if (currentState) {
-            savedCurrentState->size = ((uint8_t *)currentState) - ((uint8_t *)savedCurrentState);
+    for (int cell = numCells; cell > 0; --cell) {
+        m_gridCellFirst[cell] = m_gridCellFirst[cell - 1];
+    }
+    m_gridCellFirst[0] = 0;
+}
+
+int DrawList::findWidgetItem(int x, int y) {
+    if (m_gridOverflow) {
+        for (int i = m_numItems - 1; i >= 0; --i) {
+            const DrawListItem &item = m_items[i];
+            if (item.op == DRAW_LIST_OP_WIDGET &&
+                x >= item.x && x < item.x + (int)item.w &&
+                y >= item.y && y < item.y + (int)item.h)
+            {
+                return i;
+            }
         }
+        return -1;
+    }
 
-        data::select(cursor, widget->data, -1);
+    if (x < 0 || y < 0) {
+        return -1;
     }
-    else if (widget->type == WIDGET_TYPE_SELECT) {
-        data::Value indexValue = data::get(cursor, widget->data);
 
-        if (currentState) {
-            currentState->data = indexValue;
+    int column = x / GUI_HIT_GRID_CELL_SIZE;
+    int row = y / GUI_HIT_GRID_CELL_SIZE;
+    if (column >= m_gridColumns || row >= m_gridRows) {
+        return -1;
+    }
+
+    int cell = row * m_gridColumns + column;
+
+    // last widget in the draw list order wins
+    for (int j = m_gridCellFirst[cell + 1] - 1; j >= m_gridCellFirst[cell]; --j) {
+        const DrawListItem &item = m_items[m_gridItems[j]];
+        if (x >= item.x && x < item.x + (int)item.w && y >= item.y && y < item.y + (int)item.h) {
+            return m_gridItems[j];
         }
+    }
 
-        if (previousState && previousState->data != currentState->data) {
-            previousState = 0;
+    return -1;
+}
+
+bool DrawList::isStructureChanged() {
+    for (int i = 0; i < m_numItems; ++i) {
+        const DrawListItem &item = m_items[i];
+        if (item.op == DRAW_LIST_OP_SELECT) {
+            if (data::get(item.cursor, item.data) != item.value) {
+                return true;
+            }
+        } else if (item.op == DRAW_LIST_OP_BEGIN && item.type == WIDGET_TYPE_LIST) {
+            if (data::count(item.data) != item.value.getInt()) {
+                return true;
+            }
         }
+    }
+    return false;
+}
 
-        WidgetState *savedCurrentState = currentState;
+bool DrawList::validate(int pageId) {
+    if (pageId != m_pageId || (!m_overflow && isStructureChanged())) {
+        compile(pageId);
+    }
+    return !m_overflow;
+}
 
-        // move to the selected widget state
-        if (previousState) ++previousState;
-        if (currentState) ++currentState;
+/// Enumerates leaf widgets of the compiled draw list.
+/// Widget states are laid out exactly as by the WidgetIterator.
+class DrawListIterator {
+public:
+    void begin(WidgetState *previousState, WidgetState *currentState);
+
+    /// Move to the next leaf widget.
+    /// \returns false if there are no more widgets.
+    bool next(WidgetCursor &widgetCursor);
+
+private:
+    struct Frame {
+        uint8_t op;
+        WidgetState *previousState;
+        WidgetState *currentState;
+        WidgetState *savedCurrentState;
+        WidgetState *endOfContainerInPreviousState;
+    };
+
+    Frame m_stack[CONF_GUI_ENUM_WIDGETS_STACK_SIZE];
+    int m_depth;
+    int m_itemIndex;
+    /// Leaf widget was returned by the last call to next().
+    bool m_leafReturned;
+
+    WidgetState *m_previousState;
+    WidgetState *m_currentState;
+
+    void leaveChild();
+};
+
+void DrawListIterator::begin(WidgetState *previousState, WidgetState *currentState) {
+    m_depth = 0;
+    m_itemIndex = 0;
+    m_leafReturned = false;
+    m_previousState = previousState;
+    m_currentState = currentState;
+}
 
-        int index = indexValue.getInt();
-        data::select(cursor, widget->data, index);
-        DECL_WIDGET_SPECIFIC(ContainerWidget, containerWidget, widget);
-        OBJ_OFFSET selectedWidgetOffset = getListItemOffset(containerWidget->widgets, index, sizeof(Widget));
+/// Move to the next child widget state of the top frame after the child was enumerated.
+void DrawListIterator::leaveChild() {
+    if (m_depth == 0) {
+        return;
+    }
 
-        enumWidget(selectedWidgetOffset, x, y, cursor, previousState, currentState, callback);
+    Frame &frame = m_stack[m_depth - 1];
 
-        if (currentState) {
-            savedCurrentState->size = sizeof(WidgetState) + currentState->size;
-        }
+    if (frame.op == DRAW_LIST_OP_SELECT) {
+        return;
     }
-    else {
-        callback(WidgetCursor(widgetOffset, x, y, cursor, previousState, currentState));
+
+    if (frame.previousState) {
+        frame.previousState = gui::next(frame.previousState);
+        if (frame.previousState >= frame.endOfContainerInPreviousState) frame.previousState = 0;
     }
+
+    frame.currentState = gui::next(frame.currentState);
 }
 
-void enumWidgets(int pageIndex, WidgetState *previousState, WidgetState *currentState, EnumWidgetsCallback callback) {
-    data::Cursor cursor;
-    cursor.reset();
-    enumWidget(getPageOffset(pageIndex), 0, 0, cursor, previousState, currentState, callback);
+bool DrawListIterator::next(WidgetCursor &widgetCursor) {
+    if (m_leafReturned) {
+        m_leafReturned = false;
+        leaveChild();
+    }
+
+    while (m_itemIndex < g_drawList.getNumItems()) {
+        const DrawListItem &item = g_drawList.getItem(m_itemIndex++);
+
+        WidgetState *previousState;
+        WidgetState *currentState;
+        if (m_depth > 0) {
+            previousState = m_stack[m_depth - 1].previousState;
+            currentState = m_stack[m_depth - 1].currentState;
+        } else {
+            previousState = m_previousState;
+            currentState = m_currentState;
+        }
+
+        if (item.op == DRAW_LIST_OP_WIDGET) {
+            widgetCursor = WidgetCursor(item.widgetOffset, item.x, item.y, item.cursor, previousState, currentState);
+            m_leafReturned = true;
+            return true;
+        }
+
+        if (item.op == DRAW_LIST_OP_END) {
+            Frame &frame = m_stack[--m_depth];
+            if (frame.currentState) {
+                if (frame.op == DRAW_LIST_OP_SELECT) {
+                    frame.savedCurrentState->size = sizeof(WidgetState) + frame.currentState->size;
+                } else {
+                    frame.savedCurrentState->size = ((uint8_t *)frame.currentState) - ((uint8_t *)frame.savedCurrentState);
+                }
+            }
+            leaveChild();
+            continue;
+        }
+
+        // DRAW_LIST_OP_BEGIN or DRAW_LIST_OP_SELECT
+        if (item.op == DRAW_LIST_OP_SELECT) {
+            if (currentState) {
+                currentState->data = item.value;
+            }
+
+            if (previousState && previousState->data != currentState->data) {
+                previousState = 0;
+            }
+        }
+
+        Frame &frame = m_stack[m_depth++];
+        frame.op = item.op;
+        frame.savedCurrentState = currentState;
+        if (previousState) frame.endOfContainerInPreviousState = gui::next(previousState);
+
+        // move to the first child widget state
+        frame.previousState = previousState ? previousState + 1 : 0;
+        frame.currentState = currentState ? currentState + 1 : 0;
+    }
+
+    return false;
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1799,7 +2322,20 @@ void clearBackground() {
     }
 }
 
-void drawActivePage(bool refresh) {
+static WidgetIterator g_drawIterator;
+static DrawListIterator g_drawListIterator;
+/// Active page is drawn from the g_drawList.
+static bool g_isDrawingFromDrawList;
+/// Frame is being drawn, i.e. not all widgets of the active page are drawn yet.
+static bool g_isDrawing;
+static int g_drawPageId;
+static uint32_t g_frameStartTime;
+#if CONF_DEBUG
+/// Time spent drawing the current frame, which can be drawn in more than one tick.
+static uint32_t g_frameDrawDuration;
+#endif
+
+static void beginDrawActivePage(bool refresh) {
     g_wasBlinkTime = g_isBlinkTime;
     g_isBlinkTime = (micros() % (2 * CONF_GUI_BLINK_TIME)) > CONF_GUI_BLINK_TIME && touch::event_type == touch::TOUCH_NONE;
 
@@ -1811,25 +2347,77 @@ void drawActivePage(bool refresh) {
         g_currentState = (WidgetState *)(&g_stateBuffer[getCurrentStateBufferIndex() == 0 ? 1 : 0][0]);
     }
 
-    enumWidgets(getActivePageId(), g_previousState, g_currentState, drawWidget);
+    g_drawPageId = getActivePageId();
+    g_isDrawingFromDrawList = g_drawList.validate(g_drawPageId);
+    if (g_isDrawingFromDrawList) {
+        g_drawListIterator.begin(g_previousState, g_currentState);
+    } else {
+        g_drawIterator.begin(g_drawPageId, g_previousState, g_currentState);
+    }
+    g_isDrawing = true;
+    g_frameStartTime = micros();
+#if CONF_DEBUG
+    g_frameDrawDuration = 0;
+#endif
+}
+
+/// Draw widgets of the active page until all are drawn or time budget is exhausted.
+/// \param budget Time budget in microseconds, 0 means no limit.
+static void drawActivePage(uint32_t budget) {
+    uint32_t start = micros();
+
+    WidgetCursor widgetCursor;
+    while (g_isDrawingFromDrawList ? g_drawListIterator.next(widgetCursor) : g_drawIterator.next(widgetCursor)) {
+        drawWidget(widgetCursor);
+
+        if (budget && micros() - start >= budget) {
+#if CONF_DEBUG
+            g_frameDrawDuration += micros() - start;
+#endif
+            return;
+        }
+    }
+
+    g_isDrawing = false;
+
+#if CONF_DEBUG
+    g_frameDrawDuration += micros() - start;
+    debug::g_guiFrameDuration.addDuration(g_frameDrawDuration);
+#endif
 }
 
 static bool g_refreshPageOnNextTick;
 
-void drawTick() {
+static void drawTick(uint32_t budget) {
     if (isActivePageInternal()) {
         ((InternalPage *)getActivePage())->drawTick();
     } else {
-        if (g_refreshPageOnNextTick) {
+        if (g_refreshPageOnNextTick || (g_isDrawing && g_drawPageId != getActivePageId())) {
             g_refreshPageOnNextTick = false;
             clearBackground();
-            drawActivePage(true);
-        } else {
-            drawActivePage(false);
+            beginDrawActivePage(true);
+        } else if (!g_isDrawing) {
+            if (budget && micros() - g_frameStartTime < GUI_FRAME_PERIOD) {
+                return;
+            }
+            beginDrawActivePage(false);
         }
+
+        drawActivePage(budget);
     }
 }
 
+void drawTick() {
+    drawTick(GUI_DRAW_TICK_BUDGET);
+}
+
+uint32_t getIdleTime(uint32_t tick_usec) {
+    if (g_isDrawing || g_refreshPageOnNextTick) {
+        return 0;
+    }
+    int32_t diff = GUI_FRAME_PERIOD - (tick_usec - g_frameStartTime);
+    return diff > 0 ? diff : 0;
+}
 
 void refreshPage() {
     if (isActivePageInternal()) {
@@ -1840,7 +2428,7 @@ void refreshPage() {
 }
 
 void flush() {
-    drawTick();
+    drawTick(0);
 
 #ifdef EEZ_PSU_SIMULATOR
     if (simulator::front_panel::isOpened()) {
@@ -1885,7 +2473,25 @@ WidgetCursor findWidget(int x, int y) {
 
         g_find_widget_at_x = x;
         g_find_widget_at_y = y;
-        enumWidgets(getActivePageId(), 0, 0, findWidgetStep);
+
+        // Draw list must not be compiled again while the frame is drawn from it,
+        // g_drawListIterator is in the middle of it. It is also what is on the display.
+        bool useDrawList;
+        if (g_isDrawing && g_isDrawingFromDrawList && g_drawPageId == getActivePageId()) {
+            useDrawList = true;
+        } else {
+            useDrawList = g_drawList.validate(getActivePageId());
+        }
+
+        if (useDrawList) {
+            int i = g_drawList.findWidgetItem(x, y);
+            if (i != -1) {
+                const DrawListItem &item = g_drawList.getItem(i);
+                findWidgetStep(WidgetCursor(item.widgetOffset, item.x, item.y, item.cursor, 0, 0));
+            }
+        } else {
+            enumWidgets(getActivePageId(), 0, 0, findWidgetStep);
+        }
 
         return g_foundWidget;
     }
@@ -0,0 +1,508 @@
+/*
+ * EEZ PSU Firmware
+ * Copyright (C) 2018-present, Envox d.o.o.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "psu.h"
+
+#if OPTION_ETHERNET && HTTP_PORT
+
+#if defined(EEZ_PSU_SIMULATOR) || EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R1B9
+#include <UIPEthernet.h>
+#include <UIPServer.h>
+#include <UIPClient.h>
+#elif EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R3B4 || EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R5B12
+#include <Ethernet2.h>
+#include <EthernetServer.h>
+#include <EthernetClient.h>
+#endif
+
+#include "ethernet.h"
+#include "channel_dispatcher.h"
+#include "temperature.h"
+#include "event_queue.h"
+#if EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R3B4 || EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R5B12
+#include "fan.h"
+#endif
+#include "http_server.h"
+
+namespace eez {
+namespace psu {
+namespace http_server {
+
+struct ChannelSnapshot {
+    float uSet;
+    float iSet;
+    float uMon;
+    float iMon;
+    /// Combination of ChannelStateFlags.
+    uint16_t flags;
+    Channel::ProtectionConfigurationFlags protEnabled;
+};
+
+struct TemperatureSnapshot {
+    bool installed;
+    bool tripped;
+    float temperature;
+};
+
+/// Everything reported by GET /status, copied at once so all the values are consistent.
+struct Snapshot {
+    /// millis() when the snapshot was taken.
+    uint32_t time;
+    ChannelSnapshot channels[CH_NUM];
+    TemperatureSnapshot temperatures[temp_sensor::NUM_TEMP_SENSORS];
+    /// -1 if fan RPM is not measured.
+    int fanRpm;
+    event_queue::Event lastErrorEvent;
+};
+
+enum HttpStatus {
+    HTTP_STATUS_OK,
+    HTTP_STATUS_BAD_REQUEST,
+    HTTP_STATUS_NOT_FOUND,
+    HTTP_STATUS_METHOD_NOT_ALLOWED,
+    HTTP_STATUS_INTERNAL_SERVER_ERROR
+};
+
+static EthernetServer g_server(HTTP_PORT);
+static bool g_serverStarted;
+
+static EthernetClient g_client;
+static bool g_clientConnected;
+static uint32_t g_requestStartTime;
+
+static char g_requestLine[HTTP_REQUEST_LINE_MAX_LENGTH + 1];
+static uint8_t g_requestLineLength;
+static bool g_requestLineComplete;
+static bool g_requestLineTooLong;
+/// Number of successive line breaks, request is complete after an empty line.
+static uint8_t g_numLineBreaks;
+
+static Snapshot g_snapshot;
+static bool g_snapshotValid;
+
+static char g_body[HTTP_RESPONSE_BUFFER_SIZE];
+static size_t g_bodyLength;
+static bool g_bodyOverflow;
+
+static Statistics g_statistics;
+
+////////////////////////////////////////////////////////////////////////////////
+
+static void takeSnapshot() {
+    g_snapshot.time = millis();
+
+    // all channels from the same measurement cycle
+    noInterrupts();
+
+    for (int i = 0; i < CH_NUM; ++i) {
+        Channel &channel = Channel::get(i);
+        ChannelSnapshot &channelSnapshot = g_snapshot.channels[i];
+
+        channelSnapshot.uSet = channel_dispatcher::getUSet(channel);
+        channelSnapshot.iSet = channel_dispatcher::getISet(channel);
+        if (channel.isOk()) {
+            channelSnapshot.uMon = channel_dispatcher::getUMon(channel);
+            channelSnapshot.iMon = channel_dispatcher::getIMon(channel);
+        } else {
+            channelSnapshot.uMon = 0;
+            channelSnapshot.iMon = 0;
+        }
+        channelSnapshot.flags = channel.getStateFlags();
+        channelSnapshot.protEnabled = channel.prot_conf.flags;
+    }
+
+    interrupts();
+
+    for (int i = 0; i < temp_sensor::NUM_TEMP_SENSORS; ++i) {
+        temperature::TempSensorTemperature &sensor = temperature::sensors[i];
+        TemperatureSnapshot &temperatureSnapshot = g_snapshot.temperatures[i];
+
+        temperatureSnapshot.installed = sensor.isInstalled();
+        temperatureSnapshot.tripped = sensor.isTripped();
+        temperatureSnapshot.temperature = sensor.temperature;
+    }
+
+#if (EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R3B4 || EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R5B12) && OPTION_FAN && FAN_OPTION_RPM_MEASUREMENT
+    g_snapshot.fanRpm = fan::g_rpm;
+#else
+    g_snapshot.fanRpm = -1;
+#endif
+
+    event_queue::getLastErrorEvent(&g_snapshot.lastErrorEvent);
+
+    g_snapshotValid = true;
+    ++g_statistics.numSnapshots;
+}
+
+static void updateSnapshot() {
+    if (!g_snapshotValid || millis() - g_snapshot.time >= HTTP_SNAPSHOT_MAX_AGE) {
+        takeSnapshot();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+static void append(const char *text, size_t length) {
+    if (g_bodyLength + length > sizeof(g_body)) {
+        g_bodyOverflow = true;
+        return;
+    }
+    memcpy(g_body + g_bodyLength, text, length);
+    g_bodyLength += length;
+}
+
+static void appendText(const char *text) {
+    append(text, strlen(text));
+}
+
+static void appendFormat(const char *format, ...) {
+    char buffer[48];
+
+    va_list args;
+    va_start(args, format);
+    vsnprintf_P(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    appendText(buffer);
+}
+
+static void appendFloat(float value, int numSignificantDecimalDigits) {
+    char buffer[24] = { 0 };
+    util::strcatFloat(buffer, value, numSignificantDecimalDigits);
+    appendText(buffer);
+}
+
+static void appendBool(bool value) {
+    appendText(value ? "true" : "false");
+}
+
+/// Append JSON string, quotes and backslashes are escaped and control characters are skipped.
+static void appendString(const char *text) {
+    append("\"", 1);
+    for (const char *p = text; *p; ++p) {
+        if (*p == '"' || *p == '\\') {
+            append("\\", 1);
+            append(p, 1);
+        } else if ((unsigned char)*p >= ' ') {
+            append(p, 1);
+        }
+    }
+    append("\"", 1);
+}
+
+static void appendProtection(const char *name, bool enabled, bool tripped) {
+    appendFormat(PSTR("\"%s\":{\"enabled\":"), name);
+    appendBool(enabled);
+    appendText(",\"tripped\":");
+    appendBool(tripped);
+    appendText("}");
+}
+
+static void appendChannel(int index, const ChannelSnapshot &channelSnapshot) {
+    uint16_t flags = channelSnapshot.flags;
+
+    appendFormat(PSTR("{\"channel\":%d,\"output\":"), index + 1);
+    appendBool(flags & CH_STATE_OUTPUT_ENABLED ? true : false);
+
+    appendText(",\"mode\":");
+    if (flags & CH_STATE_FAULT) {
+        appendText("\"FAULT\"");
+    } else if (!(flags & CH_STATE_OUTPUT_ENABLED)) {
+        appendText("\"OFF\"");
+    } else if (flags & CH_STATE_CV_MODE) {
+        appendText("\"CV\"");
+    } else if (flags & CH_STATE_CC_MODE) {
+        appendText("\"CC\"");
+    } else {
+        appendText("\"UR\"");
+    }
+
+    Channel &channel = Channel::get(index);
+
+    appendText(",\"u_set\":");
+    appendFloat(channelSnapshot.uSet, getNumSignificantDecimalDigits(VALUE_TYPE_FLOAT_VOLT));
+    appendText(",\"i_set\":");
+    appendFloat(channelSnapshot.iSet, channel_dispatcher::getNumSignificantDecimalDigitsForCurrent(channel));
+    appendText(",\"u_mon\":");
+    appendFloat(channelSnapshot.uMon, getNumSignificantDecimalDigits(VALUE_TYPE_FLOAT_VOLT));
+    appendText(",\"i_mon\":");
+    appendFloat(channelSnapshot.iMon, channel_dispatcher::getNumSignificantDecimalDigitsForCurrent(channel));
+    appendText(",\"p_mon\":");
+    appendFloat(channelSnapshot.uMon * channelSnapshot.iMon, getNumSignificantDecimalDigits(VALUE_TYPE_FLOAT_WATT));
+
+    appendText(",");
+    appendProtection("ovp", channelSnapshot.protEnabled.u_state, flags & CH_STATE_OVP_TRIPPED ? true : false);
+    appendText(",");
+    appendProtection("ocp", channelSnapshot.protEnabled.i_state, flags & CH_STATE_OCP_TRIPPED ? true : false);
+    appendText(",");
+    appendProtection("opp", channelSnapshot.protEnabled.p_state, flags & CH_STATE_OPP_TRIPPED ? true : false);
+    appendText(",\"otp_tripped\":");
+    appendBool(flags & CH_STATE_OTP_TRIPPED ? true : false);
+
+    appendText("}");
+}
+
+static void appendTemperature(int index, const TemperatureSnapshot &temperatureSnapshot) {
+    appendText("{\"sensor\":");
+    appendString(temp_sensor::sensors[index].name);
+    appendText(",\"installed\":");
+    appendBool(temperatureSnapshot.installed);
+    appendText(",\"value\":");
+    if (temperatureSnapshot.installed) {
+        appendFloat(temperatureSnapshot.temperature, getNumSignificantDecimalDigits(VALUE_TYPE_FLOAT_CELSIUS));
+    } else {
+        appendText("null");
+    }
+    appendText(",\"tripped\":");
+    appendBool(temperatureSnapshot.tripped);
+    appendText("}");
+}
+
+static void appendLastError(event_queue::Event &event) {
+    if (event_queue::getEventType(&event) == event_queue::EVENT_TYPE_NONE) {
+        appendText("null");
+        return;
+    }
+
+    appendFormat(PSTR("{\"id\":%d,\"time\":%lu,\"message\":"), (int)event.eventId, (unsigned long)event.dateTime);
+    const char *message = event_queue::getEventMessage(&event);
+    appendString(message ? message : "");
+    appendText("}");
+}
+
+static void composeStatus() {
+    appendFormat(PSTR("{\"uptime\":%lu,\"channels\":["), (unsigned long)g_snapshot.time);
+    for (int i = 0; i < CH_NUM; ++i) {
+        if (i > 0) {
+            appendText(",");
+        }
+        appendChannel(i, g_snapshot.channels[i]);
+    }
+
+    appendText("],\"temperatures\":[");
+    for (int i = 0; i < temp_sensor::NUM_TEMP_SENSORS; ++i) {
+        if (i > 0) {
+            appendText(",");
+        }
+        appendTemperature(i, g_snapshot.temperatures[i]);
+    }
+
+    appendText("],\"fan_rpm\":");
+    if (g_snapshot.fanRpm != -1) {
+        appendFormat(PSTR("%d"), g_snapshot.fanRpm);
+    } else {
+        appendText("null");
+    }
+
+    appendText(",\"last_error\":");
+    appendLastError(g_snapshot.lastErrorEvent);
+
+    appendText("}\n");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+static void resetRequest() {
+    g_requestLineLength = 0;
+    g_requestLineComplete = false;
+    g_requestLineTooLong = false;
+    g_numLineBreaks = 0;
+}
+
+/// \returns true when the complete request (request line and headers) is received.
+static bool parseChar(char ch) {
+    if (!g_requestLineComplete) {
+        if (ch == '\r' || ch == '\n') {
+            g_requestLine[g_requestLineLength] = 0;
+            g_requestLineComplete = true;
+        } else if (g_requestLineLength < HTTP_REQUEST_LINE_MAX_LENGTH) {
+            g_requestLine[g_requestLineLength++] = ch;
+        } else {
+            g_requestLineTooLong = true;
+        }
+    }
+
+    if (ch == '\n') {
+        return ++g_numLineBreaks == 2;
+    }
+
+    if (ch != '\r') {
+        g_numLineBreaks = 0;
+    }
+
+    return false;
+}
+
+static HttpStatus processRequest() {
+    if (g_requestLineTooLong) {
+        return HTTP_STATUS_BAD_REQUEST;
+    }
+
+    if (strncmp_P(g_requestLine, PSTR("GET "), 4) != 0) {
+        return HTTP_STATUS_METHOD_NOT_ALLOWED;
+    }
+
+    const char *path = g_requestLine + 4;
+    size_t pathLength = strcspn(path, " ?");
+    if (pathLength != 7 || strncmp_P(path, PSTR("/status"), 7) != 0) {
+        return HTTP_STATUS_NOT_FOUND;
+    }
+
+    updateSnapshot();
+
+    g_bodyLength = 0;
+    g_bodyOverflow = false;
+    composeStatus();
+
+    if (g_bodyOverflow) {
+        return HTTP_STATUS_INTERNAL_SERVER_ERROR;
+    }
+
+    return HTTP_STATUS_OK;
+}
+
+static void sendResponse(HttpStatus status) {
+    const char *statusLine;
+    const char *contentType = PSTR("text/plain");
+
+    switch (status) {
+    case HTTP_STATUS_OK: statusLine = PSTR("200 OK"); contentType = PSTR("application/json"); break;
+    case HTTP_STATUS_BAD_REQUEST: statusLine = PSTR("400 Bad Request"); break;
+    case HTTP_STATUS_NOT_FOUND: statusLine = PSTR("404 Not Found"); break;
+    case HTTP_STATUS_METHOD_NOT_ALLOWED: statusLine = PSTR("405 Method Not Allowed"); break;
+    default: statusLine = PSTR("500 Internal Server Error"); break;
+    }
+
+    if (status != HTTP_STATUS_OK) {
+        ++g_statistics.numErrors;
+
+        // status line is also the body
+        strncpy_P(g_body, statusLine, sizeof(g_body) - 1);
+        g_body[sizeof(g_body) - 1] = 0;
+        g_bodyLength = strlen(g_body);
+        g_body[g_bodyLength++] = '\n';
+    }
+
+    char header[160];
+    int headerLength = snprintf_P(header, sizeof(header),
+        PSTR("HTTP/1.0 %s\r\nContent-Type: %s\r\nContent-Length: %u\r\nCache-Control: no-cache\r\nConnection: close\r\n\r\n"),
+        statusLine, contentType, (unsigned)g_bodyLength);
+
+    g_client.write(header, headerLength);
+    g_client.write(g_body, g_bodyLength);
+    g_client.flush();
+}
+
+static void closeClient() {
+    g_client.stop();
+    g_clientConnected = false;
+}
+
+/// \returns true when the complete request is received.
+static bool readRequest() {
+    uint8_t buffer[32];
+    size_t numRead = 0;
+
+    while (numRead < ETHERNET_MAX_INPUT_PER_TICK && g_client.available() > 0) {
+        size_t size = g_client.read(buffer, sizeof(buffer));
+        if (size == 0) {
+            break;
+        }
+        numRead += size;
+
+        for (size_t i = 0; i < size; ++i) {
+            if (parseChar((char)buffer[i])) {
+                // the rest of the input (request body) is ignored
+                return true;
+            }
+        }
+    }
+
+    if (!g_client.connected()) {
+        closeClient();
+    } else if (millis() - g_requestStartTime > HTTP_REQUEST_TIMEOUT) {
+        ++g_statistics.numTimeouts;
+        closeClient();
+    }
+
+    return false;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void tick(uint32_t tick_usec) {
+    if (ethernet::g_testResult != psu::TEST_OK) {
+        return;
+    }
+
+    bool requestReceived = false;
+
+    SPI_beginTransaction(ETHERNET_SPI);
+
+    if (!g_serverStarted) {
+        g_server.begin();
+        g_serverStarted = true;
+        DebugTraceF("HTTP server listening on port %d", (int)HTTP_PORT);
+    }
+
+    if (!g_clientConnected) {
+        EthernetClient client = g_server.available();
+        if (client) {
+            g_client = client;
+            g_clientConnected = true;
+            g_requestStartTime = millis();
+            resetRequest();
+        }
+    }
+
+    if (g_clientConnected) {
+        requestReceived = readRequest();
+    }
+
+    SPI_endTransaction();
+
+    if (!requestReceived) {
+        return;
+    }
+
+    uint32_t start = micros();
+
+    ++g_statistics.numRequests;
+
+    // outside of the ethernet SPI transaction, snapshot may need to read the event queue from EEPROM
+    HttpStatus status = processRequest();
+
+    SPI_beginTransaction(ETHERNET_SPI);
+    sendResponse(status);
+    closeClient();
+    SPI_endTransaction();
+
+    uint32_t duration = micros() - start;
+    if (duration > g_statistics.maxResponseDuration) {
+        g_statistics.maxResponseDuration = duration;
+    }
+}
+
+const Statistics &getStatistics() {
+    return g_statistics;
+}
+
+}
+}
+} // namespace eez::psu::http_server
+
+#endif
@@ -0,0 +1,44 @@
+/*
+ * EEZ PSU Firmware
+ * Copyright (C) 2018-present, Envox d.o.o.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+namespace eez {
+namespace psu {
+/// Minimal HTTP server on HTTP_PORT answering GET /status with the JSON status of the PSU.
+/// One client is served at a time and connection is closed after the response.
+namespace http_server {
+
+struct Statistics {
+    uint32_t numRequests;
+    /// Number of requests answered with an error status (4xx, 5xx).
+    uint32_t numErrors;
+    /// Number of clients disconnected because request was not received in time.
+    uint32_t numTimeouts;
+    /// Number of times the status snapshot was taken.
+    uint32_t numSnapshots;
+    /// Longest time (in microseconds) spent composing and sending one response.
+    uint32_t maxResponseDuration;
+};
+
+void tick(uint32_t tick_usec);
+
+const Statistics &getStatistics();
+
+}
+}
+} // namespace eez::psu::http_server
@@ -25,7 +25,11 @@ namespace psu {
 ////////////////////////////////////////////////////////////////////////////////
 
 #define IPOL    0B00000000 // no pin is inverted
+#if IOEXP_USE_INTERRUPTS
+#define GPINTEN 0B01100100 // interrupt on change of CC_ACTIVE, CV_ACTIVE and PWRGOOD (and RPOL, see getRegInitValue)
+#else
 #define GPINTEN 0B00000000 // no interrupts
+#endif
 #define DEFVAL  0B00000000 // 
 #define INTCON  0B00000000 // 
 #define IOCON   0B00100000 // sequential operation disabled, hw addressing disabled
@@ -59,6 +63,35 @@ static const uint8_t REG_VALUES_16[] = {
     0xFF
 };
 
+static IOExpander::Statistics g_statistics;
+static uint32_t g_readDurationTotal;
+static uint32_t g_statisticsWindowStart;
+static uint32_t g_cachedReadsInWindow;
+
+////////////////////////////////////////////////////////////////////////////////
+
+#if IOEXP_USE_INTERRUPTS
+static void ioexp_interrupt_ch1() {
+    Channel::get(0).ioexp.onInterrupt();
+}
+
+static void ioexp_interrupt_ch2() {
+    Channel::get(1).ioexp.onInterrupt();
+}
+#endif
+
+static void updateStatistics(uint32_t tick_usec) {
+    uint32_t duration = tick_usec - g_statisticsWindowStart;
+    if (duration >= 1000000L) {
+        if (g_statistics.numReads > 0) {
+            g_statistics.avgReadDuration = 1.0f * g_readDurationTotal / g_statistics.numReads;
+        }
+        g_statistics.savedBusTimePerSecond = (uint32_t)(1000000.0f * g_cachedReadsInWindow * g_statistics.avgReadDuration / duration);
+        g_cachedReadsInWindow = 0;
+        g_statisticsWindowStart = tick_usec;
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 IOExpander::IOExpander(
@@ -74,6 +107,11 @@ IOExpander::IOExpander(
 
     gpioa = channel.ioexp_gpio_init;
     gpiob = 0B00000001; // 5A
+    gpioInput = 0;
+    lastReadTime = 0;
+#if IOEXP_USE_INTERRUPTS
+    inputChanged = true;
+#endif
 }
 
 uint8_t IOExpander::getRegInitValue(int i) {
@@ -86,6 +124,13 @@ uint8_t IOExpander::getRegInitValue(int i) {
             return gpioa;
         } else if (REG_VALUES_16[i] == IOExpander::REG_GPIOB) {
             return gpiob;
+        } else if (REG_VALUES_16[i] == IOExpander::REG_GPINTENA) {
+#if IOEXP_USE_INTERRUPTS
+            if (channel.getFeatures() & CH_FEATURE_RPOL) {
+                return GPINTEN | (1 << IO_BIT_IN_RPOL);
+            }
+#endif
+            return GPINTEN;
         } else {
             return REG_VALUES_16[i + 1];
         }
@@ -101,6 +146,14 @@ uint8_t IOExpander::getRegInitValue(int i) {
 }
 
 void IOExpander::init() {
+#if IOEXP_USE_INTERRUPTS
+    attachInterrupt(
+        digitalPinToInterrupt(channel.index == 1 ? IOEXP_INT1 : IOEXP_INT2),
+        channel.index == 1 ? ioexp_interrupt_ch1 : ioexp_interrupt_ch2,
+        FALLING
+        );
+#endif
+
     const uint8_t *regValues = channel.boardRevision == CH_BOARD_REVISION_R5B12 ? REG_VALUES_16 : REG_VALUES_8;
 
     for (int i = 0; regValues[i] != 0xFF; i += 3) {
@@ -158,18 +211,42 @@ bool IOExpander::test() {
 }
 
 void IOExpander::tick(uint32_t tick_usec) {
+    updateStatistics(tick_usec);
+
     if (isPowerUp()) {
+#if IOEXP_USE_INTERRUPTS
+        if (!inputChanged && tick_usec - lastReadTime < IOEXP_REFRESH_PERIOD) {
+            channel.eventGpio(getGpio());
+            return;
+        }
+        // cleared before reading, so change during the read is not lost
+        inputChanged = false;
+#endif
         uint8_t gpio0 = readGpio();
         channel.eventGpio(gpio0);
     }
 }
 
 uint8_t IOExpander::readGpio() {
+    uint32_t start = micros();
+
     if (channel.boardRevision == CH_BOARD_REVISION_R5B12) {
-    	return reg_read(REG_GPIOA);
+    	gpioInput = reg_read(REG_GPIOA);
     } else {
-        return reg_read(REG_GPIO);
+        gpioInput = reg_read(REG_GPIO);
     }
+
+    lastReadTime = micros();
+    g_readDurationTotal += lastReadTime - start;
+    ++g_statistics.numReads;
+
+    return gpioInput;
+}
+
+uint8_t IOExpander::getGpio() {
+    ++g_statistics.numCachedReads;
+    ++g_cachedReadsInWindow;
+    return gpioInput;
 }
 
 bool IOExpander::testBit(int io_bit) {
@@ -193,6 +270,17 @@ void IOExpander::changeBit(int io_bit, bool set) {
     }
 }
 
+#if IOEXP_USE_INTERRUPTS
+void IOExpander::onInterrupt() {
+    inputChanged = true;
+    ++g_statistics.numInterrupts;
+}
+#endif
+
+const IOExpander::Statistics &IOExpander::getStatistics() {
+    return g_statistics;
+}
+
 uint8_t IOExpander::reg_read(uint8_t reg) {
     SPI_beginTransaction(MCP23S08_SPI);
     digitalWrite(channel.isolator_pin, ISOLATOR_ENABLE);
@@ -109,6 +109,18 @@ public:
 
     static const size_t NUM_REGISTERS = REG_OLATB + 1;
 
+    struct Statistics {
+        /// Number of GPIO register reads (all channels).
+        uint32_t numReads;
+        /// Number of times cached GPIO value was used instead of reading the register.
+        uint32_t numCachedReads;
+        uint32_t numInterrupts;
+        /// Average duration (in microseconds) of the GPIO register read.
+        float avgReadDuration;
+        /// SPI bus time (in microseconds) saved during the last second by using the cached value.
+        uint32_t savedBusTimePerSecond;
+    };
+
     psu::TestResult g_testResult;
 
     IOExpander(Channel &channel, 
@@ -122,14 +134,29 @@ public:
     void tick(uint32_t tick_usec);
 
 	uint8_t readGpio();
+    /// GPIO value as it was read last time.
+    uint8_t getGpio();
 
     bool testBit(int io_bit);
     void changeBit(int io_bit, bool set);
 
+#if IOEXP_USE_INTERRUPTS
+    void onInterrupt();
+#endif
+
+    static const Statistics &getStatistics();
+
 private:
     Channel &channel;
 	uint8_t gpioa;
     uint8_t gpiob;
+    /// Last value read from the GPIO (GPIOA) register.
+    uint8_t gpioInput;
+    uint32_t lastReadTime;
+#if IOEXP_USE_INTERRUPTS
+    /// Some input changed since the last read.
+    volatile bool inputChanged;
+#endif
 
 	uint8_t getRegInitValue(int i);
     uint8_t reg_read(uint8_t reg);
@@ -0,0 +1,267 @@
+/*
+ * EEZ PSU Firmware
+ * Copyright (C) 2018-present, Envox d.o.o.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "psu.h"
+#include "job_queue.h"
+
+namespace eez {
+namespace psu {
+namespace job_queue {
+
+#if JOB_QUEUE_SIZE > 0
+
+#if OPTION_ETHERNET
+static const int MAX_PENDING_OPC = 1 + ETHERNET_MAX_SESSIONS;
+#else
+static const int MAX_PENDING_OPC = 1;
+#endif
+
+struct PendingOpc {
+    scpi_t *context;
+    /// OPC bit is set when this many jobs are finished.
+    uint32_t jobNumber;
+};
+
+static Job g_jobs[JOB_QUEUE_SIZE];
+static uint8_t g_head;
+static uint8_t g_size;
+
+static uint32_t g_numPushed;
+static uint32_t g_numFinished;
+
+static PendingOpc g_pendingOpc[MAX_PENDING_OPC];
+
+#endif
+
+static bool g_executing;
+static uint32_t g_currentJobDuration;
+
+static Statistics g_statistics;
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// Execute one slice of the job.
+/// \returns true if job is finished.
+static bool executeSlice(Job &job) {
+    g_executing = true;
+
+    uint32_t start = micros();
+    int16_t err = 0;
+    bool finished = job.step(job, err);
+    uint32_t duration = micros() - start;
+
+    g_executing = false;
+
+    g_currentJobDuration += duration;
+    if (duration > g_statistics.maxSliceDuration) {
+        g_statistics.maxSliceDuration = duration;
+    }
+
+    if (!finished) {
+        return false;
+    }
+
+    if (err) {
+        ++g_statistics.numFailed;
+        if (job.context) {
+            SCPI_ErrorPush(job.context, err);
+        }
+    }
+
+    ++g_statistics.numExecuted;
+    g_statistics.lastDuration = g_currentJobDuration;
+    if (g_currentJobDuration > g_statistics.maxDuration) {
+        g_statistics.maxDuration = g_currentJobDuration;
+    }
+    g_currentJobDuration = 0;
+
+    return true;
+}
+
+#if JOB_QUEUE_SIZE > 0
+
+static void setPendingOpcBits() {
+    for (int i = 0; i < MAX_PENDING_OPC; ++i) {
+        if (g_pendingOpc[i].context && (int32_t)(g_numFinished - g_pendingOpc[i].jobNumber) >= 0) {
+            SCPI_RegSetBits(g_pendingOpc[i].context, SCPI_REG_ESR, ESR_OPC);
+            g_pendingOpc[i].context = 0;
+        }
+    }
+}
+
+/// Execute one slice of the job at the head of the queue.
+static void executeHeadSlice() {
+    if (!executeSlice(g_jobs[g_head])) {
+        return;
+    }
+
+    g_head = (g_head + 1) % JOB_QUEUE_SIZE;
+    --g_size;
+    ++g_numFinished;
+
+    setPendingOpcBits();
+}
+
+static void executeHeadJob() {
+    uint32_t numFinished = g_numFinished;
+    while (g_size > 0 && g_numFinished == numFinished) {
+        executeHeadSlice();
+    }
+}
+
+/// Synchronously execute pending jobs up to the last one which reads (if readers is true)
+/// or changes channel lists.
+static void waitChannelListJobs(bool readers) {
+    if (g_executing) {
+        // called from the job itself
+        return;
+    }
+
+    for (int i = g_size - 1; i >= 0; --i) {
+        Job &job = g_jobs[(g_head + i) % JOB_QUEUE_SIZE];
+        if (job.writesChannelLists || (readers && job.readsChannelLists)) {
+            for (int n = 0; n <= i; ++n) {
+                executeHeadJob();
+            }
+            return;
+        }
+    }
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+
+void push(scpi_t *context, JobStepFunction step, Job &job) {
+    job.step = step;
+    job.context = context;
+
+#if JOB_QUEUE_SIZE > 0
+    if (g_size == JOB_QUEUE_SIZE) {
+        // no room, make some by finishing the oldest job
+        executeHeadJob();
+    }
+
+    g_jobs[(g_head + g_size) % JOB_QUEUE_SIZE] = job;
+
+    ++g_size;
+    ++g_numPushed;
+
+    if (g_size > g_statistics.maxDepth) {
+        g_statistics.maxDepth = g_size;
+    }
+#else
+    while (!executeSlice(job)) {
+    }
+#endif
+}
+
+void tick(uint32_t tick_usec) {
+#if JOB_QUEUE_SIZE > 0
+    if (g_size > 0 && !g_executing) {
+        executeHeadSlice();
+    }
+#endif
+}
+
+bool isIdle() {
+#if JOB_QUEUE_SIZE > 0
+    return g_size == 0;
+#else
+    return true;
+#endif
+}
+
+int getDepth() {
+#if JOB_QUEUE_SIZE > 0
+    return g_size;
+#else
+    return 0;
+#endif
+}
+
+void waitAll() {
+#if JOB_QUEUE_SIZE > 0
+    if (g_executing) {
+        return;
+    }
+
+    while (g_size > 0) {
+        executeHeadSlice();
+    }
+#endif
+}
+
+void waitChannelListReaders() {
+#if JOB_QUEUE_SIZE > 0
+    waitChannelListJobs(true);
+#endif
+}
+
+void waitChannelListWriters() {
+#if JOB_QUEUE_SIZE > 0
+    waitChannelListJobs(false);
+#endif
+}
+
+void setOpcWhenIdle(scpi_t *context) {
+    if (isIdle()) {
+        SCPI_RegSetBits(context, SCPI_REG_ESR, ESR_OPC);
+        return;
+    }
+
+#if JOB_QUEUE_SIZE > 0
+    int freeSlot = -1;
+    for (int i = 0; i < MAX_PENDING_OPC; ++i) {
+        if (g_pendingOpc[i].context == context) {
+            // later *OPC waits for all the jobs enqueued so far
+            g_pendingOpc[i].jobNumber = g_numPushed;
+            return;
+        }
+        if (!g_pendingOpc[i].context && freeSlot == -1) {
+            freeSlot = i;
+        }
+    }
+
+    if (freeSlot != -1) {
+        g_pendingOpc[freeSlot].context = context;
+        g_pendingOpc[freeSlot].jobNumber = g_numPushed;
+    } else {
+        waitAll();
+        SCPI_RegSetBits(context, SCPI_REG_ESR, ESR_OPC);
+    }
+#endif
+}
+
+void cancelOpc(scpi_t *context) {
+#if JOB_QUEUE_SIZE > 0
+    for (int i = 0; i < MAX_PENDING_OPC; ++i) {
+        if (g_pendingOpc[i].context == context) {
+            g_pendingOpc[i].context = 0;
+        }
+    }
+#endif
+}
+
+const Statistics &getStatistics() {
+    return g_statistics;
+}
+
+}
+}
+} // namespace eez::psu::job_queue
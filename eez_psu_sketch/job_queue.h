@@ -0,0 +1,108 @@
+/*
+ * EEZ PSU Firmware
+ * Copyright (C) 2018-present, Envox d.o.o.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "profile.h"
+#include "macro.h"
+
+namespace eez {
+namespace psu {
+/// Background execution of long running (EEPROM, SD card) SCPI commands.
+namespace job_queue {
+
+struct Job;
+
+/// Executes one bounded slice of the job.
+/// \param job The job being executed. Use job.state to remember progress between slices.
+/// \param err Set to the SCPI error code if the job failed.
+/// \returns true if job is finished (successfully or not), false if more slices are needed.
+typedef bool (*JobStepFunction)(Job &job, int16_t &err);
+
+struct Job {
+    Job() : iParam(0), state(0), readsChannelLists(false), writesChannelLists(false) {}
+
+    JobStepFunction step;
+    /// SCPI context which enqueued the job, errors are reported there.
+    scpi_t *context;
+    int16_t iParam;
+    uint16_t state;
+    /// Job reads channel lists when executed, see waitChannelListReaders.
+    bool readsChannelLists;
+    /// Job changes channel lists when executed, see waitChannelListWriters.
+    bool writesChannelLists;
+    union {
+        profile::Parameters profile;
+        char filePath[MAX_PATH_LENGTH];
+#if NUM_MACRO_LOCATIONS
+        macro::Macro macro;
+#endif
+    };
+};
+
+struct Statistics {
+    uint32_t numExecuted;
+    uint32_t numFailed;
+    uint8_t maxDepth;
+    /// Time (in microseconds) spent executing the last finished job.
+    uint32_t lastDuration;
+    /// Longest time (in microseconds) spent executing one job.
+    uint32_t maxDuration;
+    /// Longest time (in microseconds) spent in one job slice.
+    uint32_t maxSliceDuration;
+};
+
+/// Add a copy of the job at the end of the queue.
+/// If queue is full then the oldest job is executed to the end before the job is added.
+/// If JOB_QUEUE_SIZE is 0 then the job is executed to the end immediately.
+void push(scpi_t *context, JobStepFunction step, Job &job);
+
+/// Execute one slice of the job at the head of the queue.
+void tick(uint32_t tick_usec);
+
+/// Are there no pending jobs?
+bool isIdle();
+
+/// Number of jobs in the queue (including the one being executed).
+int getDepth();
+
+/// Synchronously execute all pending jobs.
+/// Used by commands that depend on the results of the previously enqueued jobs (*WAI, *OPC?, *RCL, ...).
+void waitAll();
+
+/// Synchronously execute pending jobs up to the last one which reads or changes channel lists.
+/// Called before channel lists are changed, so those jobs see the lists as they were when the job was enqueued
+/// and the change is not overwritten by the job enqueued before it.
+void waitChannelListReaders();
+
+/// Synchronously execute pending jobs up to the last one which changes channel lists.
+/// Called before channel lists are read or used (list queries, INIT), so the result of the previously enqueued jobs is seen.
+void waitChannelListWriters();
+
+/// Set OPC bit in the ESR register of the given SCPI context
+/// when all currently enqueued jobs are finished.
+void setOpcWhenIdle(scpi_t *context);
+
+/// Forget pending *OPC of the given SCPI context (*CLS, *RST).
+void cancelOpc(scpi_t *context);
+
+const Statistics &getStatistics();
+
+}
+}
+} // namespace eez::psu::job_queue
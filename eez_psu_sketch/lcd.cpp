@@ -39,12 +39,223 @@ EEZ_UTFT lcd(DISPLAY_TYPE, LCD_RS, LCD_WR, LCD_CS, LCD_RESET);
 
 EEZ_UTFT::EEZ_UTFT(byte model, int RS, int WR, int CS, int RST, int SER)
 	: UTFT(model, RS, WR, CS, RST, SER)
+#ifdef EEZ_PSU_SIMULATOR
+    , m_numDirtyRects(0)
+#endif
 {
 }
 
-int8_t EEZ_UTFT::drawGlyph(int x1, int y1, int clip_x1, int clip_y1, int clip_x2, int clip_y2, uint8_t encoding, bool fill_background) {
-    psu::criticalTick();
+#if defined(EEZ_PSU_SIMULATOR) || CONF_DEBUG
+
+void EEZ_UTFT::markDirty(int x1, int y1, int x2, int y2) {
+    if (x1 < 0) x1 = 0;
+    if (y1 < 0) y1 = 0;
+    if (x2 >= getDisplayXSize()) x2 = getDisplayXSize() - 1;
+    if (y2 >= getDisplayYSize()) y2 = getDisplayYSize() - 1;
+    if (x1 > x2 || y1 > y2) {
+        return;
+    }
+
+#if CONF_DEBUG
+    debug::g_lcdPixelCounter.add((x2 - x1 + 1) * (y2 - y1 + 1));
+#endif
+
+#ifdef EEZ_PSU_SIMULATOR
+    // find rectangle to merge with: overlapping or adjacent one if exists,
+    // otherwise, if there is no room for new rectangle, the one whose area grows the least
+    int iMerge = -1;
+    long minGrowth = 0;
+    for (int i = 0; i < m_numDirtyRects; ++i) {
+        DirtyRect &rect = m_dirtyRects[i];
+
+        if (x1 <= rect.x2 + 1 && rect.x1 <= x2 + 1 && y1 <= rect.y2 + 1 && rect.y1 <= y2 + 1) {
+            iMerge = i;
+            break;
+        }
+
+        if (m_numDirtyRects == MAX_DIRTY_RECTS) {
+            long growth =
+                (long)(MAX(x2, rect.x2) - MIN(x1, rect.x1) + 1) * (MAX(y2, rect.y2) - MIN(y1, rect.y1) + 1) -
+                (long)(rect.x2 - rect.x1 + 1) * (rect.y2 - rect.y1 + 1);
+            if (iMerge == -1 || growth < minGrowth) {
+                iMerge = i;
+                minGrowth = growth;
+            }
+        }
+    }
+
+    if (iMerge == -1) {
+        DirtyRect &rect = m_dirtyRects[m_numDirtyRects++];
+        rect.x1 = x1;
+        rect.y1 = y1;
+        rect.x2 = x2;
+        rect.y2 = y2;
+    } else {
+        DirtyRect &rect = m_dirtyRects[iMerge];
+        if (x1 < rect.x1) rect.x1 = x1;
+        if (y1 < rect.y1) rect.y1 = y1;
+        if (x2 > rect.x2) rect.x2 = x2;
+        if (y2 > rect.y2) rect.y2 = y2;
+    }
+#endif
+}
+
+#endif
+
+#ifdef EEZ_PSU_SIMULATOR
+int EEZ_UTFT::takeDirtyRects(DirtyRect *rects) {
+    int numRects = m_numDirtyRects;
+
+    for (int i = 0; i < numRects; ++i) {
+        rects[i] = m_dirtyRects[i];
+#if CONF_DEBUG
+        debug::g_lcdFlushPixelCounter.add((rects[i].x2 - rects[i].x1 + 1) * (rects[i].y2 - rects[i].y1 + 1));
+#endif
+    }
+
+    m_numDirtyRects = 0;
+
+    return numRects;
+}
+#endif
+
+void EEZ_UTFT::clrScr() {
+    UTFT::clrScr();
+    markDirty(0, 0, getDisplayXSize() - 1, getDisplayYSize() - 1);
+}
+
+void EEZ_UTFT::fillRect(int x1, int y1, int x2, int y2) {
+    UTFT::fillRect(x1, y1, x2, y2);
+    markDirty(MIN(x1, x2), MIN(y1, y2), MAX(x1, x2), MAX(y1, y2));
+}
+
+void EEZ_UTFT::drawRect(int x1, int y1, int x2, int y2) {
+    UTFT::drawRect(x1, y1, x2, y2);
+
+    if (x1 > x2) util_swap(int, x1, x2);
+    if (y1 > y2) util_swap(int, y1, y2);
+    markDirty(x1, y1, x2, y1);
+    markDirty(x1, y2, x2, y2);
+    markDirty(x1, y1, x1, y2);
+    markDirty(x2, y1, x2, y2);
+}
+
+void EEZ_UTFT::drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int scale) {
+    UTFT::drawBitmap(x, y, sx, sy, data, scale);
+    markDirty(x, y, x + sx * scale - 1, y + sy * scale - 1);
+}
 
+void EEZ_UTFT::drawRleBitmap(int x, int y, int sx, int sy, const uint8_t *data PROGMEM) {
+    markDirty(x, y, x + sx - 1, y + sy - 1);
+
+    // Literal colors can start at any (also odd) address, so colors are read byte by byte.
+#define RLE_COLOR(p) (arduino_util::prog_read_byte(p) | (arduino_util::prog_read_byte((p) + 1) << 8))
+
+#if DISPLAY_TYPE == ITDB32S_V2 && !defined(EEZ_PSU_SIMULATOR)
+    // color of the run is put on the bus only once and then written to every pixel of the run
+#define RLE_RUN(color, length) { \
+    byte ch = (color) >> 8; \
+    byte cl = (color) & 0xFF; \
+    sbi(P_RS, B_RS); \
+    REG_PIOA_CODR=0x0000C080; \
+    REG_PIOC_CODR=0x0000003E; \
+    REG_PIOD_CODR=0x0000064F; \
+    REG_PIOA_SODR=((ch & 0x06)<<13) | ((cl & 0x40)<<1); \
+    (ch & 0x01) ? REG_PIOB_SODR = 0x4000000 : REG_PIOB_CODR = 0x4000000; \
+    REG_PIOC_SODR=((cl & 0x01)<<5) | ((cl & 0x02)<<3) | ((cl & 0x04)<<1) | ((cl & 0x08)>>1) | ((cl & 0x10)>>3); \
+    REG_PIOD_SODR=((ch & 0x78)>>3) | ((ch & 0x80)>>1) | ((cl & 0x20)<<5) | ((cl & 0x80)<<2); \
+    for (int j = 0; j < (length); ++j) { \
+        pulse_low(P_WR, B_WR); \
+    } \
+}
+#else
+#define RLE_RUN(color, length) { \
+    for (int j = 0; j < (length); ++j) { \
+        setPixel(color); \
+    } \
+}
+#endif
+
+	clear_bit(P_CS, B_CS);
+
+    const uint8_t *p = data;
+
+    if (orient == PORTRAIT) {
+        // window is filled row by row, from left to right, i.e. in the packet order
+        setXY(x, y, x + sx - 1, y + sy - 1);
+
+        for (int i = 0; i < sx * sy; ) {
+            uint8_t header = arduino_util::prog_read_byte(p++);
+            int length = (header & 0x7F) + 1;
+            if (header & 0x80) {
+                RLE_RUN(RLE_COLOR(p), length);
+                p += 2;
+            } else {
+                for (int j = 0; j < length; ++j, p += 2) {
+                    setPixel(RLE_COLOR(p));
+                }
+            }
+            i += length;
+        }
+    } else {
+        // window of one row is filled from right to left, so packets of the row
+        // are collected (at most MAX_ROW_PACKETS at once) and then sent in reverse
+        static const int MAX_ROW_PACKETS = 32;
+        const uint8_t *packets[MAX_ROW_PACKETS];
+
+        for (int iy = 0; iy < sy; ++iy) {
+            for (int ix = 0; ix < sx; ) {
+                int ixStart = ix;
+                int numPackets = 0;
+                while (ix < sx && numPackets < MAX_ROW_PACKETS) {
+                    packets[numPackets++] = p;
+                    uint8_t header = arduino_util::prog_read_byte(p++);
+                    int length = (header & 0x7F) + 1;
+                    p += header & 0x80 ? 2 : 2 * length;
+                    ix += length;
+                }
+
+                setXY(x + ixStart, y + iy, x + ix - 1, y + iy);
+
+                for (int i = numPackets - 1; i >= 0; --i) {
+                    const uint8_t *q = packets[i];
+                    uint8_t header = arduino_util::prog_read_byte(q++);
+                    int length = (header & 0x7F) + 1;
+                    if (header & 0x80) {
+                        RLE_RUN(RLE_COLOR(q), length);
+                    } else {
+                        for (int j = length - 1; j >= 0; --j) {
+                            setPixel(RLE_COLOR(q + 2 * j));
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+#undef RLE_RUN
+#undef RLE_COLOR
+
+	set_bit(P_CS, B_CS);
+	clrXY();
+}
+
+void EEZ_UTFT::drawHLine(int x, int y, int l) {
+    UTFT::drawHLine(x, y, l);
+    markDirty(x, y, x + l, y);
+}
+
+void EEZ_UTFT::drawVLine(int x, int y, int l) {
+    UTFT::drawVLine(x, y, l);
+    markDirty(x, y, x, y + l);
+}
+
+void EEZ_UTFT::drawPixel(int x, int y) {
+    UTFT::drawPixel(x, y);
+    markDirty(x, y, x, y);
+}
+
+int8_t EEZ_UTFT::drawGlyph(int x1, int y1, int clip_x1, int clip_y1, int clip_x2, int clip_y2, uint8_t encoding, bool fill_background) {
 	font::Glyph glyph;
 	font.getGlyph(encoding, glyph);
 	if (!glyph.isFound())
@@ -124,6 +335,8 @@ int8_t EEZ_UTFT::drawGlyph(int x1, int y1, int clip_x1, int clip_y1, int clip_x2
     }
 
     if (width > 0 && height > 0) {
+        markDirty(x_glyph, y_glyph, x_glyph + width - 1, y_glyph + height - 1);
+
 	    clear_bit(P_CS, B_CS);
 
 #if DISPLAY_TYPE == ITDB32S_V2 && !defined(EEZ_PSU_SIMULATOR)
@@ -183,8 +396,6 @@ int8_t EEZ_UTFT::drawGlyph(int x1, int y1, int clip_x1, int clip_y1, int clip_x2
         uint32_t REG_PIOD_SODR_BG =((bch & 0x78)>>3) | ((bch & 0x80)>>1) | ((bcl & 0x20)<<5) | ((bcl & 0x80)<<2);
         int BG_TEST = bch & 0x01;
 
-        int numPixels = 0;
-
         int iEndByte = iStartByte + (width + 7) / 8;
         int x1_glyph = x_glyph;
         int x2_glyph = x_glyph + width - 1;
@@ -195,11 +406,7 @@ int8_t EEZ_UTFT::drawGlyph(int x1, int y1, int clip_x1, int clip_y1, int clip_x2
                 ++y_glyph;
 
                 const uint8_t *p_data = glyph.data + offset + iEndByte;
-                for (int iByte = iEndByte; iByte >= iStartByte; --iByte, numPixels += 8) {
-                    if (numPixels % 40 == 0) {
-                        psu::criticalTick();
-                    }
-
+                for (int iByte = iEndByte; iByte >= iStartByte; --iByte) {
                     uint8_t data = *p_data--;
 
                     int LAST_PIXEL = -1;
@@ -234,11 +441,7 @@ int8_t EEZ_UTFT::drawGlyph(int x1, int y1, int clip_x1, int clip_y1, int clip_x2
                 ++y_glyph;
 
                 const uint8_t *p_data = glyph.data + offset + iEndByte;
-                for (int iByte = iEndByte; iByte >= iStartByte; --iByte, numPixels += 8) {
-                    if (numPixels % 120 == 0) {
-                        psu::criticalTick();
-                    }
-
+                for (int iByte = iEndByte; iByte >= iStartByte; --iByte) {
                     uint8_t data = *p_data--;
 
                     int LAST_PIXEL = -1;
@@ -273,15 +476,9 @@ int8_t EEZ_UTFT::drawGlyph(int x1, int y1, int clip_x1, int clip_y1, int clip_x2
         word bc = (bch << 8) | bcl;
 
 	    if (orient == PORTRAIT) {
-            int numPixels = 0;
-
             setXY(x_glyph, y_glyph, x_glyph + width - 1, y_glyph + height - 1);
 		    for (int iRow = 0; iRow < height; ++iRow, offset += widthInBytes) {
-			    for (int iByte = iStartByte, iCol = iStartCol; iByte < widthInBytes; ++iByte, numPixels += 8) {
-                    if (numPixels % 120 == 0) {
-                        psu::criticalTick();
-                    }
-
+			    for (int iByte = iStartByte, iCol = iStartCol; iByte < widthInBytes; ++iByte) {
                     uint8_t data = arduino_util::prog_read_byte(glyph.data + offset + iByte);
                     if (paintEnabled) {
                         if (iCol + 8 <= width) {
@@ -330,15 +527,9 @@ int8_t EEZ_UTFT::drawGlyph(int x1, int y1, int clip_x1, int clip_y1, int clip_x2
 		    }
 	    }
 	    else {
-            int numPixels = 0;
-
 		    for (int iRow = 0; iRow < height; ++iRow) {
 			    setXY(x_glyph, y_glyph + iRow, x_glyph + width - 1, y_glyph + iRow);
-			    for (int iByte = iStartByte + (width + 7) / 8; iByte >= iStartByte; --iByte, numPixels += 8) {
-                    if (numPixels % 120 == 0) {
-                        psu::criticalTick();
-                    }
-
+			    for (int iByte = iStartByte + (width + 7) / 8; iByte >= iStartByte; --iByte) {
 #if defined(EEZ_PSU_ARDUINO_DUE)
 				    uint8_t data = *(glyph.data + offset + iByte);
 #else
@@ -400,9 +591,130 @@ int8_t EEZ_UTFT::drawGlyph(int x1, int y1, int clip_x1, int clip_y1, int clip_x2
 	return glyph.dx;
 }
 
+/// Max. number of glyphs drawn by drawStrRun at once.
+static const int MAX_RUN_GLYPHS = 32;
+
+/// Draw the whole string, background included, in one address window, i.e. every pixel is set exactly once.
+/// \returns false if string can't be drawn this way (some glyph is outside of its cell or string is too long),
+/// nothing is drawn in that case.
+bool EEZ_UTFT::drawStrRun(const char *text, int textLength, int x, int y, int clip_x1, int clip_y1, int clip_x2, int clip_y2) {
+    font::Glyph glyphs[MAX_RUN_GLYPHS];
+    int glyphX[MAX_RUN_GLYPHS];
+    int glyphTop[MAX_RUN_GLYPHS];
+    bool glyphPaint[MAX_RUN_GLYPHS];
+    int numGlyphs = 0;
+
+    int ascent = font.getAscent();
+    int height = font.getHeight();
+
+    int x_end = x;
+    for (int i = 0; (textLength == -1 || i < textLength) && text[i]; ++i) {
+        if (numGlyphs == MAX_RUN_GLYPHS) {
+            return false;
+        }
+
+        font::Glyph &glyph = glyphs[numGlyphs];
+        font.getGlyph(text[i], glyph);
+        if (!glyph.isFound()) {
+            continue;
+        }
+
+        int top = ascent - (glyph.y + glyph.height);
+        if (glyph.dx <= 0 || glyph.x < 0 || glyph.x + glyph.width > glyph.dx || top < 0 || top + glyph.height > height) {
+            return false;
+        }
+
+        glyphX[numGlyphs] = x_end;
+        glyphTop[numGlyphs] = y + top;
+        // same as in drawGlyph: if glyph doesn't fit, don't paint it, i.e. paint background
+        glyphPaint[numGlyphs] = MAX(x_end + glyph.x, clip_x1) + glyph.width - 1 <= clip_x2;
+
+        x_end += glyph.dx;
+        ++numGlyphs;
+    }
+
+    int x1 = MAX(x, clip_x1);
+    int y1 = MAX(y, clip_y1);
+    int x2 = MIN(x_end - 1, clip_x2);
+    int y2 = MIN(y + height - 1, clip_y2);
+    if (x1 > x2 || y1 > y2) {
+        return true;
+    }
+
+    markDirty(x1, y1, x2, y2);
+
+	clear_bit(P_CS, B_CS);
+
+#if DISPLAY_TYPE == ITDB32S_V2 && !defined(EEZ_PSU_SIMULATOR)
+    uint32_t REG_PIOA_SODR_FG =((fch & 0x06)<<13) | ((fcl & 0x40)<<1);
+    uint32_t REG_PIOC_SODR_FG =((fcl & 0x01)<<5) | ((fcl & 0x02)<<3) | ((fcl & 0x04)<<1) | ((fcl & 0x08)>>1) | ((fcl & 0x10)>>3);
+    uint32_t REG_PIOD_SODR_FG =((fch & 0x78)>>3) | ((fch & 0x80)>>1) | ((fcl & 0x20)<<5) | ((fcl & 0x80)<<2);
+    int FG_TEST = fch & 0x01;
+
+    uint32_t REG_PIOA_SODR_BG =((bch & 0x06)<<13) | ((bcl & 0x40)<<1);
+    uint32_t REG_PIOC_SODR_BG =((bcl & 0x01)<<5) | ((bcl & 0x02)<<3) | ((bcl & 0x04)<<1) | ((bcl & 0x08)>>1) | ((bcl & 0x10)>>3);
+    uint32_t REG_PIOD_SODR_BG =((bch & 0x78)>>3) | ((bch & 0x80)>>1) | ((bcl & 0x20)<<5) | ((bcl & 0x80)<<2);
+    int BG_TEST = bch & 0x01;
+
+    int LAST_PIXEL = -1;
+
+#define RUN_PIXEL(C) SET_PIXEL(C)
+#else
+    word fc = (fch << 8) | fcl;
+    word bc = (bch << 8) | bcl;
+
+#define RUN_PIXEL(C) setPixel((C) ? fc : bc)
+#endif
+
+// foreground if pixel (px, py) is set in the glyph k, otherwise background
+#define RUN_GLYPH_PIXEL(k, px, py) { \
+    int gx = px - (glyphX[k] + glyphs[k].x); \
+    int gy = py - glyphTop[k]; \
+    if (glyphPaint[k] && gx >= 0 && gx < glyphs[k].width && gy >= 0 && gy < glyphs[k].height) { \
+        RUN_PIXEL(arduino_util::prog_read_byte(glyphs[k].data + font::GLYPH_HEADER_SIZE + gy * ((glyphs[k].width + 7) / 8) + (gx >> 3)) & (0x80 >> (gx & 7))); \
+    } else { \
+        RUN_PIXEL(0); \
+    } \
+}
+
+    setXY(x1, y1, x2, y2);
+
+    if (orient == PORTRAIT) {
+        // window is filled row by row, from left to right
+        for (int py = y1; py <= y2; ++py) {
+            int k = 0;
+            for (int px = x1; px <= x2; ++px) {
+                while (px >= glyphX[k] + glyphs[k].dx) ++k;
+                RUN_GLYPH_PIXEL(k, px, py);
+            }
+        }
+    } else {
+        // window is filled column by column, from right to left and from top to bottom
+        int k = numGlyphs - 1;
+        for (int px = x2; px >= x1; --px) {
+            while (px < glyphX[k]) --k;
+            for (int py = y1; py <= y2; ++py) {
+                RUN_GLYPH_PIXEL(k, px, py);
+            }
+        }
+    }
+
+#undef RUN_GLYPH_PIXEL
+#undef RUN_PIXEL
+
+	set_bit(P_CS, B_CS);
+	clrXY();
+
+    return true;
+}
+
 void EEZ_UTFT::drawStr(const char *text, int textLength, int x, int y, int clip_x1, int clip_y1, int clip_x2, int clip_y2, font::Font &font, bool fill_background) {
 	this->font = font;
 
+    if (fill_background && drawStrRun(text, textLength, x, y, clip_x1, clip_y1, clip_x2, clip_y2)) {
+        return;
+    }
+
     if (textLength == -1) {
 	    char encoding;
 	    while ((encoding = *text++) != 0) {
@@ -425,9 +737,66 @@ int8_t EEZ_UTFT::measureGlyph(uint8_t encoding) {
 	return glyph.dx;
 }
 
+/// Max. length of the string kept in the measured strings cache.
+static const int MEASURE_CACHE_MAX_TEXT_LENGTH = 16;
+static const int MEASURE_CACHE_SIZE = 16;
+
+struct MeasuredStr {
+    const uint8_t *fontData PROGMEM;
+    int16_t maxWidth;
+    uint8_t textLength;
+    char text[MEASURE_CACHE_MAX_TEXT_LENGTH];
+    int16_t width;
+    uint16_t lastUsed;
+};
+
+/// Recently measured strings, least recently used one is replaced.
+static MeasuredStr g_measureCache[MEASURE_CACHE_SIZE];
+static uint16_t g_measureCacheTime;
+
 int EEZ_UTFT::measureStr(const char *text, int textLength, font::Font &font, int max_width) {
 	this->font = font;
 
+    int length = 0;
+    while ((textLength == -1 || length < textLength) && text[length]) {
+        if (++length > MEASURE_CACHE_MAX_TEXT_LENGTH) {
+            return measureStrUncached(text, textLength, max_width);
+        }
+    }
+
+    ++g_measureCacheTime;
+
+    MeasuredStr *lru = &g_measureCache[0];
+    for (int i = 0; i < MEASURE_CACHE_SIZE; ++i) {
+        MeasuredStr &measuredStr = g_measureCache[i];
+
+        if (measuredStr.fontData == font.fontData && measuredStr.fontData &&
+            measuredStr.maxWidth == max_width &&
+            measuredStr.textLength == length &&
+            memcmp(measuredStr.text, text, length) == 0)
+        {
+            measuredStr.lastUsed = g_measureCacheTime;
+            return measuredStr.width;
+        }
+
+        if ((uint16_t)(g_measureCacheTime - measuredStr.lastUsed) > (uint16_t)(g_measureCacheTime - lru->lastUsed)) {
+            lru = &measuredStr;
+        }
+    }
+
+    int width = measureStrUncached(text, length, max_width);
+
+    lru->fontData = font.fontData;
+    lru->maxWidth = max_width;
+    lru->textLength = length;
+    memcpy(lru->text, text, length);
+    lru->width = width;
+    lru->lastUsed = g_measureCacheTime;
+
+    return width;
+}
+
+int EEZ_UTFT::measureStrUncached(const char *text, int textLength, int max_width) {
 	int width = 0;
 
     if (textLength == -1) {
@@ -26,6 +26,19 @@ namespace psu {
 namespace gui {
 namespace lcd {
 
+#ifdef EEZ_PSU_SIMULATOR
+/// Display area drawn since the last EEZ_UTFT::takeDirtyRects call, coordinates are inclusive.
+struct DirtyRect {
+    int x1;
+    int y1;
+    int x2;
+    int y2;
+};
+
+/// Max. number of separately tracked dirty rectangles, when exceeded rectangles are merged.
+static const int MAX_DIRTY_RECTS = 8;
+#endif
+
 class EEZ_UTFT : public UTFT {
 public:
     EEZ_UTFT(byte model, int RS, int WR, int CS, int RST, int SER = 0);
@@ -33,17 +46,43 @@ public:
     void drawStr(const char *text, int textLength, int x, int y, int clip_x1, int clip_y1, int clip_x2, int clip_y2, font::Font &font, bool fill_background);
     int measureStr(const char *text, int textLength, font::Font &font, int max_width = 0);
 
-    //void fillRect();
-    //void drawRect();
-    //void drawBitmap();
-    //void drawHLine();
-    //void drawVLine();
+    /// Draw bitmap compressed by compress-gui-bitmaps.py.
+    /// Pixels are streamed into one display window per bitmap (per row in landscape orientation).
+    void drawRleBitmap(int x, int y, int sx, int sy, const uint8_t *data PROGMEM);
+
+    // drawing functions of UTFT which mark the dirty rectangles (simulator only) and count the drawn pixels
+    void clrScr();
+    void fillRect(int x1, int y1, int x2, int y2);
+    void drawRect(int x1, int y1, int x2, int y2);
+    void drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int scale = 1);
+    void drawHLine(int x, int y, int l);
+    void drawVLine(int x, int y, int l);
+    void drawPixel(int x, int y);
+
+#ifdef EEZ_PSU_SIMULATOR
+    /// Copy dirty rectangles (MAX_DIRTY_RECTS at most) to rects and clear them.
+    /// \returns number of dirty rectangles.
+    int takeDirtyRects(DirtyRect *rects);
+#endif
 
 private:
     font::Font font;
 
+#ifdef EEZ_PSU_SIMULATOR
+    DirtyRect m_dirtyRects[MAX_DIRTY_RECTS];
+    int m_numDirtyRects;
+#endif
+
     int8_t drawGlyph(int x1, int y1, int clip_x1, int clip_y1, int clip_x2, int clip_y2, uint8_t encoding, bool fill_background);
+    bool drawStrRun(const char *text, int textLength, int x, int y, int clip_x1, int clip_y1, int clip_x2, int clip_y2);
     int8_t measureGlyph(uint8_t encoding);
+    int measureStrUncached(const char *text, int textLength, int max_width);
+
+#if defined(EEZ_PSU_SIMULATOR) || CONF_DEBUG
+    void markDirty(int x1, int y1, int x2, int y2);
+#else
+    void markDirty(int x1, int y1, int x2, int y2) {}
+#endif
 };
 
 extern EEZ_UTFT lcd;
@@ -20,6 +20,8 @@
 #include "list.h"
 #include "trigger.h"
 #include "channel_dispatcher.h"
+#include "scheduler.h"
+#include "job_queue.h"
 #if OPTION_SD_CARD
 #include "sd_card.h"
 #endif
@@ -58,6 +60,8 @@ void init() {
 }
 
 void resetChannelList(Channel &channel) {
+    job_queue::waitChannelListReaders();
+
     int i = channel.index - 1;
 
     g_channelsLists[i].voltageListLength = 0;
@@ -78,51 +82,71 @@ void reset() {
 }
 
 void setDwellList(Channel &channel, float *list, uint16_t listLength) {
+    job_queue::waitChannelListReaders();
+
     memcpy(g_channelsLists[channel.index - 1].dwellList, list, listLength * sizeof(float));
     g_channelsLists[channel.index - 1].dwellListLength = listLength;
     g_channelsLists[channel.index - 1].changed = true;
 }
 
 float *getDwellList(Channel &channel, uint16_t *listLength) {
+    job_queue::waitChannelListWriters();
+
     *listLength = g_channelsLists[channel.index - 1].dwellListLength;
     return g_channelsLists[channel.index - 1].dwellList;
 }
 
 void setVoltageList(Channel &channel, float *list, uint16_t listLength) {
+    job_queue::waitChannelListReaders();
+
     memcpy(g_channelsLists[channel.index - 1].voltageList, list, listLength * sizeof(float));
     g_channelsLists[channel.index - 1].voltageListLength = listLength;
     g_channelsLists[channel.index - 1].changed = true;
 }
 
 float *getVoltageList(Channel &channel, uint16_t *listLength) {
+    job_queue::waitChannelListWriters();
+
     *listLength = g_channelsLists[channel.index - 1].voltageListLength;
     return g_channelsLists[channel.index - 1].voltageList;
 }
 
 void setCurrentList(Channel &channel, float *list, uint16_t listLength) {
+    job_queue::waitChannelListReaders();
+
     memcpy(g_channelsLists[channel.index - 1].currentList, list, listLength * sizeof(float));
     g_channelsLists[channel.index - 1].currentListLength = listLength;
     g_channelsLists[channel.index - 1].changed = true;
 }
 
 float *getCurrentList(Channel &channel, uint16_t *listLength) {
+    job_queue::waitChannelListWriters();
+
     *listLength = g_channelsLists[channel.index - 1].currentListLength;
     return g_channelsLists[channel.index - 1].currentList;
 }
 
 bool getListsChanged(Channel &channel) {
+    job_queue::waitChannelListWriters();
+
     return g_channelsLists[channel.index - 1].changed;
 }
 
 void setListsChanged(Channel &channel, bool changed) {
+    job_queue::waitChannelListReaders();
+
     g_channelsLists[channel.index - 1].changed = changed;
 }
 
 uint16_t getListCount(Channel &channel) {
+    job_queue::waitChannelListWriters();
+
     return g_channelsLists[channel.index - 1].count;
 }
 
 void setListCount(Channel &channel, uint16_t value) {
+    job_queue::waitChannelListReaders();
+
     g_channelsLists[channel.index - 1].count = value;
 }
 
@@ -441,8 +465,7 @@ void tick(uint32_t tick_usec) {
                     return;
                 }
 
-                channel_dispatcher::setVoltage(channel, voltage);
-                channel_dispatcher::setCurrent(channel, current);
+                channel_dispatcher::setVoltageAndCurrent(channel, voltage, current);
 
                 uint32_t dwell = (uint32_t)round(g_channelsLists[i].dwellList[g_execution[i].it % g_channelsLists[i].dwellListLength] * 1000000L);
                 g_execution[i].nextPointTime = tick_usec + dwell;
@@ -455,6 +478,37 @@ bool isActive() {
     return g_active;
 }
 
+bool isPointDue(uint32_t tick_usec, uint32_t guardTime) {
+    for (int i = 0; i < CH_NUM; ++i) {
+        if (g_execution[i].counter >= 0) {
+            int32_t diff = g_execution[i].nextPointTime - tick_usec;
+            if (diff < (int32_t)guardTime) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+uint32_t getIdleTime(uint32_t tick_usec) {
+    uint32_t idleTime = scheduler::IDLE_FOREVER;
+    for (int i = 0; i < CH_NUM; ++i) {
+        if (g_execution[i].counter >= 0) {
+            if (g_execution[i].it == -1) {
+                return 0;
+            }
+            int32_t diff = g_execution[i].nextPointTime - tick_usec;
+            if (diff <= 0) {
+                return 0;
+            }
+            if ((uint32_t)diff < idleTime) {
+                idleTime = diff;
+            }
+        }
+    }
+    return idleTime;
+}
+
 void abort() {
     for (int i = 0; i < CH_NUM; ++i) {
         g_execution[i].counter = -1;
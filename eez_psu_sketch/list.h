@@ -60,6 +60,12 @@ void tick(uint32_t tick_usec);
 
 bool isActive();
 
+/// Is the next list point on some channel due in less than guardTime microseconds?
+bool isPointDue(uint32_t tick_usec, uint32_t guardTime);
+
+/// Time (in microseconds) until the next list point on some channel is due, see scheduler::TaskIdleFunction.
+uint32_t getIdleTime(uint32_t tick_usec);
+
 void abort();
 
 }
@@ -0,0 +1,194 @@
+/*
+ * EEZ PSU Firmware
+ * Copyright (C) 2018-present, Envox d.o.o.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <ctype.h>
+#include "psu.h"
+#include "macro.h"
+
+#if NUM_MACRO_LOCATIONS
+
+namespace eez {
+namespace psu {
+namespace macro {
+
+/// Macro parsed with SCPI_Compile, ready for SCPI_ExecuteCompiled.
+struct CompiledMacro {
+    /// False if macro is defined, but not compiled yet (i.e. after power up).
+    bool isCompiled;
+    uint16_t length;
+    char data[MACRO_COMPILED_MAX_LENGTH];
+};
+
+static char g_names[NUM_MACRO_LOCATIONS][MACRO_NAME_MAX_LENGTH + 1];
+static CompiledMacro g_compiled[NUM_MACRO_LOCATIONS];
+static Timing g_timing[NUM_MACRO_LOCATIONS];
+
+static bool g_executing;
+
+////////////////////////////////////////////////////////////////////////////////
+
+static bool isNameEqual(const char *name1, const char *name2, size_t name2Length) {
+    size_t i;
+    for (i = 0; i < name2Length && name1[i]; ++i) {
+        if (toupper(name1[i]) != toupper(name2[i])) {
+            return false;
+        }
+    }
+    return i == name2Length && !name1[i];
+}
+
+static bool compile(scpi_t *context, const char *text, size_t textLength, CompiledMacro &compiled, uint32_t &duration) {
+    // SCPI_Compile modifies the program message while composing compound headers
+    char buffer[MACRO_TEXT_MAX_LENGTH + 1];
+    memcpy(buffer, text, textLength);
+    buffer[textLength] = 0;
+
+    uint32_t start = micros();
+    size_t length = SCPI_Compile(context, buffer, textLength, compiled.data, sizeof(compiled.data));
+    duration = micros() - start;
+
+    if (length == 0) {
+        return false;
+    }
+
+    compiled.length = length;
+    compiled.isCompiled = true;
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void init() {
+    Macro macro;
+    for (int i = 0; i < NUM_MACRO_LOCATIONS; ++i) {
+        if (load(i, macro)) {
+            strcpy(g_names[i], macro.name);
+        } else {
+            g_names[i][0] = 0;
+        }
+    }
+}
+
+int find(const char *name, size_t nameLength) {
+    for (int i = 0; i < NUM_MACRO_LOCATIONS; ++i) {
+        if (g_names[i][0] && isNameEqual(g_names[i], name, nameLength)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+int findForDefine(const char *name, size_t nameLength) {
+    int location = find(name, nameLength);
+    if (location != -1) {
+        return location;
+    }
+
+    for (int i = 0; i < NUM_MACRO_LOCATIONS; ++i) {
+        if (!g_names[i][0]) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+bool isValid(int location) {
+    return g_names[location][0] != 0;
+}
+
+void getName(int location, char *name, size_t count) {
+    strncpy(name, g_names[location], count - 1);
+    name[count - 1] = 0;
+}
+
+bool define(scpi_t *context, int location, const char *name, size_t nameLength, const char *text, size_t textLength, Macro &macro) {
+    CompiledMacro compiled;
+    uint32_t duration;
+    if (!compile(context, text, textLength, compiled, duration)) {
+        return false;
+    }
+
+    g_compiled[location] = compiled;
+    g_timing[location].compileDuration = duration;
+    g_timing[location].lastDuration = 0;
+    g_timing[location].numExecuted = 0;
+
+    memset(&macro, 0, sizeof(Macro));
+    memcpy(macro.name, name, nameLength);
+    memcpy(macro.text, text, textLength);
+
+    strcpy(g_names[location], macro.name);
+
+    return true;
+}
+
+void remove(int location, Macro &macro) {
+    memset(&macro, 0, sizeof(Macro));
+
+    g_names[location][0] = 0;
+    g_compiled[location].isCompiled = false;
+    memset(&g_timing[location], 0, sizeof(Timing));
+}
+
+bool load(int location, Macro &macro) {
+    return persist_conf::loadMacro(location, &macro) && macro.name[0];
+}
+
+bool execute(scpi_t *context, int location) {
+    if (g_executing) {
+        // macro can't execute another macro
+        SCPI_ErrorPush(context, SCPI_ERROR_MACRO_RECURSION_ERROR);
+        return false;
+    }
+
+    CompiledMacro &compiled = g_compiled[location];
+
+    if (!compiled.isCompiled) {
+        Macro macro;
+        if (!load(location, macro)) {
+            SCPI_ErrorPush(context, SCPI_ERROR_EXECUTION_ERROR);
+            return false;
+        }
+
+        if (!compile(context, macro.text, strlen(macro.text), compiled, g_timing[location].compileDuration)) {
+            return false;
+        }
+    }
+
+    g_executing = true;
+
+    uint32_t start = micros();
+    bool result = SCPI_ExecuteCompiled(context, compiled.data, compiled.length) ? true : false;
+    g_timing[location].lastDuration = micros() - start;
+    ++g_timing[location].numExecuted;
+
+    g_executing = false;
+
+    return result;
+}
+
+const Timing &getTiming(int location) {
+    return g_timing[location];
+}
+
+}
+}
+} // namespace eez::psu::macro
+
+#endif
@@ -0,0 +1,76 @@
+/*
+ * EEZ PSU Firmware
+ * Copyright (C) 2018-present, Envox d.o.o.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "persist_conf.h"
+
+namespace eez {
+namespace psu {
+/// User defined SCPI macros (MEMory:MACRo).
+/// Macro is parsed once, when defined, and then replayed without parsing.
+namespace macro {
+
+/// Macro definition stored in EEPROM.
+struct Macro {
+    persist_conf::BlockHeader header;
+    char name[MACRO_NAME_MAX_LENGTH + 1];
+    char text[MACRO_TEXT_MAX_LENGTH + 1];
+};
+
+/// Time (in microseconds) spent in parsing and executing the macro.
+struct Timing {
+    /// Time spent in parsing of the macro definition, i.e. time saved on every replay.
+    uint32_t compileDuration;
+    /// Time spent in the last replay of the macro.
+    uint32_t lastDuration;
+    uint32_t numExecuted;
+};
+
+void init();
+
+/// Find macro location by name.
+/// \returns macro location or -1 if not found.
+int find(const char *name, size_t nameLength);
+
+/// Find existing macro location with the same name or first free location.
+/// \returns macro location or -1 if there is no free location.
+int findForDefine(const char *name, size_t nameLength);
+
+bool isValid(int location);
+void getName(int location, char *name, size_t count);
+
+/// Parse the macro definition and prepare it for execution.
+/// Macro is not stored in EEPROM, use Macro and persist_conf::saveMacro for that.
+/// \returns false and pushes SCPI error if definition is not valid.
+bool define(scpi_t *context, int location, const char *name, size_t nameLength, const char *text, size_t textLength, Macro &macro);
+
+/// Forget the macro. Macro must also be deleted from EEPROM with persist_conf::saveMacro.
+void remove(int location, Macro &macro);
+
+/// Read the macro definition from the EEPROM.
+bool load(int location, Macro &macro);
+
+/// Execute the macro in the given SCPI context.
+bool execute(scpi_t *context, int location);
+
+const Timing &getTiming(int location);
+
+}
+}
+} // namespace eez::psu::macro
@@ -20,6 +20,7 @@
 #include "eeprom.h"
 #include "event_queue.h"
 #include "profile.h"
+#include "macro.h"
 #if OPTION_ENCODER
 #include "encoder.h"
 #endif
@@ -41,6 +42,7 @@ enum PersistConfSection {
     PERSIST_CONF_BLOCK_DEVICE2,
     PERSIST_CONF_BLOCK_CH_CAL,
     PERSIST_CONF_BLOCK_FIRST_PROFILE,
+    PERSIST_CONF_BLOCK_FIRST_MACRO,
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -49,6 +51,7 @@ static const uint16_t DEV_CONF_VERSION = 0x0008L;
 static const uint16_t DEV_CONF2_VERSION = 0x0002L;
 static const uint16_t CH_CAL_CONF_VERSION = 0x0003L;
 static const uint16_t PROFILE_VERSION = 0x0008L;
+static const uint16_t MACRO_VERSION = 0x0001L;
 
 static const uint16_t PERSIST_CONF_DEVICE_ADDRESS = 1024;
 static const uint16_t PERSIST_CONF_DEVICE2_ADDRESS = 1536;
@@ -59,6 +62,9 @@ static const uint16_t PERSIST_CONF_CH_CAL_BLOCK_SIZE = 512;
 static const uint16_t PERSIST_CONF_FIRST_PROFILE_ADDRESS = 5120;
 static const uint16_t PERSIST_CONF_PROFILE_BLOCK_SIZE = 1024;
 
+static const uint16_t PERSIST_CONF_FIRST_MACRO_ADDRESS = 20480;
+static const uint16_t PERSIST_CONF_MACRO_BLOCK_SIZE = 256;
+
 static const uint32_t ONTIME_MAGIC = 0xA7F31B3CL;
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -91,6 +97,7 @@ uint16_t get_address(PersistConfSection section, Channel *channel = 0) {
     case PERSIST_CONF_BLOCK_DEVICE2:  return PERSIST_CONF_DEVICE2_ADDRESS;
     case PERSIST_CONF_BLOCK_CH_CAL:  return PERSIST_CONF_CH_CAL_ADDRESS + (channel->index - 1) * PERSIST_CONF_CH_CAL_BLOCK_SIZE;
     case PERSIST_CONF_BLOCK_FIRST_PROFILE: return PERSIST_CONF_FIRST_PROFILE_ADDRESS;
+    case PERSIST_CONF_BLOCK_FIRST_MACRO: return PERSIST_CONF_FIRST_MACRO_ADDRESS;
     }
     return -1;
 }
@@ -99,6 +106,10 @@ uint16_t get_profile_address(int location) {
     return get_address(PERSIST_CONF_BLOCK_FIRST_PROFILE) + location * PERSIST_CONF_PROFILE_BLOCK_SIZE;
 }
 
+uint16_t get_macro_address(int location) {
+    return get_address(PERSIST_CONF_BLOCK_FIRST_MACRO) + location * PERSIST_CONF_MACRO_BLOCK_SIZE;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 static void initDevice() {
@@ -409,6 +420,18 @@ bool saveProfile(int location, profile::Parameters *profile) {
     return save((BlockHeader *)profile, sizeof(profile::Parameters), get_profile_address(location), PROFILE_VERSION);
 }
 
+bool loadMacro(int location, macro::Macro *macro) {
+    if (eeprom::g_testResult == psu::TEST_OK) {
+        eeprom::read((uint8_t *)macro, sizeof(macro::Macro), get_macro_address(location));
+        return check_block((BlockHeader *)macro, sizeof(macro::Macro), MACRO_VERSION);
+    }
+    return false;
+}
+
+bool saveMacro(int location, macro::Macro *macro) {
+    return save((BlockHeader *)macro, sizeof(macro::Macro), get_macro_address(location), MACRO_VERSION);
+}
+
 uint32_t readTotalOnTime(int type) {
 	uint32_t buffer[6];
 
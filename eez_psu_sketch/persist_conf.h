@@ -27,6 +27,12 @@ namespace profile {
 
 struct Parameters;
 
+}
+
+namespace macro {
+
+struct Macro;
+
 }
 }
 } // namespace eez::psu::profile
@@ -153,6 +159,9 @@ bool saveChannelCalibration(Channel *channel);
 bool loadProfile(int location, profile::Parameters *profile);
 bool saveProfile(int location, profile::Parameters *profile);
 
+bool loadMacro(int location, macro::Macro *macro);
+bool saveMacro(int location, macro::Macro *macro);
+
 uint32_t readTotalOnTime(int type);
 bool writeTotalOnTime(int type, uint32_t time);
 
@@ -227,128 +227,146 @@ void flush() {
     }
 }
 
-bool saveAtLocation(int location, char *name) {
-    if (location >= 0 && location < NUM_PROFILE_LOCATIONS) {
-        Parameters currentProfile;
-
-        if (!persist_conf::loadProfile(location, &currentProfile)) {
-            currentProfile.flags.isValid = false;
-        }
-
-        Parameters profile;
-        memset(&profile, 0, sizeof(Parameters));
-
-        profile.flags.isValid = true;
+void fillProfile(Parameters *profile) {
+    memset(profile, 0, sizeof(Parameters));
 
-        profile.flags.channelsCoupling = channel_dispatcher::getType();
+    profile->flags.isValid = true;
 
-        // name
-        if (location > 0) {
-			if (name) {
-				strcpy(profile.name, name);
-			} else {
-				getSaveName(&currentProfile, profile.name);
-			}
-        }
+    profile->flags.channelsCoupling = channel_dispatcher::getType();
 
-        noInterrupts();
+    noInterrupts();
 
-        profile.flags.powerIsUp = psu::isPowerUp();
+    profile->flags.powerIsUp = psu::isPowerUp();
 
-        for (int i = 0; i < CH_MAX; ++i) {
-			if (i < CH_NUM) {
-				Channel &channel = Channel::get(i);
+    for (int i = 0; i < CH_MAX; ++i) {
+        if (i < CH_NUM) {
+            Channel &channel = Channel::get(i);
 
-				profile.channels[i].flags.parameters_are_valid = 1;
+            profile->channels[i].flags.parameters_are_valid = 1;
 
-				profile.channels[i].flags.cal_enabled = channel.isCalibrationEnabled();
-				profile.channels[i].flags.output_enabled = channel.flags.outputEnabled;
-				profile.channels[i].flags.sense_enabled = channel.flags.senseEnabled;
+            profile->channels[i].flags.cal_enabled = channel.isCalibrationEnabled();
+            profile->channels[i].flags.output_enabled = channel.flags.outputEnabled;
+            profile->channels[i].flags.sense_enabled = channel.flags.senseEnabled;
 
-				if (channel.getFeatures() & CH_FEATURE_RPROG) {
-					profile.channels[i].flags.rprog_enabled = channel.flags.rprogEnabled;
-				} else {
-					profile.channels[i].flags.rprog_enabled = 0;
-				}
+            if (channel.getFeatures() & CH_FEATURE_RPROG) {
+                profile->channels[i].flags.rprog_enabled = channel.flags.rprogEnabled;
+            } else {
+                profile->channels[i].flags.rprog_enabled = 0;
+            }
 
-				if (channel.getFeatures() & CH_FEATURE_LRIPPLE) {
-					profile.channels[i].flags.lripple_auto_enabled = Channel::get(i).flags.lrippleAutoEnabled;
-				} else {
-					profile.channels[i].flags.lripple_auto_enabled = 0;
-				}
+            if (channel.getFeatures() & CH_FEATURE_LRIPPLE) {
+                profile->channels[i].flags.lripple_auto_enabled = Channel::get(i).flags.lrippleAutoEnabled;
+            } else {
+                profile->channels[i].flags.lripple_auto_enabled = 0;
+            }
 
-				profile.channels[i].flags.u_state = channel.prot_conf.flags.u_state;
-				profile.channels[i].flags.i_state = channel.prot_conf.flags.i_state;
-				profile.channels[i].flags.p_state = channel.prot_conf.flags.p_state;
+            profile->channels[i].flags.u_state = channel.prot_conf.flags.u_state;
+            profile->channels[i].flags.i_state = channel.prot_conf.flags.i_state;
+            profile->channels[i].flags.p_state = channel.prot_conf.flags.p_state;
 
-				profile.channels[i].u_set = channel.getUSetUnbalanced();
-				profile.channels[i].u_step = channel.u.step;
-				profile.channels[i].u_limit = channel.u.limit;
+            profile->channels[i].u_set = channel.getUSetUnbalanced();
+            profile->channels[i].u_step = channel.u.step;
+            profile->channels[i].u_limit = channel.u.limit;
 
-				profile.channels[i].i_set = channel.getISetUnbalanced();
-				profile.channels[i].i_step = channel.i.step;
-				profile.channels[i].i_limit = channel.i.limit;
+            profile->channels[i].i_set = channel.getISetUnbalanced();
+            profile->channels[i].i_step = channel.i.step;
+            profile->channels[i].i_limit = channel.i.limit;
 
-				profile.channels[i].p_limit = channel.p_limit;
+            profile->channels[i].p_limit = channel.p_limit;
 
-				profile.channels[i].u_delay = channel.prot_conf.u_delay;
-				profile.channels[i].u_level = channel.prot_conf.u_level;
-				profile.channels[i].i_delay = channel.prot_conf.i_delay;
-				profile.channels[i].p_delay = channel.prot_conf.p_delay;
-				profile.channels[i].p_level = channel.prot_conf.p_level;
+            profile->channels[i].u_delay = channel.prot_conf.u_delay;
+            profile->channels[i].u_level = channel.prot_conf.u_level;
+            profile->channels[i].i_delay = channel.prot_conf.i_delay;
+            profile->channels[i].p_delay = channel.prot_conf.p_delay;
+            profile->channels[i].p_level = channel.prot_conf.p_level;
 
-                profile.channels[i].flags.displayValue1 = channel.flags.displayValue1;
-                profile.channels[i].flags.displayValue2 = channel.flags.displayValue2;
-                profile.channels[i].ytViewRate = channel.ytViewRate;
+            profile->channels[i].flags.displayValue1 = channel.flags.displayValue1;
+            profile->channels[i].flags.displayValue2 = channel.flags.displayValue2;
+            profile->channels[i].ytViewRate = channel.ytViewRate;
 
 #ifdef EEZ_PSU_SIMULATOR
-				profile.channels[i].load_enabled = channel.simulator.load_enabled;
-				profile.channels[i].load = channel.simulator.load;
-				profile.channels[i].voltProgExt = channel.simulator.voltProgExt;
+            profile->channels[i].load_enabled = channel.simulator.load_enabled;
+            profile->channels[i].load = channel.simulator.load;
+            profile->channels[i].voltProgExt = channel.simulator.voltProgExt;
 #endif
 
-                profile.channels[i].flags.u_triggerMode = channel.flags.voltageTriggerMode;
-                profile.channels[i].flags.i_triggerMode = channel.flags.currentTriggerMode;
-                profile.channels[i].u_triggerValue = trigger::getVoltage(channel);
-                profile.channels[i].i_triggerValue = trigger::getCurrent(channel);
-                profile.channels[i].listCount = list::getListCount(channel);
+            profile->channels[i].flags.u_triggerMode = channel.flags.voltageTriggerMode;
+            profile->channels[i].flags.i_triggerMode = channel.flags.currentTriggerMode;
+            profile->channels[i].u_triggerValue = trigger::getVoltage(channel);
+            profile->channels[i].i_triggerValue = trigger::getCurrent(channel);
+            profile->channels[i].listCount = list::getListCount(channel);
+        } else {
+            profile->channels[i].flags.parameters_are_valid = 0;
+        }
+    }
+
+    for (int i = 0; i < temp_sensor::MAX_NUM_TEMP_SENSORS; ++i) {
+        if (i < temp_sensor::NUM_TEMP_SENSORS) {
+            memcpy(profile->temp_prot + i, &temperature::sensors[i].prot_conf, sizeof(temperature::ProtectionConfiguration));
+        } else {
+            profile->temp_prot[i].sensor = i;
+            if (profile->temp_prot[i].sensor == temp_sensor::AUX) {
+                profile->temp_prot[i].delay = OTP_AUX_DEFAULT_DELAY;
+                profile->temp_prot[i].level = OTP_AUX_DEFAULT_LEVEL;
+                profile->temp_prot[i].state = OTP_AUX_DEFAULT_STATE;
+            } else {
+                profile->temp_prot[i].delay = OTP_CH_DEFAULT_DELAY;
+                profile->temp_prot[i].level = OTP_CH_DEFAULT_LEVEL;
+                profile->temp_prot[i].state = OTP_CH_DEFAULT_STATE;
+            }
+        }
+    }
+
+    interrupts();
+}
 
 #if OPTION_SD_CARD
-                if (list::getListsChanged(channel)) {
-                    char filePath[MAX_PATH_LENGTH];
-                    getChannelProfileListFilePath(channel, location, filePath);
-                    if (list::areListLengthsEquivalent(channel)) {
-                        list::saveList(channel, filePath, NULL);
-                    } else {
-                        SD.remove(filePath);
-                    }
-                }
+void saveChannelList(Channel &channel, int location) {
+    if (list::getListsChanged(channel)) {
+        char filePath[MAX_PATH_LENGTH];
+        getChannelProfileListFilePath(channel, location, filePath);
+        if (list::areListLengthsEquivalent(channel)) {
+            list::saveList(channel, filePath, NULL);
+        } else {
+            SD.remove(filePath);
+        }
+    }
+}
 #endif
+
+bool saveProfileToLocation(int location, Parameters *profile, char *name) {
+    if (location >= 0 && location < NUM_PROFILE_LOCATIONS) {
+        // name
+        if (location > 0) {
+            if (name) {
+                strcpy(profile->name, name);
             } else {
-				profile.channels[i].flags.parameters_are_valid = 0;
-			}
+                Parameters currentProfile;
+                if (!persist_conf::loadProfile(location, &currentProfile)) {
+                    currentProfile.flags.isValid = false;
+                }
+                getSaveName(&currentProfile, profile->name);
+            }
         }
 
-		for (int i = 0; i < temp_sensor::MAX_NUM_TEMP_SENSORS; ++i) {
-			if (i < temp_sensor::NUM_TEMP_SENSORS) {
-				memcpy(profile.temp_prot + i, &temperature::sensors[i].prot_conf, sizeof(temperature::ProtectionConfiguration));
-			} else {
-				profile.temp_prot[i].sensor = i;
-                if (profile.temp_prot[i].sensor == temp_sensor::AUX) {
-				    profile.temp_prot[i].delay = OTP_AUX_DEFAULT_DELAY;
-				    profile.temp_prot[i].level = OTP_AUX_DEFAULT_LEVEL;
-				    profile.temp_prot[i].state = OTP_AUX_DEFAULT_STATE;
-                } else {
-				    profile.temp_prot[i].delay = OTP_CH_DEFAULT_DELAY;
-				    profile.temp_prot[i].level = OTP_CH_DEFAULT_LEVEL;
-				    profile.temp_prot[i].state = OTP_CH_DEFAULT_STATE;
-                }
-			}
-		}
+        return persist_conf::saveProfile(location, profile);
+    }
+
+    return false;
+}
 
-        interrupts();
+bool saveAtLocation(int location, char *name) {
+    if (location >= 0 && location < NUM_PROFILE_LOCATIONS) {
+        Parameters profile;
+        fillProfile(&profile);
+
+#if OPTION_SD_CARD
+        for (int i = 0; i < CH_NUM; ++i) {
+            saveChannelList(Channel::get(i), location);
+        }
+#endif
 
-        return persist_conf::saveProfile(location, &profile);
+        return saveProfileToLocation(location, &profile, name);
     }
 
     return false;
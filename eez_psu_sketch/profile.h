@@ -103,6 +103,15 @@ void saveImmediately();
 void flush();
 bool saveAtLocation(int location, char *name = 0);
 
+/// Take a snapshot of the current PSU state (without name).
+void fillProfile(Parameters *profile);
+#if OPTION_SD_CARD
+/// Save lists of the channel to the SD card files belonging to the profile location.
+void saveChannelList(Channel &channel, int location);
+#endif
+/// Write previously filled profile to the storage location.
+bool saveProfileToLocation(int location, Parameters *profile, char *name = 0);
+
 bool deleteLocation(int location);
 bool deleteAll();
 
@@ -21,6 +21,8 @@
 
 #if OPTION_ETHERNET
 #include "ethernet.h"
+#include "telemetry.h"
+#include "http_server.h"
 #endif
 
 #include "bp.h"
@@ -58,6 +60,9 @@
 #include "channel_dispatcher.h"
 #include "trigger.h"
 #include "list.h"
+#include "job_queue.h"
+#include "macro.h"
+#include "scheduler.h"
 
 namespace eez {
 namespace psu {
@@ -80,11 +85,11 @@ static bool g_shutdownOnNextTick;
 
 RLState g_rlState = RL_STATE_LOCAL;
 
-static uint32_t g_mainLoopCounter;
-
 ////////////////////////////////////////////////////////////////////////////////
 
 static bool testShield();
+static void addTasks();
+static void notifyTick(uint32_t tick_usec);
 
 #if (EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R3B4 || EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R5B12) && OPTION_SYNC_MASTER && !defined(EEZ_PSU_SIMULATOR)
 static void startMasterSync();
@@ -109,6 +114,8 @@ void loadConf() {
 ////////////////////////////////////////////////////////////////////////////////
 
 void init() {
+    addTasks();
+
     // initialize shield
     eez_psu_init();
 
@@ -146,6 +153,10 @@ void init() {
 
     list::init();
 
+#if NUM_MACRO_LOCATIONS
+    macro::init();
+#endif
+
 #if OPTION_ETHERNET
 #if OPTION_DISPLAY
     gui::showEthernetInit();
@@ -223,231 +234,95 @@ bool test() {
 
 ////////////////////////////////////////////////////////////////////////////////
 
-static bool psuReset() {
+static void resetContext(scpi_t *context) {
     // *ESE 0
-    SCPI_RegSet(&serial::scpi_context, SCPI_REG_ESE, 0);
-#if OPTION_ETHERNET
-	if (ethernet::g_testResult == TEST_OK) {
-        SCPI_RegSet(&ethernet::scpi_context, SCPI_REG_ESE, 0);
-	}
-#endif
+    SCPI_RegSet(context, SCPI_REG_ESE, 0);
 
     // *SRE 0
-    SCPI_RegSet(&serial::scpi_context, SCPI_REG_ESE, 0);
-#if OPTION_ETHERNET
-	if (ethernet::g_testResult == TEST_OK) {
-        SCPI_RegSet(&ethernet::scpi_context, SCPI_REG_SRE, 0);
-	}
-#endif
+    SCPI_RegSet(context, SCPI_REG_SRE, 0);
 
     // *STB 0
-    SCPI_RegSet(&serial::scpi_context, SCPI_REG_ESE, 0);
-#if OPTION_ETHERNET
-	if (ethernet::g_testResult == TEST_OK) {
-        SCPI_RegSet(&ethernet::scpi_context, SCPI_REG_STB, 0);
-	}
-#endif
+    SCPI_RegSet(context, SCPI_REG_STB, 0);
 
     // *ESR 0
-    SCPI_RegSet(&serial::scpi_context, SCPI_REG_ESE, 0);
-#if OPTION_ETHERNET
-	if (ethernet::g_testResult == TEST_OK) {
-        SCPI_RegSet(&ethernet::scpi_context, SCPI_REG_ESR, 0);
-	}
-#endif
+    SCPI_RegSet(context, SCPI_REG_ESR, 0);
 
     // STAT:OPER[:EVEN] 0
-    SCPI_RegSet(&serial::scpi_context, SCPI_REG_OPER, 0);
-#if OPTION_ETHERNET
-	if (ethernet::g_testResult == TEST_OK) {
-        SCPI_RegSet(&ethernet::scpi_context, SCPI_REG_OPER, 0);
-	}
-#endif
+    SCPI_RegSet(context, SCPI_REG_OPER, 0);
 
     // STAT:OPER:COND 0
-    reg_set(&serial::scpi_context, SCPI_PSU_REG_OPER_COND, 0);
-#if OPTION_ETHERNET
-	if (ethernet::g_testResult == TEST_OK) {
-        reg_set(&ethernet::scpi_context, SCPI_PSU_REG_OPER_COND, 0);
-	}
-#endif
+    reg_set(context, SCPI_PSU_REG_OPER_COND, 0);
 
     // STAT:OPER:ENAB 0
-    SCPI_RegSet(&serial::scpi_context, SCPI_REG_OPERE, 0);
-#if OPTION_ETHERNET
-    if (ethernet::g_testResult == TEST_OK) {
-        SCPI_RegSet(&ethernet::scpi_context, SCPI_REG_OPERE, 0);
-	}
-#endif
+    SCPI_RegSet(context, SCPI_REG_OPERE, 0);
 
     // STAT:OPER:INST[:EVEN] 0
-    reg_set(&serial::scpi_context, SCPI_PSU_REG_OPER_INST_EVENT, 0);
-#if OPTION_ETHERNET
-	if (ethernet::g_testResult == TEST_OK) {
-        reg_set(&ethernet::scpi_context, SCPI_PSU_REG_OPER_INST_EVENT, 0);
-	}
-#endif
+    reg_set(context, SCPI_PSU_REG_OPER_INST_EVENT, 0);
 
     // STAT:OPER:INST:COND 0
-    reg_set(&serial::scpi_context, SCPI_PSU_REG_OPER_INST_COND, 0);
-#if OPTION_ETHERNET
-	if (ethernet::g_testResult == TEST_OK) {
-        reg_set(&ethernet::scpi_context, SCPI_PSU_REG_OPER_INST_COND, 0);
-	}
-#endif
+    reg_set(context, SCPI_PSU_REG_OPER_INST_COND, 0);
 
     // STAT:OPER:INST:ENAB 0
-    reg_set(&serial::scpi_context, SCPI_PSU_REG_OPER_INST_ENABLE, 0);
-#if OPTION_ETHERNET
-    if (ethernet::g_testResult == TEST_OK) {
-        reg_set(&ethernet::scpi_context, SCPI_PSU_REG_OPER_INST_ENABLE, 0);
-	}
-#endif
+    reg_set(context, SCPI_PSU_REG_OPER_INST_ENABLE, 0);
 
     // STAT:OPER:INST:ISUM[:EVEN] 0
-    reg_set(&serial::scpi_context, SCPI_PSU_CH_REG_OPER_INST_ISUM_EVENT1, 0);
-#if OPTION_ETHERNET
-	if (ethernet::g_testResult == TEST_OK) {
-        reg_set(&ethernet::scpi_context, SCPI_PSU_CH_REG_OPER_INST_ISUM_EVENT1, 0);
-	}
-#endif
-
-    reg_set(&serial::scpi_context, SCPI_PSU_CH_REG_OPER_INST_ISUM_EVENT2, 0);
-#if OPTION_ETHERNET
-	if (ethernet::g_testResult == TEST_OK) {
-        reg_set(&ethernet::scpi_context, SCPI_PSU_CH_REG_OPER_INST_ISUM_EVENT2, 0);
-	}
-#endif
+    reg_set(context, SCPI_PSU_CH_REG_OPER_INST_ISUM_EVENT1, 0);
+    reg_set(context, SCPI_PSU_CH_REG_OPER_INST_ISUM_EVENT2, 0);
 
     // STAT:OPER:INST:ISUM:COND 0
-    reg_set(&serial::scpi_context, SCPI_PSU_CH_REG_OPER_INST_ISUM_COND1, 0);
-#if OPTION_ETHERNET
-	if (ethernet::g_testResult == TEST_OK) {
-        reg_set(&ethernet::scpi_context, SCPI_PSU_CH_REG_OPER_INST_ISUM_COND1, 0);
-	}
-#endif
-
-    reg_set(&serial::scpi_context, SCPI_PSU_CH_REG_OPER_INST_ISUM_COND2, 0);
-#if OPTION_ETHERNET
-    if (ethernet::g_testResult == TEST_OK) {
-        reg_set(&ethernet::scpi_context, SCPI_PSU_CH_REG_OPER_INST_ISUM_COND2, 0);
-	}
-#endif
+    reg_set(context, SCPI_PSU_CH_REG_OPER_INST_ISUM_COND1, 0);
+    reg_set(context, SCPI_PSU_CH_REG_OPER_INST_ISUM_COND2, 0);
 
     // STAT:OPER:INST:ISUM:ENAB 0
-    reg_set(&serial::scpi_context, SCPI_PSU_CH_REG_OPER_INST_ISUM_ENABLE1, 0);
-#if OPTION_ETHERNET
-    if (ethernet::g_testResult == TEST_OK) {
-        reg_set(&ethernet::scpi_context, SCPI_PSU_CH_REG_OPER_INST_ISUM_ENABLE1, 0);
-	}
-#endif
-
-    reg_set(&serial::scpi_context, SCPI_PSU_CH_REG_OPER_INST_ISUM_ENABLE2, 0);
-#if OPTION_ETHERNET
-    if (ethernet::g_testResult == TEST_OK) {
-        reg_set(&ethernet::scpi_context, SCPI_PSU_CH_REG_OPER_INST_ISUM_ENABLE2, 0);
-	}
-#endif
+    reg_set(context, SCPI_PSU_CH_REG_OPER_INST_ISUM_ENABLE1, 0);
+    reg_set(context, SCPI_PSU_CH_REG_OPER_INST_ISUM_ENABLE2, 0);
 
     // STAT:QUES[:EVEN] 0
-    SCPI_RegSet(&serial::scpi_context, SCPI_REG_QUES, 0);
-#if OPTION_ETHERNET
-    if (ethernet::g_testResult == TEST_OK) {
-        SCPI_RegSet(&ethernet::scpi_context, SCPI_REG_QUES, 0);
-	}
-#endif
+    SCPI_RegSet(context, SCPI_REG_QUES, 0);
 
     // STAT:QUES:COND 0
-    reg_set(&serial::scpi_context, SCPI_PSU_REG_QUES_COND, 0);
-#if OPTION_ETHERNET
-    if (ethernet::g_testResult == TEST_OK) {
-        reg_set(&ethernet::scpi_context, SCPI_PSU_REG_QUES_COND, 0);
-	}
-#endif
+    reg_set(context, SCPI_PSU_REG_QUES_COND, 0);
 
     // STAT:QUES:ENAB 0
-    SCPI_RegSet(&serial::scpi_context, SCPI_REG_QUESE, 0);
-#if OPTION_ETHERNET
-    if (ethernet::g_testResult == TEST_OK) {
-        SCPI_RegSet(&ethernet::scpi_context, SCPI_REG_QUESE, 0);
-	}
-#endif
+    SCPI_RegSet(context, SCPI_REG_QUESE, 0);
 
     // STAT:QUES:INST[:EVEN] 0
-    reg_set(&serial::scpi_context, SCPI_PSU_REG_QUES_INST_EVENT, 0);
-#if OPTION_ETHERNET
-    if (ethernet::g_testResult == TEST_OK) {
-        reg_set(&ethernet::scpi_context, SCPI_PSU_REG_QUES_INST_EVENT, 0);
-	}
-#endif
+    reg_set(context, SCPI_PSU_REG_QUES_INST_EVENT, 0);
 
     // STAT:QUES:INST:COND 0
-    reg_set(&serial::scpi_context, SCPI_PSU_REG_QUES_INST_COND, 0);
-#if OPTION_ETHERNET
-    if (ethernet::g_testResult == TEST_OK) {
-        reg_set(&ethernet::scpi_context, SCPI_PSU_REG_QUES_INST_COND, 0);
-	}
-#endif
+    reg_set(context, SCPI_PSU_REG_QUES_INST_COND, 0);
 
     // STAT:QUES:INST:ENAB 0
-    reg_set(&serial::scpi_context, SCPI_PSU_REG_QUES_INST_ENABLE, 0);
-#if OPTION_ETHERNET
-    if (ethernet::g_testResult == TEST_OK) {
-        reg_set(&ethernet::scpi_context, SCPI_PSU_REG_QUES_INST_ENABLE, 0);
-	}
-#endif
+    reg_set(context, SCPI_PSU_REG_QUES_INST_ENABLE, 0);
 
     // STAT:QUES:INST:ISUM[:EVEN] 0
-    reg_set(&serial::scpi_context, SCPI_PSU_CH_REG_QUES_INST_ISUM_EVENT1, 0);
-#if OPTION_ETHERNET
-    if (ethernet::g_testResult == TEST_OK) {
-        reg_set(&ethernet::scpi_context, SCPI_PSU_CH_REG_QUES_INST_ISUM_EVENT1, 0);
-	}
-#endif
-
-    reg_set(&serial::scpi_context, SCPI_PSU_CH_REG_QUES_INST_ISUM_EVENT2, 0);
-#if OPTION_ETHERNET
-    if (ethernet::g_testResult == TEST_OK) {
-        reg_set(&ethernet::scpi_context, SCPI_PSU_CH_REG_QUES_INST_ISUM_EVENT2, 0);
-	}
-#endif
+    reg_set(context, SCPI_PSU_CH_REG_QUES_INST_ISUM_EVENT1, 0);
+    reg_set(context, SCPI_PSU_CH_REG_QUES_INST_ISUM_EVENT2, 0);
 
     // STAT:QUES:INST:ISUM:COND 0
-    reg_set(&serial::scpi_context, SCPI_PSU_CH_REG_QUES_INST_ISUM_COND1, 0);
-#if OPTION_ETHERNET
-    if (ethernet::g_testResult == TEST_OK) {
-        reg_set(&ethernet::scpi_context, SCPI_PSU_CH_REG_QUES_INST_ISUM_COND1, 0);
-	}
-#endif
-
-    reg_set(&serial::scpi_context, SCPI_PSU_CH_REG_QUES_INST_ISUM_COND2, 0);
-#if OPTION_ETHERNET
-    if (ethernet::g_testResult == TEST_OK) {
-        reg_set(&ethernet::scpi_context, SCPI_PSU_CH_REG_QUES_INST_ISUM_COND2, 0);
-	}
-#endif
+    reg_set(context, SCPI_PSU_CH_REG_QUES_INST_ISUM_COND1, 0);
+    reg_set(context, SCPI_PSU_CH_REG_QUES_INST_ISUM_COND2, 0);
 
     // STAT:OPER:INST:ISUM:ENAB 0
-    reg_set(&serial::scpi_context, SCPI_PSU_CH_REG_QUES_INST_ISUM_ENABLE1, 0);
-#if OPTION_ETHERNET
-    if (ethernet::g_testResult == TEST_OK) {
-        reg_set(&ethernet::scpi_context, SCPI_PSU_CH_REG_QUES_INST_ISUM_ENABLE1, 0);
-	}
-#endif
+    reg_set(context, SCPI_PSU_CH_REG_QUES_INST_ISUM_ENABLE1, 0);
+    reg_set(context, SCPI_PSU_CH_REG_QUES_INST_ISUM_ENABLE2, 0);
 
-    reg_set(&serial::scpi_context, SCPI_PSU_CH_REG_QUES_INST_ISUM_ENABLE2, 0);
-#if OPTION_ETHERNET
-    if (ethernet::g_testResult == TEST_OK) {
-        reg_set(&ethernet::scpi_context, SCPI_PSU_CH_REG_QUES_INST_ISUM_ENABLE2, 0);
-	}
-#endif
+    // FORM[:DATA] ASC
+    // FORM:BORD NORM
+    SCPI_SetResultFormat(context, FALSE, SCPI_FORMAT_NORMAL);
 
     // SYST:ERR:COUN? 0
-    SCPI_ErrorClear(&serial::scpi_context);
+    SCPI_ErrorClear(context);
+}
+
+static bool psuReset() {
+    resetContext(&serial::scpi_context);
 #if OPTION_ETHERNET
-	if (ethernet::g_testResult == TEST_OK) {
-        SCPI_ErrorClear(&ethernet::scpi_context);
-	}
+    if (ethernet::g_testResult == TEST_OK) {
+        for (int i = 0; i < ETHERNET_MAX_SESSIONS; ++i) {
+            resetContext(ethernet::getScpiContext(i));
+        }
+    }
 #endif
 
     // TEMP:PROT[AUX]
@@ -904,132 +779,131 @@ void onProtectionTripped() {
 ////////////////////////////////////////////////////////////////////////////////
 
 void tick() {
-    ++g_mainLoopCounter;
-
     if (g_shutdownOnNextTick) {
         g_shutdownOnNextTick = false;
         powerDownBySensor();
     }
 
-	uint32_t tick_usec = micros();
-
-#if CONF_DEBUG
-    debug::tick(tick_usec);
-#endif
-
-	g_powerOnTimeCounter.tick(tick_usec);
-
-	temperature::tick(tick_usec);
+    scheduler::tick();
+}
 
-	fan::tick(tick_usec);
+////////////////////////////////////////////////////////////////////////////////
 
-    ////dummy eeprom read
-    //uint8_t buf[128];
-    //eeprom::read(buf, 128, 512);
+static void powerOnTimeCounterTick(uint32_t tick_usec) {
+    g_powerOnTimeCounter.tick(tick_usec);
+}
 
+static void channelsTick(uint32_t tick_usec) {
     for (int i = 0; i < CH_NUM; ++i) {
         Channel::get(i).tick(tick_usec);
     }
+}
 
-    trigger::tick(tick_usec);
-
-    list::tick(tick_usec);
-
-    // if we move this, for example, after ethernet::tick we could get
-    // (in certain situations, see #25) PWRGOOD error on channel after
-    // the "pow:syst 1" command is executed 
-	sound::tick(tick_usec);
-
-    profile::tick(tick_usec);
+static uint32_t channelsIdleTime(uint32_t tick_usec) {
+    uint32_t idleTime = scheduler::IDLE_FOREVER;
+    for (int i = 0; i < CH_NUM; ++i) {
+        uint32_t adcIdleTime = Channel::get(i).adc.getIdleTime(tick_usec);
+        if (adcIdleTime < idleTime) {
+            idleTime = adcIdleTime;
+        }
+    }
+    return idleTime;
+}
 
-    serial::tick(tick_usec);
+static void scpiTick(uint32_t tick_usec) {
+    scpi::tick(tick_usec);
+    notifyTick(tick_usec);
+}
 
-#if OPTION_ETHERNET
-    if (g_mainLoopCounter % 2 == 0) {
-        // tick ethernet every other time
-	    ethernet::tick(tick_usec);
+#if OPTION_DISPLAY
+static void touchTick(uint32_t tick_usec) {
+#ifdef EEZ_PSU_SIMULATOR
+    if (!simulator::front_panel::isOpened()) {
+        return;
     }
 #endif
+    gui::touch::tick(tick_usec);
+    gui::touchHandling(tick_usec);
+}
 
-    scpi::tick(tick_usec);
-    
-#if OPTION_DISPLAY
+static void guiTick(uint32_t tick_usec) {
 #ifdef EEZ_PSU_SIMULATOR
-    if (simulator::front_panel::isOpened()) {
+    if (!simulator::front_panel::isOpened()) {
+        return;
+    }
 #endif
-        gui::touch::tick(tick_usec);
-        gui::touchHandling(tick_usec);
+    gui::tick(tick_usec);
+}
 
-        if (g_mainLoopCounter % 2 == 1) {
-            // tick gui every other time
-            tick_usec = micros();
-            gui::tick(tick_usec);
-        }
+/// Used for both touch and gui tasks, touch is handled at frame rate.
+static uint32_t guiIdleTime(uint32_t tick_usec) {
 #ifdef EEZ_PSU_SIMULATOR
+    if (!simulator::front_panel::isOpened()) {
+        return scheduler::IDLE_FOREVER;
     }
 #endif
+    return gui::getIdleTime(tick_usec);
+}
 #endif
 
-	event_queue::tick(tick_usec);
-
 #if (EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R3B4 || EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R5B12) && OPTION_SYNC_MASTER && !defined(EEZ_PSU_SIMULATOR)
+static void masterSyncTick(uint32_t tick_usec) {
 	updateMasterSync();
+}
+#endif
+
+/// Register the subsystem ticks with the scheduler.
+/// Period and deadline are in microseconds.
+/// Tasks driven by their own timers have idle function, others are polled within their deadline.
+/// Subsystems which have work only every so often are given a period.
+/// Keep SCHEDULER_MAX_TASKS in sync with the number of tasks registered here.
+static void addTasks() {
+#if CONF_DEBUG
+    scheduler::addTask("debug", debug::tick, scheduler::PRIORITY_HIGH, 0, 10000);
 #endif
 
+    scheduler::addTask("channels", channelsTick, scheduler::PRIORITY_CRITICAL, 0, ADC_READ_TIME_US / 2, channelsIdleTime);
+    // trigger starts the list execution, so it is ticked before the list
+    // (same priority and deadline, tasks are then executed in the order they are added)
+    scheduler::addTask("trigger", trigger::tick, scheduler::PRIORITY_CRITICAL, 0, 250, trigger::getIdleTime);
+    scheduler::addTask("list", list::tick, scheduler::PRIORITY_CRITICAL, 0, 250, list::getIdleTime);
+#if OPTION_DISPLAY
+    scheduler::addTask("touch", touchTick, scheduler::PRIORITY_CRITICAL, 0, 5000, guiIdleTime);
+#endif
+
+    scheduler::addTask("power_on_time", powerOnTimeCounterTick, scheduler::PRIORITY_HIGH, 0, 10000);
+    scheduler::addTask("temperature", temperature::tick, scheduler::PRIORITY_HIGH, TEMP_SENSOR_READ_EVERY_MS * 1000L, 10000);
+    scheduler::addTask("fan", fan::tick, scheduler::PRIORITY_HIGH, 10000, 10000);
+    // sound must be ticked before ethernet, otherwise we could get
+    // (in certain situations, see #25) PWRGOOD error on channel after
+    // the "pow:syst 1" command is executed
+    scheduler::addTask("sound", sound::tick, scheduler::PRIORITY_HIGH, 10000, 10000);
 #if EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R3B4 || EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R5B12
 #if OPTION_WATCHDOG
-	watchdog::tick(tick_usec);
+	scheduler::addTask("watchdog", watchdog::tick, scheduler::PRIORITY_HIGH, 10000, 10000);
 #endif
 #endif
-}
-
-void criticalTick() {
-    if (!g_powerIsUp) {
-        return;
-    }
-
-    uint32_t tick_usec = micros();
-
-    static uint32_t lastTickList = 0;
-    if (list::isActive()) {
-        if (lastTickList == 0) {
-            lastTickList = tick_usec;
-        } else if (tick_usec - lastTickList >= 250) {
-            lastTickList = tick_usec;
-            list::tick(tick_usec);
-        }
-    } else {
-        lastTickList = 0;
-    }
-
-    static uint32_t lastTickAdc = 0;
-    if (lastTickAdc == 0) {
-        lastTickAdc = tick_usec;
-    } else if (tick_usec - lastTickAdc >= ADC_READ_TIME_US / 2) {
-        lastTickAdc = tick_usec;
-
-        for (int i = 0; i < CH_NUM; ++i) {
-            Channel::get(i).tick(tick_usec);
-        }
-    }
+#if (EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R3B4 || EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R5B12) && OPTION_SYNC_MASTER && !defined(EEZ_PSU_SIMULATOR)
+	scheduler::addTask("master_sync", masterSyncTick, scheduler::PRIORITY_HIGH, 0, 10000);
+#endif
 
-#if OPTION_DISPLAY
-    static uint32_t lastTickTouch = 0;
-#ifdef EEZ_PSU_SIMULATOR
-    if (simulator::front_panel::isOpened()) {
+    scheduler::addTask("profile", profile::tick, scheduler::PRIORITY_NORMAL, 50000, 50000);
+    scheduler::addTask("serial", serial::tick, scheduler::PRIORITY_NORMAL, 5000, 20000);
+#if OPTION_ETHERNET
+    scheduler::addTask("ethernet", ethernet::tick, scheduler::PRIORITY_NORMAL, 0, 20000, ethernet::getIdleTime);
+    scheduler::addTask("telemetry", telemetry::tick, scheduler::PRIORITY_NORMAL, 0, 20000);
+#if HTTP_PORT
+    scheduler::addTask("http_server", http_server::tick, scheduler::PRIORITY_NORMAL, 0, 50000);
 #endif
-        if (lastTickTouch == 0) {
-            lastTickTouch = tick_usec;
-        } else if (tick_usec - lastTickTouch >= 5000) {
-            lastTickTouch = tick_usec;
-            gui::touch::tick(tick_usec);
-            gui::touchHandling(tick_usec);
-        }
-#ifdef EEZ_PSU_SIMULATOR
-    }
 #endif
+    scheduler::addTask("scpi", scpiTick, scheduler::PRIORITY_NORMAL, 0, 20000);
+    scheduler::addTask("job_queue", job_queue::tick, scheduler::PRIORITY_NORMAL, 0, 50000);
 
+#if OPTION_DISPLAY
+    // drawing is split across ticks, see GUI_DRAW_TICK_BUDGET
+    scheduler::addTask("gui", guiTick, scheduler::PRIORITY_LOW, GUI_TICK_PERIOD, 50000, guiIdleTime);
 #endif
+    scheduler::addTask("event_queue", event_queue::tick, scheduler::PRIORITY_LOW, 10000, 100000);
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1038,17 +912,32 @@ void setEsrBits(int bit_mask) {
     SCPI_RegSetBits(&serial::scpi_context, SCPI_REG_ESR, bit_mask);
 #if OPTION_ETHERNET
 	if (ethernet::g_testResult == TEST_OK) {
-        SCPI_RegSetBits(&ethernet::scpi_context, SCPI_REG_ESR, bit_mask);
+        for (int i = 0; i < ETHERNET_MAX_SESSIONS; ++i) {
+            SCPI_RegSetBits(ethernet::getScpiContext(i), SCPI_REG_ESR, bit_mask);
+        }
 	}
 #endif
 }
 
 
+static void notifyTick(uint32_t tick_usec) {
+    scpi::notifyTick(serial::scpi_context, tick_usec);
+#if OPTION_ETHERNET
+	if (ethernet::g_testResult == TEST_OK) {
+        for (int i = 0; i < ETHERNET_MAX_SESSIONS; ++i) {
+            scpi::notifyTick(*ethernet::getScpiContext(i), tick_usec);
+        }
+	}
+#endif
+}
+
 void setQuesBits(int bit_mask, bool on) {
     reg_set_ques_bit(&serial::scpi_context, bit_mask, on);
 #if OPTION_ETHERNET
 	if (ethernet::g_testResult == TEST_OK) {
-        reg_set_ques_bit(&ethernet::scpi_context, bit_mask, on);
+        for (int i = 0; i < ETHERNET_MAX_SESSIONS; ++i) {
+            reg_set_ques_bit(ethernet::getScpiContext(i), bit_mask, on);
+        }
 	}
 #endif
 }
@@ -1057,7 +946,9 @@ void generateError(int16_t error) {
     SCPI_ErrorPush(&serial::scpi_context, error);
 #if OPTION_ETHERNET
 	if (ethernet::g_testResult == TEST_OK) {
-        SCPI_ErrorPush(&ethernet::scpi_context, error);
+        for (int i = 0; i < ETHERNET_MAX_SESSIONS; ++i) {
+            SCPI_ErrorPush(ethernet::getScpiContext(i), error);
+        }
     }
 #endif
 	event_queue::pushEvent(error);
@@ -0,0 +1,191 @@
+/*
+ * EEZ PSU Firmware
+ * Copyright (C) 2018-present, Envox d.o.o.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "psu.h"
+#include "scheduler.h"
+
+namespace eez {
+namespace psu {
+namespace scheduler {
+
+struct Task {
+    const char *name;
+    TaskFunction function;
+    Priority priority;
+    uint32_t period;
+    uint32_t deadline;
+    TaskIdleFunction idleFunction;
+
+    bool hasRun;
+    uint32_t lastRun;
+
+    TaskStatistics statistics;
+
+#if DEBUG_PROFILING
+    /// Execution time histogram, see DEBUG:PROFile?
+    debug::DebugDurationVariable duration;
+#endif
+};
+
+static Task g_tasks[SCHEDULER_MAX_TASKS];
+static int g_numTasks;
+
+/// Task indexes from the most to the least urgent, i.e. by priority and, for the same priority, by deadline.
+static uint8_t g_order[SCHEDULER_MAX_TASKS];
+
+////////////////////////////////////////////////////////////////////////////////
+
+/// How long (in microseconds) is the task due? Negative if it is not due yet.
+static int32_t getDueTime(const Task &task, uint32_t tick_usec) {
+    if (!task.hasRun) {
+        return 0;
+    }
+    return (int32_t)(tick_usec - (task.lastRun + task.period));
+}
+
+static void execute(Task &task, uint32_t tick_usec) {
+    // task with period 0 is always due, so it can't be late
+    if (task.hasRun && task.period > 0) {
+        int32_t dueTime = getDueTime(task, tick_usec);
+        if ((uint32_t)dueTime > task.statistics.maxLateness) {
+            task.statistics.maxLateness = dueTime;
+        }
+        if ((uint32_t)dueTime > task.deadline) {
+            ++task.statistics.numLate;
+        }
+    }
+
+    task.hasRun = true;
+    task.lastRun = tick_usec;
+
+    task.function(tick_usec);
+
+    uint32_t duration = micros() - tick_usec;
+
+    ++task.statistics.numExecuted;
+    if (duration > task.statistics.maxDuration) {
+        task.statistics.maxDuration = duration;
+    }
+    if (duration > task.deadline) {
+        ++task.statistics.numOverruns;
+    }
+
+#if DEBUG_PROFILING
+    task.duration.addDuration(duration);
+#endif
+}
+
+/// Is task a more urgent than task b?
+static bool isMoreUrgent(const Task &a, const Task &b) {
+    return a.priority > b.priority || (a.priority == b.priority && a.deadline < b.deadline);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+bool addTask(const char *name, TaskFunction function, Priority priority, uint32_t period, uint32_t deadline, TaskIdleFunction idleFunction) {
+    if (g_numTasks == SCHEDULER_MAX_TASKS) {
+        DebugTraceF("Task %s not added, increase SCHEDULER_MAX_TASKS", name);
+        return false;
+    }
+
+    Task &task = g_tasks[g_numTasks++];
+    task.name = name;
+    task.function = function;
+    task.priority = priority;
+    task.period = period;
+    task.deadline = deadline;
+    task.idleFunction = idleFunction;
+    task.hasRun = false;
+    memset(&task.statistics, 0, sizeof(TaskStatistics));
+
+    // insert into g_order after all the tasks that are at least as urgent
+    int i = g_numTasks - 1;
+    for (; i > 0 && isMoreUrgent(task, g_tasks[g_order[i - 1]]); --i) {
+        g_order[i] = g_order[i - 1];
+    }
+    g_order[i] = (uint8_t)(g_numTasks - 1);
+
+#if DEBUG_PROFILING
+    task.duration.setName(name);
+    debug::addProfileVariable(&task.duration);
+#endif
+
+    return true;
+}
+
+void tick() {
+    for (int i = 0; i < g_numTasks; ++i) {
+        Task &task = g_tasks[g_order[i]];
+
+        uint32_t tick_usec = micros();
+        if (getDueTime(task, tick_usec) >= 0) {
+            execute(task, tick_usec);
+        }
+    }
+}
+
+uint32_t getIdleTime(uint32_t maxIdleTime) {
+    uint32_t tick_usec = micros();
+    uint32_t idleTime = maxIdleTime;
+
+    for (int i = 0; i < g_numTasks && idleTime > 0; ++i) {
+        Task &task = g_tasks[i];
+
+        int32_t dueTime = getDueTime(task, tick_usec);
+
+        uint32_t taskIdleTime;
+        if (task.idleFunction) {
+            taskIdleTime = task.idleFunction(tick_usec);
+            if (dueTime < 0 && taskIdleTime < (uint32_t)-dueTime) {
+                // period didn't expire yet
+                taskIdleTime = -dueTime;
+            }
+        } else {
+            int32_t slack = (int32_t)task.deadline - dueTime;
+            taskIdleTime = slack > 0 ? slack : 0;
+        }
+
+        if (taskIdleTime < idleTime) {
+            idleTime = taskIdleTime;
+        }
+    }
+
+    return idleTime;
+}
+
+int getNumTasks() {
+    return g_numTasks;
+}
+
+const char *getTaskName(int taskIndex) {
+    return g_tasks[taskIndex].name;
+}
+
+const TaskStatistics &getTaskStatistics(int taskIndex) {
+    return g_tasks[taskIndex].statistics;
+}
+
+void resetStatistics() {
+    for (int i = 0; i < g_numTasks; ++i) {
+        memset(&g_tasks[i].statistics, 0, sizeof(TaskStatistics));
+    }
+}
+
+}
+}
+} // namespace eez::psu::scheduler
@@ -0,0 +1,80 @@
+/*
+ * EEZ PSU Firmware
+ * Copyright (C) 2018-present, Envox d.o.o.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace eez {
+namespace psu {
+/// Cooperative scheduler of the main loop.
+/// Every subsystem registers its tick function as a task with period, deadline and priority.
+namespace scheduler {
+
+enum Priority {
+    PRIORITY_LOW,
+    PRIORITY_NORMAL,
+    PRIORITY_HIGH,
+    PRIORITY_CRITICAL
+};
+
+typedef void (*TaskFunction)(uint32_t tick_usec);
+
+/// Returns time (in microseconds) from tick_usec during which the task has nothing to do,
+/// or IDLE_FOREVER if task is waiting only for some external event.
+typedef uint32_t (*TaskIdleFunction)(uint32_t tick_usec);
+
+static const uint32_t IDLE_FOREVER = 0xFFFFFFFF;
+
+struct TaskStatistics {
+    uint32_t numExecuted;
+    /// Number of times the task was started after its deadline.
+    /// Counted only for tasks with period, task with period 0 is always due.
+    uint32_t numLate;
+    /// Longest time (in microseconds) the task waited to be started after it became due.
+    uint32_t maxLateness;
+    /// Number of times the task execution took longer than its deadline.
+    uint32_t numOverruns;
+    /// Longest time (in microseconds) spent in one execution of the task.
+    uint32_t maxDuration;
+};
+
+/// Register the task.
+/// \param name Name of the task as reported by DIAGnostic[:INFOrmation]:SCHeduler?
+/// \param period Minimal time (in microseconds) between two executions of the task, 0 means as often as possible.
+/// \param deadline Time (in microseconds) after the task became due within which it must be started.
+/// \param idleFunction Optional, tells getIdleTime when the task has something to do again.
+/// \returns false if there is no room for another task (see SCHEDULER_MAX_TASKS).
+bool addTask(const char *name, TaskFunction function, Priority priority, uint32_t period, uint32_t deadline, TaskIdleFunction idleFunction = 0);
+
+/// Execute all due tasks, most urgent first.
+/// Task is more urgent if it has higher priority or, for the same priority, shorter deadline.
+/// Tasks with the same priority and deadline are executed in the order they were added.
+void tick();
+
+/// How long (in microseconds) can the main loop sleep before some task has to be executed again.
+/// Task with the idle function has to be executed when its idle time expires,
+/// task without it at the latest when its deadline expires.
+uint32_t getIdleTime(uint32_t maxIdleTime);
+
+int getNumTasks();
+const char *getTaskName(int taskIndex);
+const TaskStatistics &getTaskStatistics(int taskIndex);
+void resetStatistics();
+
+}
+}
+} // namespace eez::psu::scheduler
@@ -77,12 +77,10 @@ scpi_result_t scpi_cmd_apply(scpi_t *context) {
         return SCPI_RES_ERR;
     }
 
-    // set voltage
-    channel_dispatcher::setVoltage(*channel, voltage);
-
-    // set current
     if (call_set_current) {
-        channel_dispatcher::setCurrent(*channel, current);
+        channel_dispatcher::setVoltageAndCurrent(*channel, voltage, current);
+    } else {
+        channel_dispatcher::setVoltage(*channel, voltage);
     }
 
     return SCPI_RES_OK;
@@ -116,11 +114,11 @@ scpi_result_t scpi_cmd_applyQ(scpi_t * context) {
     else {
         if (current_or_voltage == 0) {
             // return only current
-            util::strcatFloat(buffer, channel_dispatcher::getISet(*channel), getNumSignificantDecimalDigitsForCurrent(channel->flags.currentRange));
+            return result_float(context, channel_dispatcher::getISet(*channel), getNumSignificantDecimalDigitsForCurrent(channel->flags.currentRange));
         }
         else {
             // return only voltage
-            util::strcatFloat(buffer, channel_dispatcher::getUSet(*channel), getNumSignificantDecimalDigits(VALUE_TYPE_FLOAT_VOLT));
+            return result_float(context, channel_dispatcher::getUSet(*channel), getNumSignificantDecimalDigits(VALUE_TYPE_FLOAT_VOLT));
         }
     }
 
@@ -21,6 +21,7 @@
 
 #include "calibration.h"
 #include "channel_dispatcher.h"
+#include "job_queue.h"
 
 namespace eez {
 namespace psu {
@@ -133,6 +134,9 @@ scpi_result_t scpi_cmd_calibrationClear(scpi_t * context) {
     scpi_psu_t *psu_context = (scpi_psu_t *)context->user_context;
     Channel *channel = &Channel::get(psu_context->selected_channel_index - 1);
 
+    // pending CAL:SAVE must not overwrite cleared calibration
+    job_queue::waitAll();
+
     if (!calibration::clear(channel)) {
         SCPI_ErrorPush(context, SCPI_ERROR_EXECUTION_ERROR);
         return SCPI_RES_ERR;
@@ -283,6 +287,13 @@ scpi_result_t scpi_cmd_calibrationRemarkQ(scpi_t * context) {
     return SCPI_RES_OK;
 }
 
+static bool saveCalibrationJobStep(job_queue::Job &job, int16_t &err) {
+    if (!persist_conf::saveChannelCalibration(&Channel::get(job.iParam))) {
+        err = SCPI_ERROR_EXECUTION_ERROR;
+    }
+    return true;
+}
+
 scpi_result_t scpi_cmd_calibrationSave(scpi_t * context) {
 	int16_t err;
 	if (!calibration::canSave(err)) {
@@ -290,10 +301,11 @@ scpi_result_t scpi_cmd_calibrationSave(scpi_t * context) {
         return SCPI_RES_ERR;
 	}
 
-    if (!calibration::save()) {
-        SCPI_ErrorPush(context, SCPI_ERROR_EXECUTION_ERROR);
-        return SCPI_RES_ERR;
-    }
+    calibration::updateCalibrationConf();
+
+    job_queue::Job job;
+    job.iParam = calibration::getCalibrationChannel().index - 1;
+    job_queue::push(context, saveCalibrationJobStep, job);
 
     return SCPI_RES_OK;
 }
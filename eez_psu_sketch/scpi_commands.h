@@ -52,16 +52,29 @@
     SCPI_COMMAND("*WAI", scpi_cmd_coreWai) \
     SCPI_COMMAND("DEBUG", scpi_cmd_debug) \
     SCPI_COMMAND("DEBUG?", scpi_cmd_debugQ) \
+    SCPI_COMMAND("DEBUG:PROFile?", scpi_cmd_debugProfileQ) \
     SCPI_COMMAND("DEBUG:WDOG", scpi_cmd_debugWdog) \
     SCPI_COMMAND("DEBUG:WDOG?", scpi_cmd_debugWdogQ) \
     SCPI_COMMAND("DEBUG:ONTime?", scpi_cmd_debugOntimeQ) \
     SCPI_COMMAND("DEBUG:DIR?", scpi_cmd_debugDirQ) \
     SCPI_COMMAND("DEBUG:FILE?", scpi_cmd_debugFileQ) \
+    SCPI_COMMAND("DEBUG:COMMand?", scpi_cmd_debugCommandQ) \
+    SCPI_COMMAND("DEBUG:COMMand:RESet", scpi_cmd_debugCommandReset) \
     SCPI_COMMAND("DIAGnostic[:INFOrmation]:ADC?", scpi_cmd_diagnosticInformationAdcQ) \
     SCPI_COMMAND("DIAGnostic[:INFOrmation]:CALibration?", scpi_cmd_diagnosticInformationCalibrationQ) \
+    SCPI_COMMAND("DIAGnostic[:INFOrmation]:DAC?", scpi_cmd_diagnosticInformationDacQ) \
     SCPI_COMMAND("DIAGnostic[:INFOrmation]:PROTection?", scpi_cmd_diagnosticInformationProtectionQ) \
     SCPI_COMMAND("DIAGnostic[:INFOrmation]:TEST?", scpi_cmd_diagnosticInformationTestQ) \
     SCPI_COMMAND("DIAGnostic[:INFOrmation]:FAN?", scpi_cmd_diagnosticInformationFanQ) \
+    SCPI_COMMAND("DIAGnostic[:INFOrmation]:IOEXPander?", scpi_cmd_diagnosticInformationIoexpanderQ) \
+    SCPI_COMMAND("DIAGnostic[:INFOrmation]:JOBS?", scpi_cmd_diagnosticInformationJobsQ) \
+    SCPI_COMMAND("DIAGnostic[:INFOrmation]:ETHernet?", scpi_cmd_diagnosticInformationEthernetQ) \
+    SCPI_COMMAND("DIAGnostic[:INFOrmation]:SCHeduler?", scpi_cmd_diagnosticInformationSchedulerQ) \
+    SCPI_COMMAND("DIAGnostic[:INFOrmation]:SERial?", scpi_cmd_diagnosticInformationSerialQ) \
+    SCPI_COMMAND("FORMat[:DATA]", scpi_cmd_formatData) \
+    SCPI_COMMAND("FORMat[:DATA]?", scpi_cmd_formatDataQ) \
+    SCPI_COMMAND("FORMat:BORDer", scpi_cmd_formatBorder) \
+    SCPI_COMMAND("FORMat:BORDer?", scpi_cmd_formatBorderQ) \
     SCPI_COMMAND("INSTrument[:SELect]", scpi_cmd_instrumentSelect) \
     SCPI_COMMAND("INSTrument[:SELect]?", scpi_cmd_instrumentSelectQ) \
     SCPI_COMMAND("INSTrument:NSELect", scpi_cmd_instrumentNselect) \
@@ -75,8 +88,16 @@
     SCPI_COMMAND("INSTrument:DISPlay:YT:RATE?", scpi_cmd_instrumentDisplayYtRateQ) \
     SCPI_COMMAND("MEASure[:SCALar][:VOLTage][:DC]?", scpi_cmd_measureScalarVoltageDcQ) \
     SCPI_COMMAND("MEASure[:SCALar]:CURRent[:DC]?", scpi_cmd_measureScalarCurrentDcQ) \
+    SCPI_COMMAND("MEASure[:SCALar]:ALL[:DC]?", scpi_cmd_measureScalarAllDcQ) \
     SCPI_COMMAND("MEASure[:SCALar]:POWer[:DC]?", scpi_cmd_measureScalarPowerDcQ) \
     SCPI_COMMAND("MEASure[:SCALar]:TEMPerature[:THERmistor][:DC]?", scpi_cmd_measureScalarTemperatureThermistorDcQ) \
+    SCPI_COMMAND("MEMory:MACRo:CATalog?", scpi_cmd_memoryMacroCatalogQ) \
+    SCPI_COMMAND("MEMory:MACRo:DEFine", scpi_cmd_memoryMacroDefine) \
+    SCPI_COMMAND("MEMory:MACRo:DEFine?", scpi_cmd_memoryMacroDefineQ) \
+    SCPI_COMMAND("MEMory:MACRo:DELete", scpi_cmd_memoryMacroDelete) \
+    SCPI_COMMAND("MEMory:MACRo:DELete:ALL", scpi_cmd_memoryMacroDeleteAll) \
+    SCPI_COMMAND("MEMory:MACRo:EXECute", scpi_cmd_memoryMacroExecute) \
+    SCPI_COMMAND("MEMory:MACRo:TIME?", scpi_cmd_memoryMacroTimeQ) \
     SCPI_COMMAND("MEMory:NSTates?", scpi_cmd_memoryNstatesQ) \
     SCPI_COMMAND("MEMory:STATe:CATalog?", scpi_cmd_memoryStateCatalogQ) \
     SCPI_COMMAND("MEMory:STATe:DELete", scpi_cmd_memoryStateDelete) \
@@ -115,6 +136,8 @@
     SCPI_COMMAND("SIMUlator:QUIT", scpi_cmd_simulatorQuit) \
     SCPI_COMMAND("SIMUlator:PIN1", scpi_cmd_simulatorPin1) \
     SCPI_COMMAND("SIMUlator:PIN1?", scpi_cmd_simulatorPin1Q) \
+    SCPI_COMMAND("SIMUlator:TICK:FIXed", scpi_cmd_simulatorTickFixed) \
+    SCPI_COMMAND("SIMUlator:TICK:FIXed?", scpi_cmd_simulatorTickFixedQ) \
     SCPI_COMMAND("[SOURce#]:CURRent[:LEVel][:IMMediate][:AMPLitude]", scpi_cmd_sourceCurrentLevelImmediateAmplitude) \
     SCPI_COMMAND("[SOURce#]:CURRent[:LEVel][:IMMediate][:AMPLitude]?", scpi_cmd_sourceCurrentLevelImmediateAmplitudeQ) \
     SCPI_COMMAND("[SOURce#]:VOLTage[:LEVel][:IMMediate][:AMPLitude]", scpi_cmd_sourceVoltageLevelImmediateAmplitude) \
@@ -197,6 +220,8 @@
     SCPI_COMMAND("STATus:OPERation:INSTrument:ISUMmary#:ENABle", scpi_cmd_statusOperationInstrumentIsummaryEnable) \
     SCPI_COMMAND("STATus:OPERation:INSTrument:ISUMmary#:ENABle?", scpi_cmd_statusOperationInstrumentIsummaryEnableQ) \
     SCPI_COMMAND("STATus:PREset", scpi_cmd_statusPreset) \
+    SCPI_COMMAND("STATus:NOTify[:STATe]", scpi_cmd_statusNotifyState) \
+    SCPI_COMMAND("STATus:NOTify[:STATe]?", scpi_cmd_statusNotifyStateQ) \
     SCPI_COMMAND("SYSTem:CAPability?", scpi_cmd_systemCapabilityQ) \
     SCPI_COMMAND("SYSTem:ERRor[:NEXT]?", scpi_cmd_systemErrorNextQ) \
     SCPI_COMMAND("SYSTem:ERRor:COUNt?", scpi_cmd_systemErrorCountQ) \
@@ -244,7 +269,18 @@
     SCPI_COMMAND("SYSTem:PASSword:FPANel:RESet", scpi_cmd_systemPasswordFpanelReset) \
     SCPI_COMMAND("SYSTem:PASSword:CALibrate:RESet", scpi_cmd_systemPasswordCalibrateReset) \
     SCPI_COMMAND("SYSTem:KLOCk", scpi_cmd_systemKlock) \
+    SCPI_COMMAND("SYSTem:COMMunicate:LAN:TELemetry[:STATe]", scpi_cmd_systemCommunicateLanTelemetryState) \
+    SCPI_COMMAND("SYSTem:COMMunicate:LAN:TELemetry[:STATe]?", scpi_cmd_systemCommunicateLanTelemetryStateQ) \
+    SCPI_COMMAND("SYSTem:COMMunicate:LAN:TELemetry:ADDRess", scpi_cmd_systemCommunicateLanTelemetryAddress) \
+    SCPI_COMMAND("SYSTem:COMMunicate:LAN:TELemetry:ADDRess?", scpi_cmd_systemCommunicateLanTelemetryAddressQ) \
+    SCPI_COMMAND("SYSTem:COMMunicate:LAN:TELemetry:PORT", scpi_cmd_systemCommunicateLanTelemetryPort) \
+    SCPI_COMMAND("SYSTem:COMMunicate:LAN:TELemetry:PORT?", scpi_cmd_systemCommunicateLanTelemetryPortQ) \
+    SCPI_COMMAND("SYSTem:COMMunicate:LAN:TELemetry:RATE", scpi_cmd_systemCommunicateLanTelemetryRate) \
+    SCPI_COMMAND("SYSTem:COMMunicate:LAN:TELemetry:RATE?", scpi_cmd_systemCommunicateLanTelemetryRateQ) \
     SCPI_COMMAND("SYSTem:COMMunicate:RLSTate", scpi_cmd_systemCommunicateRlstate) \
+    SCPI_COMMAND("SYSTem:GROup:BEGin", scpi_cmd_systemGroupBegin) \
+    SCPI_COMMAND("SYSTem:GROup:COMMit", scpi_cmd_systemGroupCommit) \
+    SCPI_COMMAND("SYSTem:GROup:SKEW?", scpi_cmd_systemGroupSkewQ) \
     SCPI_COMMAND("SYSTem:LOCal", scpi_cmd_systemLocal) \
     SCPI_COMMAND("SYSTem:REMote", scpi_cmd_systemRemote) \
     SCPI_COMMAND("SYSTem:RWLock", scpi_cmd_systemRwlock) \
@@ -20,6 +20,7 @@
 #include "scpi_psu.h"
 
 #include "profile.h"
+#include "job_queue.h"
 
 namespace eez {
 namespace psu {
@@ -27,7 +28,26 @@ namespace scpi {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+static bool saveJobStep(job_queue::Job &job, int16_t &err) {
+#if OPTION_SD_CARD
+    if (job.state < CH_NUM) {
+        // one channel lists file per slice
+        profile::saveChannelList(Channel::get(job.state++), job.iParam);
+        return false;
+    }
+#endif
+
+    if (!profile::saveProfileToLocation(job.iParam, &job.profile)) {
+        err = SCPI_ERROR_EXECUTION_ERROR;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 scpi_result_t scpi_cmd_coreCls(scpi_t * context) {
+    job_queue::cancelOpc(context);
     return SCPI_CoreCls(context);
 }
 
@@ -47,11 +67,20 @@ scpi_result_t scpi_cmd_coreIdnQ(scpi_t * context) {
     return SCPI_CoreIdnQ(context);
 }
 
+/**
+* Implement IEEE488.2 *OPC
+*
+* Sets the OPC bit in ESR when all pending background jobs are finished.
+*
+* Return SCPI_RES_OK
+*/
 scpi_result_t scpi_cmd_coreOpc(scpi_t * context) {
-    return SCPI_CoreOpc(context);
+    job_queue::setOpcWhenIdle(context);
+    return SCPI_RES_OK;
 }
 
 scpi_result_t scpi_cmd_coreOpcQ(scpi_t * context) {
+    job_queue::waitAll();
     return SCPI_CoreOpcQ(context);
 }
 
@@ -67,6 +96,8 @@ scpi_result_t scpi_cmd_coreRcl(scpi_t * context) {
     if (!get_profile_location_param(context, location)) {
         return SCPI_RES_ERR;
     }
+
+    job_queue::waitAll();
     
     if (!profile::recall(location)) {
         SCPI_ErrorPush(context, SCPI_ERROR_EXECUTION_ERROR);
@@ -77,13 +108,15 @@ scpi_result_t scpi_cmd_coreRcl(scpi_t * context) {
 }
 
 scpi_result_t scpi_cmd_coreRst(scpi_t * context) {
+    job_queue::cancelOpc(context);
     return SCPI_CoreRst(context);
 }
 
 /**
 * Implement IEEE488.2 *SAV
 *
-* Stores the current PSU state in the specified storage location
+* Stores the current PSU state in the specified storage location.
+* State is taken immediately, writing to the storage is done in the background.
 *
 * Return SCPI_RES_OK
 */
@@ -93,10 +126,13 @@ scpi_result_t scpi_cmd_coreSav(scpi_t * context) {
         return SCPI_RES_ERR;
     }
 
-    if (!profile::saveAtLocation(location)) {
-        SCPI_ErrorPush(context, SCPI_ERROR_EXECUTION_ERROR);
-        return SCPI_RES_ERR;
-    }
+    job_queue::Job job;
+    job.iParam = location;
+    profile::fillProfile(&job.profile);
+#if OPTION_SD_CARD
+    job.readsChannelLists = true;
+#endif
+    job_queue::push(context, saveJobStep, job);
 
     return SCPI_RES_OK;
 }
@@ -128,6 +164,7 @@ scpi_result_t scpi_cmd_coreTstQ(scpi_t * context) {
 }
 
 scpi_result_t scpi_cmd_coreWai(scpi_t * context) {
+    job_queue::waitAll();
     return SCPI_CoreWai(context);
 }
 
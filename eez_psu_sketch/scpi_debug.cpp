@@ -56,6 +56,33 @@ scpi_result_t scpi_cmd_debugQ(scpi_t *context) {
     return SCPI_RES_OK;
 }
 
+#if DEBUG_PROFILING
+static void resultProfileLine(scpi_t *context, DebugDurationVariable &variable) {
+    char buffer[192];
+
+    strcpy(buffer, variable.name());
+    strcat(buffer, " = ");
+    variable.dump(buffer);
+
+    SCPI_ResultText(context, buffer);
+}
+#endif
+
+scpi_result_t scpi_cmd_debugProfileQ(scpi_t *context) {
+#if DEBUG_PROFILING
+    // main loop and then every scheduler task, one line at a time
+    resultProfileLine(context, g_mainLoopDuration);
+    for (int i = 0; i < getNumProfileVariables(); ++i) {
+        resultProfileLine(context, *getProfileVariable(i));
+    }
+
+    return SCPI_RES_OK;
+#else
+    SCPI_ErrorPush(context, SCPI_ERROR_OPTION_NOT_INSTALLED);
+    return SCPI_RES_ERR;
+#endif
+}
+
 scpi_result_t scpi_cmd_debugWdog(scpi_t * context) {
     if (!OPTION_WATCHDOG) {
         SCPI_ErrorPush(context, SCPI_ERROR_OPTION_NOT_INSTALLED);
@@ -134,6 +161,42 @@ scpi_result_t scpi_cmd_debugFileQ(scpi_t *context) {
 #endif
 }
 
+scpi_result_t scpi_cmd_debugCommandQ(scpi_t *context) {
+#if USE_COMMAND_PROFILING
+    char buffer[192];
+
+    // only the commands executed at least once: pattern, count, min, avg and max time in microseconds
+    const char *pattern;
+    const scpi_command_profile_t *profile;
+    for (int i = 0; (profile = getCommandProfile(i, pattern)) != 0; ++i) {
+        if (profile->count > 0) {
+            sprintf_P(buffer, PSTR("%s count=%lu min=%lu avg=%lu max=%lu"),
+                pattern,
+                (unsigned long)profile->count,
+                (unsigned long)profile->min_duration,
+                (unsigned long)(profile->total_duration / profile->count),
+                (unsigned long)profile->max_duration);
+            SCPI_ResultText(context, buffer);
+        }
+    }
+
+    return SCPI_RES_OK;
+#else
+    SCPI_ErrorPush(context, SCPI_ERROR_OPTION_NOT_INSTALLED);
+    return SCPI_RES_ERR;
+#endif
+}
+
+scpi_result_t scpi_cmd_debugCommandReset(scpi_t *context) {
+#if USE_COMMAND_PROFILING
+    resetCommandProfile();
+    return SCPI_RES_OK;
+#else
+    SCPI_ErrorPush(context, SCPI_ERROR_OPTION_NOT_INSTALLED);
+    return SCPI_RES_ERR;
+#endif
+}
+
 }
 }
 } // namespace eez::psu::scpi
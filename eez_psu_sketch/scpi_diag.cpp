@@ -20,8 +20,17 @@
 #include "scpi_psu.h"
 
 #include "calibration.h"
+#include "dac.h"
 #include "devices.h"
 #include "temperature.h"
+#include "job_queue.h"
+#include "scheduler.h"
+#include "serial_psu.h"
+#if OPTION_ETHERNET
+#include "ethernet.h"
+#include "telemetry.h"
+#include "http_server.h"
+#endif
 #if EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R3B4 || EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R5B12
 #include "fan.h"
 #endif
@@ -301,6 +310,120 @@ scpi_result_t scpi_cmd_diagnosticInformationFanQ(scpi_t * context) {
     return SCPI_RES_OK;
 }
 
+scpi_result_t scpi_cmd_diagnosticInformationJobsQ(scpi_t * context) {
+    char buffer[64] = { 0 };
+
+    const job_queue::Statistics &statistics = job_queue::getStatistics();
+
+    sprintf_P(buffer, PSTR("depth=%d"), job_queue::getDepth()); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("max_depth=%d"), (int)statistics.maxDepth); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("queue_size=%d"), JOB_QUEUE_SIZE); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("executed=%lu"), (unsigned long)statistics.numExecuted); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("failed=%lu"), (unsigned long)statistics.numFailed); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("last_duration_us=%lu"), (unsigned long)statistics.lastDuration); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("max_duration_us=%lu"), (unsigned long)statistics.maxDuration); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("max_slice_us=%lu"), (unsigned long)statistics.maxSliceDuration); SCPI_ResultText(context, buffer);
+
+    return SCPI_RES_OK;
+}
+
+scpi_result_t scpi_cmd_diagnosticInformationEthernetQ(scpi_t * context) {
+#if OPTION_ETHERNET
+    char buffer[64] = { 0 };
+
+    const ethernet::Statistics &statistics = ethernet::getStatistics();
+
+    sprintf_P(buffer, PSTR("sessions=%d"), ethernet::getNumConnectedSessions()); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("rx_bytes=%lu"), (unsigned long)statistics.rxBytes); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("tx_bytes=%lu"), (unsigned long)statistics.txBytes); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("rx_reads=%lu"), (unsigned long)statistics.rxReads); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("skipped_polls=%lu"), (unsigned long)statistics.skippedPolls); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("rx_bytes_per_sec=%lu"), (unsigned long)statistics.rxBytesPerSecond); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("tx_bytes_per_sec=%lu"), (unsigned long)statistics.txBytesPerSecond); SCPI_ResultText(context, buffer);
+
+    const telemetry::Statistics &telemetryStatistics = telemetry::getStatistics();
+
+    sprintf_P(buffer, PSTR("telemetry_sent=%lu"), (unsigned long)telemetryStatistics.numSent); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("telemetry_failed=%lu"), (unsigned long)telemetryStatistics.numFailed); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("telemetry_deferred=%lu"), (unsigned long)telemetryStatistics.numDeferred); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("telemetry_max_send_us=%lu"), (unsigned long)telemetryStatistics.maxSendDuration); SCPI_ResultText(context, buffer);
+
+#if HTTP_PORT
+    const http_server::Statistics &httpStatistics = http_server::getStatistics();
+
+    sprintf_P(buffer, PSTR("http_requests=%lu"), (unsigned long)httpStatistics.numRequests); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("http_errors=%lu"), (unsigned long)httpStatistics.numErrors); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("http_timeouts=%lu"), (unsigned long)httpStatistics.numTimeouts); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("http_snapshots=%lu"), (unsigned long)httpStatistics.numSnapshots); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("http_max_response_us=%lu"), (unsigned long)httpStatistics.maxResponseDuration); SCPI_ResultText(context, buffer);
+#endif
+
+    return SCPI_RES_OK;
+#else
+    SCPI_ErrorPush(context, SCPI_ERROR_OPTION_NOT_INSTALLED);
+    return SCPI_RES_ERR;
+#endif
+}
+
+scpi_result_t scpi_cmd_diagnosticInformationDacQ(scpi_t * context) {
+    char buffer[64] = { 0 };
+
+    const DigitalAnalogConverter::Statistics &statistics = DigitalAnalogConverter::getStatistics();
+
+    sprintf_P(buffer, PSTR("writes=%lu"), (unsigned long)statistics.numWrites); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("transactions=%lu"), (unsigned long)statistics.numTransactions); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("saved_transactions=%lu"), (unsigned long)(statistics.numWrites - statistics.numTransactions)); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("group_skew=%lu"), (unsigned long)getGroupSkew()); SCPI_ResultText(context, buffer);
+
+    return SCPI_RES_OK;
+}
+
+scpi_result_t scpi_cmd_diagnosticInformationIoexpanderQ(scpi_t * context) {
+    char buffer[64] = { 0 };
+
+    const IOExpander::Statistics &statistics = IOExpander::getStatistics();
+
+    sprintf_P(buffer, PSTR("reads=%lu"), (unsigned long)statistics.numReads); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("cached_reads=%lu"), (unsigned long)statistics.numCachedReads); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("interrupts=%lu"), (unsigned long)statistics.numInterrupts); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("avg_read_duration=%lu"), (unsigned long)statistics.avgReadDuration); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("saved_bus_us_per_second=%lu"), (unsigned long)statistics.savedBusTimePerSecond); SCPI_ResultText(context, buffer);
+
+    return SCPI_RES_OK;
+}
+
+scpi_result_t scpi_cmd_diagnosticInformationSchedulerQ(scpi_t * context) {
+    char buffer[128] = { 0 };
+
+    for (int i = 0; i < scheduler::getNumTasks(); ++i) {
+        const scheduler::TaskStatistics &statistics = scheduler::getTaskStatistics(i);
+        sprintf_P(buffer, PSTR("%s: runs=%lu, late=%lu, max_lateness=%lu, overruns=%lu, max_duration=%lu"),
+            scheduler::getTaskName(i),
+            (unsigned long)statistics.numExecuted,
+            (unsigned long)statistics.numLate,
+            (unsigned long)statistics.maxLateness,
+            (unsigned long)statistics.numOverruns,
+            (unsigned long)statistics.maxDuration);
+        SCPI_ResultText(context, buffer);
+    }
+
+    return SCPI_RES_OK;
+}
+
+scpi_result_t scpi_cmd_diagnosticInformationSerialQ(scpi_t * context) {
+    char buffer[64] = { 0 };
+
+    const serial::Statistics &statistics = serial::getStatistics();
+    scpi_psu_t *psu_context = (scpi_psu_t *)serial::scpi_context.user_context;
+
+    sprintf_P(buffer, PSTR("rx_bytes=%lu"), (unsigned long)statistics.rxBytes); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("rx_overruns=%lu"), (unsigned long)statistics.numRxOverruns); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("max_rx_pending=%u"), (unsigned)statistics.maxRxPending); SCPI_ResultText(context, buffer);
+    sprintf_P(buffer, PSTR("input_overruns=%lu"), (unsigned long)psu_context->numInputOverruns); SCPI_ResultText(context, buffer);
+
+    return SCPI_RES_OK;
+}
+
 }
 }
 } // namespace eez::psu::scpi
\ No newline at end of file
@@ -0,0 +1,100 @@
+/*
+ * EEZ PSU Firmware
+ * Copyright (C) 2018-present, Envox d.o.o.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+ 
+#include "psu.h"
+#include "scpi_psu.h"
+
+namespace eez {
+namespace psu {
+namespace scpi {
+
+////////////////////////////////////////////////////////////////////////////////
+
+static const int DATA_FORMAT_ASCII = 0;
+static const int DATA_FORMAT_REAL = 1;
+
+static scpi_choice_def_t dataFormatChoice[] = {
+    { "ASCii", DATA_FORMAT_ASCII },
+    { "REAL", DATA_FORMAT_REAL },
+    SCPI_CHOICE_LIST_END
+};
+
+static scpi_choice_def_t byteOrderChoice[] = {
+    { "NORMal", SCPI_FORMAT_NORMAL },
+    { "SWAPped", SCPI_FORMAT_SWAPPED },
+    SCPI_CHOICE_LIST_END
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
+scpi_result_t scpi_cmd_formatData(scpi_t * context) {
+    int32_t dataFormat;
+    if (!SCPI_ParamChoice(context, dataFormatChoice, &dataFormat, true)) {
+        return SCPI_RES_ERR;
+    }
+
+    int32_t length;
+    if (!SCPI_ParamInt(context, &length, false)) {
+        if (SCPI_ParamErrorOccurred(context)) {
+            return SCPI_RES_ERR;
+        }
+        length = dataFormat == DATA_FORMAT_REAL ? 32 : 0;
+    }
+
+    // only REAL,32 (IEEE 754 single precision) is supported
+    if (dataFormat == DATA_FORMAT_REAL ? length != 32 : length != 0) {
+        SCPI_ErrorPush(context, SCPI_ERROR_ILLEGAL_PARAMETER_VALUE);
+        return SCPI_RES_ERR;
+    }
+
+    SCPI_SetResultFormat(context, dataFormat == DATA_FORMAT_REAL, context->result_byte_order);
+
+    return SCPI_RES_OK;
+}
+
+scpi_result_t scpi_cmd_formatDataQ(scpi_t * context) {
+    if (context->result_real) {
+        resultChoiceName(context, dataFormatChoice, DATA_FORMAT_REAL);
+        SCPI_ResultInt(context, 32);
+    } else {
+        resultChoiceName(context, dataFormatChoice, DATA_FORMAT_ASCII);
+    }
+
+    return SCPI_RES_OK;
+}
+
+scpi_result_t scpi_cmd_formatBorder(scpi_t * context) {
+    int32_t byteOrder;
+    if (!SCPI_ParamChoice(context, byteOrderChoice, &byteOrder, true)) {
+        return SCPI_RES_ERR;
+    }
+
+    SCPI_SetResultFormat(context, context->result_real, (scpi_array_format_t)byteOrder);
+
+    return SCPI_RES_OK;
+}
+
+scpi_result_t scpi_cmd_formatBorderQ(scpi_t * context) {
+    resultChoiceName(context, byteOrderChoice, context->result_byte_order);
+
+    return SCPI_RES_OK;
+}
+
+}
+}
+} // namespace eez::psu::scpi
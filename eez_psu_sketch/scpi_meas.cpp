@@ -27,17 +27,82 @@ namespace scpi {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+/// Number of values returned by MEASure:ALL? per channel: U, I, P and flags.
+static const int MEASURE_ALL_VALUES_PER_CHANNEL = 4;
+
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+* MEASure[:SCALar]:ALL[:DC]?
+*
+* For each channel returns voltage, current, power and state flags
+* (see ChannelStateFlags), all taken from the same measurement cycle.
+* If FORMat REAL is selected, all values are returned as one block of floats.
+*/
+scpi_result_t scpi_cmd_measureScalarAllDcQ(scpi_t * context) {
+    if (!psu::isPowerUp()) {
+        SCPI_ErrorPush(context, SCPI_ERROR_EXECUTION_ERROR);
+        return SCPI_RES_ERR;
+    }
+
+    float values[CH_NUM * MEASURE_ALL_VALUES_PER_CHANNEL];
+
+    noInterrupts();
+
+    for (int i = 0; i < CH_NUM; ++i) {
+        Channel &channel = Channel::get(i);
+        float *channelValues = values + i * MEASURE_ALL_VALUES_PER_CHANNEL;
+
+        if (channel.isOk()) {
+            channelValues[0] = channel_dispatcher::getUMon(channel);
+            channelValues[1] = channel_dispatcher::getIMon(channel);
+            channelValues[2] = channelValues[0] * channelValues[1];
+        } else {
+            channelValues[0] = 0;
+            channelValues[1] = 0;
+            channelValues[2] = 0;
+        }
+
+        channelValues[3] = (float)channel.getStateFlags();
+    }
+
+    interrupts();
+
+    if (SCPI_GetResultFormat(context) != SCPI_FORMAT_ASCII) {
+        SCPI_ResultArrayFloat(context, values, CH_NUM * MEASURE_ALL_VALUES_PER_CHANNEL, SCPI_GetResultFormat(context));
+        return SCPI_RES_OK;
+    }
+
+    char buffer[32];
+    for (int i = 0; i < CH_NUM; ++i) {
+        Channel &channel = Channel::get(i);
+        float *channelValues = values + i * MEASURE_ALL_VALUES_PER_CHANNEL;
+
+        buffer[0] = 0;
+        util::strcatFloat(buffer, channelValues[0], getNumSignificantDecimalDigits(VALUE_TYPE_FLOAT_VOLT));
+        SCPI_ResultCharacters(context, buffer, strlen(buffer));
+
+        buffer[0] = 0;
+        util::strcatFloat(buffer, channelValues[1], getNumSignificantDecimalDigitsForCurrent(channel.flags.currentRange));
+        SCPI_ResultCharacters(context, buffer, strlen(buffer));
+
+        buffer[0] = 0;
+        util::strcatFloat(buffer, channelValues[2], getNumSignificantDecimalDigits(VALUE_TYPE_FLOAT_WATT));
+        SCPI_ResultCharacters(context, buffer, strlen(buffer));
+
+        SCPI_ResultInt(context, (int)channelValues[3]);
+    }
+
+    return SCPI_RES_OK;
+}
+
 scpi_result_t scpi_cmd_measureScalarCurrentDcQ(scpi_t * context) {
     Channel *channel = param_channel(context);
     if (!channel) {
         return SCPI_RES_ERR;
     }
 
-    char buffer[256] = { 0 };
-    util::strcatFloat(buffer, channel_dispatcher::getIMon(*channel), getNumSignificantDecimalDigitsForCurrent(channel->flags.currentRange));
-    SCPI_ResultCharacters(context, buffer, strlen(buffer));
-
-    return SCPI_RES_OK;
+    return result_float(context, channel_dispatcher::getIMon(*channel), getNumSignificantDecimalDigitsForCurrent(channel->flags.currentRange));
 }
 
 scpi_result_t scpi_cmd_measureScalarPowerDcQ(scpi_t * context) {
@@ -46,11 +111,7 @@ scpi_result_t scpi_cmd_measureScalarPowerDcQ(scpi_t * context) {
         return SCPI_RES_ERR;
     }
 
-    char buffer[256] = { 0 };
-    util::strcatFloat(buffer, channel_dispatcher::getUMon(*channel) * channel_dispatcher::getIMon(*channel), getNumSignificantDecimalDigits(VALUE_TYPE_FLOAT_WATT));
-    SCPI_ResultCharacters(context, buffer, strlen(buffer));
-
-    return SCPI_RES_OK;
+    return result_float(context, channel_dispatcher::getUMon(*channel) * channel_dispatcher::getIMon(*channel), getNumSignificantDecimalDigits(VALUE_TYPE_FLOAT_WATT));
 }
 
 scpi_result_t scpi_cmd_measureScalarVoltageDcQ(scpi_t * context) {
@@ -59,11 +120,7 @@ scpi_result_t scpi_cmd_measureScalarVoltageDcQ(scpi_t * context) {
         return SCPI_RES_ERR;
     }
 
-    char buffer[256] = { 0 };
-    util::strcatFloat(buffer, channel_dispatcher::getUMon(*channel), getNumSignificantDecimalDigits(VALUE_TYPE_FLOAT_VOLT));
-    SCPI_ResultCharacters(context, buffer, strlen(buffer));
-
-    return SCPI_RES_OK;
+    return result_float(context, channel_dispatcher::getUMon(*channel), getNumSignificantDecimalDigits(VALUE_TYPE_FLOAT_VOLT));
 }
 
 scpi_result_t scpi_cmd_measureScalarTemperatureThermistorDcQ(scpi_t * context) {
@@ -72,11 +129,7 @@ scpi_result_t scpi_cmd_measureScalarTemperatureThermistorDcQ(scpi_t * context) {
 		return SCPI_RES_ERR;
     }
 
-    char buffer[256] = { 0 };
-    util::strcatFloat(buffer, temperature::sensors[sensor].measure(), getNumSignificantDecimalDigits(VALUE_TYPE_FLOAT_CELSIUS));
-    SCPI_ResultCharacters(context, buffer, strlen(buffer));
-
-    return SCPI_RES_OK;
+    return result_float(context, temperature::sensors[sensor].measure(), getNumSignificantDecimalDigits(VALUE_TYPE_FLOAT_CELSIUS));
 }
 
 }
@@ -20,6 +20,8 @@
 #include "scpi_psu.h"
 
 #include "profile.h"
+#include "macro.h"
+#include "job_queue.h"
 
 namespace eez {
 namespace psu {
@@ -27,6 +29,237 @@ namespace scpi {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+static bool deleteJobStep(job_queue::Job &job, int16_t &err) {
+    if (!profile::deleteLocation(job.iParam)) {
+        err = SCPI_ERROR_EXECUTION_ERROR;
+    }
+    return true;
+}
+
+static bool deleteAllJobStep(job_queue::Job &job, int16_t &err) {
+    // one location per slice
+    int location = 1 + job.state++;
+    if (!profile::deleteLocation(location)) {
+        err = SCPI_ERROR_EXECUTION_ERROR;
+        return true;
+    }
+    return location == NUM_PROFILE_LOCATIONS - 1;
+}
+
+#if NUM_MACRO_LOCATIONS
+
+static bool saveMacroJobStep(job_queue::Job &job, int16_t &err) {
+    if (!persist_conf::saveMacro(job.iParam, &job.macro)) {
+        err = SCPI_ERROR_EXECUTION_ERROR;
+    }
+    return true;
+}
+
+static bool deleteAllMacrosJobStep(job_queue::Job &job, int16_t &err) {
+    // one location per slice
+    int location = job.state++;
+    if (!persist_conf::saveMacro(location, &job.macro)) {
+        err = SCPI_ERROR_EXECUTION_ERROR;
+        return true;
+    }
+    return location == NUM_MACRO_LOCATIONS - 1;
+}
+
+static bool get_macro_name_param(scpi_t *context, const char *&name, size_t &name_len) {
+    if (!SCPI_ParamCharacters(context, &name, &name_len, true)) {
+        return false;
+    }
+
+    if (name_len == 0) {
+        SCPI_ErrorPush(context, SCPI_ERROR_ILLEGAL_PARAMETER_VALUE);
+        return false;
+    }
+
+    if (name_len > MACRO_NAME_MAX_LENGTH) {
+        SCPI_ErrorPush(context, SCPI_ERROR_TOO_MUCH_DATA);
+        return false;
+    }
+
+    return true;
+}
+
+static bool get_macro_location_param(scpi_t *context, int &location) {
+    const char *name;
+    size_t name_len;
+    if (!get_macro_name_param(context, name, name_len)) {
+        return false;
+    }
+
+    location = macro::find(name, name_len);
+    if (location == -1) {
+        SCPI_ErrorPush(context, SCPI_ERROR_MACRO_HEADER_NOT_FOUND);
+        return false;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+scpi_result_t scpi_cmd_memoryMacroCatalogQ(scpi_t *context) {
+    char name[MACRO_NAME_MAX_LENGTH + 1];
+
+    for (int i = 0; i < NUM_MACRO_LOCATIONS; ++i) {
+        if (macro::isValid(i)) {
+            macro::getName(i, name, sizeof(name));
+            SCPI_ResultText(context, name);
+        }
+    }
+
+    return SCPI_RES_OK;
+}
+
+scpi_result_t scpi_cmd_memoryMacroDefine(scpi_t *context) {
+    const char *name;
+    size_t name_len;
+    if (!get_macro_name_param(context, name, name_len)) {
+        return SCPI_RES_ERR;
+    }
+
+    char text[MACRO_TEXT_MAX_LENGTH + 2];
+    size_t text_len;
+    if (!SCPI_ParamCopyText(context, text, sizeof(text), &text_len, true)) {
+        return SCPI_RES_ERR;
+    }
+
+    if (text_len > MACRO_TEXT_MAX_LENGTH) {
+        SCPI_ErrorPush(context, SCPI_ERROR_TOO_MUCH_DATA);
+        return SCPI_RES_ERR;
+    }
+
+    int location = macro::findForDefine(name, name_len);
+    if (location == -1) {
+        SCPI_ErrorPush(context, SCPI_ERROR_OUT_OF_MEMORY_FOR_REQ_OP);
+        return SCPI_RES_ERR;
+    }
+
+    job_queue::Job job;
+    if (!macro::define(context, location, name, name_len, text, text_len, job.macro)) {
+        return SCPI_RES_ERR;
+    }
+    job.iParam = location;
+    job_queue::push(context, saveMacroJobStep, job);
+
+    return SCPI_RES_OK;
+}
+
+scpi_result_t scpi_cmd_memoryMacroDefineQ(scpi_t *context) {
+    int location;
+    if (!get_macro_location_param(context, location)) {
+        return SCPI_RES_ERR;
+    }
+
+    job_queue::waitAll();
+
+    macro::Macro macro;
+    if (!macro::load(location, macro)) {
+        SCPI_ErrorPush(context, SCPI_ERROR_EXECUTION_ERROR);
+        return SCPI_RES_ERR;
+    }
+
+    SCPI_ResultText(context, macro.text);
+
+    return SCPI_RES_OK;
+}
+
+scpi_result_t scpi_cmd_memoryMacroDelete(scpi_t *context) {
+    int location;
+    if (!get_macro_location_param(context, location)) {
+        return SCPI_RES_ERR;
+    }
+
+    job_queue::Job job;
+    macro::remove(location, job.macro);
+    job.iParam = location;
+    job_queue::push(context, saveMacroJobStep, job);
+
+    return SCPI_RES_OK;
+}
+
+scpi_result_t scpi_cmd_memoryMacroDeleteAll(scpi_t *context) {
+    job_queue::Job job;
+    for (int i = 0; i < NUM_MACRO_LOCATIONS; ++i) {
+        macro::remove(i, job.macro);
+    }
+    job_queue::push(context, deleteAllMacrosJobStep, job);
+
+    return SCPI_RES_OK;
+}
+
+scpi_result_t scpi_cmd_memoryMacroExecute(scpi_t *context) {
+    int location;
+    if (!get_macro_location_param(context, location)) {
+        return SCPI_RES_ERR;
+    }
+
+    if (!macro::execute(context, location)) {
+        return SCPI_RES_ERR;
+    }
+
+    return SCPI_RES_OK;
+}
+
+scpi_result_t scpi_cmd_memoryMacroTimeQ(scpi_t *context) {
+    int location;
+    if (!get_macro_location_param(context, location)) {
+        return SCPI_RES_ERR;
+    }
+
+    const macro::Timing &timing = macro::getTiming(location);
+
+    // sending the same commands unparsed costs compileDuration + lastDuration
+    SCPI_ResultUInt32(context, timing.compileDuration);
+    SCPI_ResultUInt32(context, timing.lastDuration);
+    SCPI_ResultUInt32(context, timing.compileDuration + timing.lastDuration);
+    SCPI_ResultUInt32(context, timing.numExecuted);
+
+    return SCPI_RES_OK;
+}
+
+#else
+
+static scpi_result_t macrosNotInstalled(scpi_t *context) {
+    SCPI_ErrorPush(context, SCPI_ERROR_OPTION_NOT_INSTALLED);
+    return SCPI_RES_ERR;
+}
+
+scpi_result_t scpi_cmd_memoryMacroCatalogQ(scpi_t *context) {
+    return macrosNotInstalled(context);
+}
+
+scpi_result_t scpi_cmd_memoryMacroDefine(scpi_t *context) {
+    return macrosNotInstalled(context);
+}
+
+scpi_result_t scpi_cmd_memoryMacroDefineQ(scpi_t *context) {
+    return macrosNotInstalled(context);
+}
+
+scpi_result_t scpi_cmd_memoryMacroDelete(scpi_t *context) {
+    return macrosNotInstalled(context);
+}
+
+scpi_result_t scpi_cmd_memoryMacroDeleteAll(scpi_t *context) {
+    return macrosNotInstalled(context);
+}
+
+scpi_result_t scpi_cmd_memoryMacroExecute(scpi_t *context) {
+    return macrosNotInstalled(context);
+}
+
+scpi_result_t scpi_cmd_memoryMacroTimeQ(scpi_t *context) {
+    return macrosNotInstalled(context);
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+
 scpi_result_t scpi_cmd_memoryNstatesQ(scpi_t *context) {
     SCPI_ResultInt(context, NUM_PROFILE_LOCATIONS);
 
@@ -34,6 +267,8 @@ scpi_result_t scpi_cmd_memoryNstatesQ(scpi_t *context) {
 }
 
 scpi_result_t scpi_cmd_memoryStateCatalogQ(scpi_t *context) {
+    job_queue::waitAll();
+
     char name[PROFILE_NAME_MAX_LENGTH + 1];
 
     for (int i = 0; i < NUM_PROFILE_LOCATIONS; ++i) {
@@ -50,19 +285,16 @@ scpi_result_t scpi_cmd_memoryStateDelete(scpi_t *context) {
         return SCPI_RES_ERR;
     }
 
-    if (!profile::deleteLocation(location)) {
-        SCPI_ErrorPush(context, SCPI_ERROR_EXECUTION_ERROR);
-        return SCPI_RES_ERR;
-    }
+    job_queue::Job job;
+    job.iParam = location;
+    job_queue::push(context, deleteJobStep, job);
 
     return SCPI_RES_OK;
 }
 
 scpi_result_t scpi_cmd_memoryStateDeleteAll(scpi_t *context) {
-    if (!profile::deleteAll()) {
-        SCPI_ErrorPush(context, SCPI_ERROR_EXECUTION_ERROR);
-        return SCPI_RES_ERR;
-    }
+    job_queue::Job job;
+    job_queue::push(context, deleteAllJobStep, job);
 
     return SCPI_RES_OK;
 }
@@ -73,6 +305,8 @@ scpi_result_t scpi_cmd_memoryStateName(scpi_t *context) {
         return SCPI_RES_ERR;
     }
 
+    job_queue::waitAll();
+
     if (!profile::isValid(location)) {
         SCPI_ErrorPush(context, SCPI_ERROR_EXECUTION_ERROR);
         return SCPI_RES_ERR;
@@ -103,6 +337,8 @@ scpi_result_t scpi_cmd_memoryStateNameQ(scpi_t *context) {
         return SCPI_RES_ERR;
     }
 
+    job_queue::waitAll();
+
     char name[PROFILE_NAME_MAX_LENGTH + 1];
     profile::getName(location, name, sizeof(name));
 
@@ -137,6 +373,8 @@ scpi_result_t scpi_cmd_memoryStateRecallSelect(scpi_t *context) {
         return SCPI_RES_ERR;
     }
 
+    job_queue::waitAll();
+
     if (!profile::isValid(location)) {
         SCPI_ErrorPush(context, SCPI_ERROR_EXECUTION_ERROR);
         return SCPI_RES_ERR;
@@ -162,6 +400,8 @@ scpi_result_t scpi_cmd_memoryStateValidQ(scpi_t *context) {
         return SCPI_RES_ERR;
     }
 
+    job_queue::waitAll();
+
     SCPI_ResultBool(context, profile::isValid(location));
 
     return SCPI_RES_OK;
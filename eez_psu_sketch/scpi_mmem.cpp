@@ -21,6 +21,7 @@
 
 #include "trigger.h"
 #include "list.h"
+#include "job_queue.h"
 
 namespace eez {
 namespace psu {
@@ -56,6 +57,24 @@ bool getFileNameParam(scpi_t *context, char *filePath, int *err) {
 
 ////////////////////////////////////////////////////////////////////////////////
 
+static bool loadListJobStep(job_queue::Job &job, int16_t &err) {
+    int listErr;
+    if (!list::loadList(Channel::get(job.iParam), job.filePath, &listErr)) {
+        err = listErr;
+    }
+    return true;
+}
+
+static bool storeListJobStep(job_queue::Job &job, int16_t &err) {
+    int listErr;
+    if (!list::saveList(Channel::get(job.iParam), job.filePath, &listErr)) {
+        err = listErr;
+    }
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 scpi_result_t scpi_cmd_mmemoryLoadList(scpi_t *context) {
 	Channel *channel = set_channel_from_command_number(context);
     if (!channel) {
@@ -76,10 +95,11 @@ scpi_result_t scpi_cmd_mmemoryLoadList(scpi_t *context) {
         return SCPI_RES_ERR;
     }
 
-    if (!list::loadList(*channel, filePath, &err)) {
-        SCPI_ErrorPush(context, err);
-        return SCPI_RES_ERR;
-    }
+    job_queue::Job job;
+    job.iParam = channel->index - 1;
+    strcpy(job.filePath, filePath);
+    job.writesChannelLists = true;
+    job_queue::push(context, loadListJobStep, job);
 
     return SCPI_RES_OK;
 }
@@ -104,10 +124,11 @@ scpi_result_t scpi_cmd_mmemoryStoreList(scpi_t *context) {
         return SCPI_RES_ERR;
     }
 
-    if (!list::saveList(*channel, filePath, &err)) {
-        SCPI_ErrorPush(context, err);
-        return SCPI_RES_ERR;
-    }
+    job_queue::Job job;
+    job.iParam = channel->index - 1;
+    strcpy(job.filePath, filePath);
+    job.readsChannelLists = true;
+    job_queue::push(context, storeListJobStep, job);
 
     return SCPI_RES_OK;
 }
@@ -522,13 +522,23 @@ bool get_power_limit_from_param(scpi_t *context, const scpi_number_t &param, flo
     return true;
 }
 
-scpi_result_t result_float(scpi_t *context, float value, ValueType valueType) {
+scpi_result_t result_float(scpi_t *context, float value, int numSignificantDecimalDigits) {
+    if (SCPI_GetResultFormat(context) != SCPI_FORMAT_ASCII) {
+        // FORMat REAL: value is sent as binary block, no need to format it
+        SCPI_ResultFloat(context, value);
+        return SCPI_RES_OK;
+    }
+
     char buffer[32] = { 0 };
-    util::strcatFloat(buffer, value, valueType);
+    util::strcatFloat(buffer, value, numSignificantDecimalDigits);
     SCPI_ResultCharacters(context, buffer, strlen(buffer));
     return SCPI_RES_OK;
 }
 
+scpi_result_t result_float(scpi_t *context, float value, ValueType valueType) {
+    return result_float(context, value, (int)valueType);
+}
+
 bool get_profile_location_param(scpi_t * context, int &location, bool all_locations) {
     int32_t param;
     if (!SCPI_ParamInt(context, &param, true)) {
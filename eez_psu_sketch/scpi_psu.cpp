@@ -23,6 +23,13 @@
 
 #include "sound.h"
 #include "datetime.h"
+#include "dac.h"
+
+#if USE_COMMAND_PROFILING
+uint32_t SCPI_ProfileTime(void) {
+    return micros();
+}
+#endif
 
 namespace eez {
 namespace psu {
@@ -56,9 +63,19 @@ static const scpi_command_t scpi_commands[] = {
 
 #endif
 
+#if USE_COMMAND_PROFILING
+/// Execution statistics of every command, shared by all SCPI contexts.
+static scpi_command_profile_t g_commandProfile[sizeof(scpi_commands) / sizeof(scpi_command_t) - 1];
+#endif
+
 static bool g_wasActive = false;
 static uint32_t g_timeOfLastActivity;
 
+/// SCPI context which began the group, 0 if group is not active.
+static scpi_t *g_groupContext;
+static uint32_t g_groupBeginTime;
+static uint32_t g_groupSkew;
+
 ////////////////////////////////////////////////////////////////////////////////
 
 void init(scpi_t &scpi_context,
@@ -74,6 +91,10 @@ void init(scpi_t &scpi_context,
         input_buffer, input_buffer_length, error_queue_data, error_queue_size);
 
     scpi_context.user_context = &scpi_psu_context;
+
+#if USE_COMMAND_PROFILING
+    scpi_context.command_profile = g_commandProfile;
+#endif
 }
 
 void tick(uint32_t tickCount) {
@@ -86,43 +107,155 @@ void tick(uint32_t tickCount) {
     } else if (g_timeOfLastActivity != 0 && tickCount - g_timeOfLastActivity >= SCPI_IDLE_TIMEOUT * 1000000L) {
         g_timeOfLastActivity = 0;
     } 
+
+    if (isGroupActive() && tickCount - g_groupBeginTime >= SCPI_GROUP_TIMEOUT * 1000L) {
+        // client forgot (or was disconnected before) SYSTem:GROup:COMMit
+        groupCommit();
+    }
 }
 
-void input(scpi_t &scpi_context, char ch) {
-    g_wasActive = true;
-    //if (ch < 0 || ch > 127) {
-    //    // non ASCII, call parser now
-    //    SCPI_Input(&scpi_context, 0, 0);
-    //    return;
-    //}
+void groupBegin(scpi_t &scpi_context, uint32_t tick_usec) {
+    g_groupContext = &scpi_context;
+    g_groupBeginTime = tick_usec;
+    DigitalAnalogConverter::hold();
+}
+
+bool isGroupActive() {
+    return g_groupContext != 0;
+}
 
-    int result = SCPI_Input(&scpi_context, &ch, 1);
-    if (result == -1) {
-        // TODO we need better buffer overrun handling here
+bool isGroupOwner(scpi_t &scpi_context) {
+    return g_groupContext == &scpi_context;
+}
+
+uint32_t groupCommit() {
+    if (g_groupContext) {
+        g_groupContext = 0;
+        DigitalAnalogConverter::enableHold(true);
+        g_groupSkew = DigitalAnalogConverter::release();
+    }
+    return g_groupSkew;
+}
 
-        // call parser now
-        SCPI_Input(&scpi_context, 0, 0);
+uint32_t getGroupSkew() {
+    return g_groupSkew;
+}
+
+static void getStatus(scpi_t &scpi_context, scpi_psu_status_t &status) {
+    status.stb = SCPI_RegGet(&scpi_context, SCPI_REG_STB);
+    status.esr = SCPI_RegGet(&scpi_context, SCPI_REG_ESR);
+    status.ques = SCPI_RegGet(&scpi_context, SCPI_REG_QUES);
+    status.quesCond = reg_get(&scpi_context, SCPI_PSU_REG_QUES_COND);
+    status.oper = SCPI_RegGet(&scpi_context, SCPI_REG_OPER);
+    status.operCond = reg_get(&scpi_context, SCPI_PSU_REG_OPER_COND);
+}
 
-        // input buffer is now empty, feed it
-        SCPI_Input(&scpi_context, &ch, 1);
+void notifyTick(scpi_t &scpi_context, uint32_t tick_usec) {
+    scpi_psu_t *psu_context = (scpi_psu_t *)scpi_context.user_context;
+    if (!psu_context->notify) {
+        return;
     }
+
+    scpi_psu_status_t status;
+    getStatus(scpi_context, status);
+
+    if (memcmp(&status, &psu_context->notifiedStatus, sizeof(scpi_psu_status_t)) == 0) {
+        // nothing changed or change was reverted before it was reported
+        psu_context->notifyPendingSince = 0;
+        return;
+    }
+
+    if (psu_context->notifyPendingSince == 0) {
+        // wait for the changes that usually follow (event, condition and summary bits)
+        psu_context->notifyPendingSince = tick_usec ? tick_usec : 1;
+        return;
+    }
+
+    if (tick_usec - psu_context->notifyPendingSince < SCPI_STATUS_NOTIFY_DELAY) {
+        return;
+    }
+
+    char buffer[96];
+    sprintf_P(buffer, PSTR("**STATUS: STB=%d,ESR=%d,QUES=%d,QUES:COND=%d,OPER=%d,OPER:COND=%d\r\n"),
+        (int)status.stb, (int)status.esr,
+        (int)status.ques, (int)status.quesCond,
+        (int)status.oper, (int)status.operCond);
+    scpi_context.interface->write(&scpi_context, buffer, strlen(buffer));
+
+    psu_context->notifiedStatus = status;
+    psu_context->notifyPendingSince = 0;
+}
+
+void setNotify(scpi_t &scpi_context, bool enable) {
+    scpi_psu_t *psu_context = (scpi_psu_t *)scpi_context.user_context;
+    psu_context->notify = enable;
+    // first message reports everything that is set at the moment
+    memset(&psu_context->notifiedStatus, 0, sizeof(scpi_psu_status_t));
+    psu_context->notifyPendingSince = 0;
+}
+
+void input(scpi_t &scpi_context, char ch) {
+    input(scpi_context, &ch, 1);
 }
 
 void input(scpi_t &scpi_context, const char *str, size_t size) {
+    while (size > 0) {
+        size_t freeSize;
+        char *buffer = getInputBuffer(scpi_context, freeSize);
+
+        size_t n = size < freeSize ? size : freeSize;
+        memcpy(buffer, str, n);
+        inputCommit(scpi_context, n);
+
+        str += n;
+        size -= n;
+    }
+}
+
+char *getInputBuffer(scpi_t &scpi_context, size_t &size) {
+    char *buffer = SCPI_InputBuffer(&scpi_context, &size);
+    if (size == 0) {
+        // Complete messages are always parsed in inputCommit,
+        // so this is a message that doesn't fit in the input buffer.
+        scpi_psu_t *psu_context = (scpi_psu_t *)scpi_context.user_context;
+        psu_context->inputOverrun = true;
+        ++psu_context->numInputOverruns;
+
+        SCPI_ErrorPush(&scpi_context, SCPI_ERROR_INPUT_BUFFER_OVERRUN);
+
+        scpi_context.buffer.position = 0;
+        buffer = SCPI_InputBuffer(&scpi_context, &size);
+    }
+    return buffer;
+}
+
+void inputCommit(scpi_t &scpi_context, size_t size) {
     g_wasActive = true;
-    //if (ch < 0 || ch > 127) {
-    //    // non ASCII, call parser now
-    //    SCPI_Input(&scpi_context, 0, 0);
-    //    return;
-    //}
-
-    int result = SCPI_Input(&scpi_context, str, size);
-    if (result == -1) {
-        // TODO we need better buffer overrun handling here
-
-        // call parser now
-        SCPI_Input(&scpi_context, 0, 0);
+
+    scpi_psu_t *psu_context = (scpi_psu_t *)scpi_context.user_context;
+    if (psu_context->inputOverrun) {
+        // skip the rest of the message that didn't fit
+        char *data = scpi_context.buffer.data + scpi_context.buffer.position;
+        char *newLine = (char *)memchr(data, '\n', size);
+        if (!newLine) {
+            return;
+        }
+
+        psu_context->inputOverrun = false;
+
+        size_t skip = newLine + 1 - data;
+        size -= skip;
+        memmove(data, newLine + 1, size);
+        if (size == 0) {
+            return;
+        }
     }
+
+    // only the session which began the group has its values held,
+    // values set by other sessions and by the front panel are applied immediately
+    DigitalAnalogConverter::enableHold(!g_groupContext || g_groupContext == &scpi_context);
+    SCPI_InputCommit(&scpi_context, size);
+    DigitalAnalogConverter::enableHold(!g_groupContext);
 }
 
 void printError(int_fast16_t err) {
@@ -159,6 +292,22 @@ void resultChoiceName(scpi_t * context, scpi_choice_def_t *choice, int tag) {
     }
 }
 
+#if USE_COMMAND_PROFILING
+
+const scpi_command_profile_t *getCommandProfile(int index, const char *&pattern) {
+    if (index < 0 || index >= (int)(sizeof(g_commandProfile) / sizeof(scpi_command_profile_t))) {
+        return 0;
+    }
+    pattern = scpi_commands[index].pattern;
+    return &g_commandProfile[index];
+}
+
+void resetCommandProfile() {
+    memset(g_commandProfile, 0, sizeof(g_commandProfile));
+}
+
+#endif
+
 bool isIdle() {
     return g_timeOfLastActivity == 0;
 }
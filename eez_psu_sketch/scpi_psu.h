@@ -26,10 +26,30 @@ namespace psu {
 /// SCPI commands.
 namespace scpi {
 
+/// Status registers reported by STATus:NOTify.
+struct scpi_psu_status_t {
+    scpi_reg_val_t stb;
+    scpi_reg_val_t esr;
+    scpi_reg_val_t ques;
+    scpi_reg_val_t quesCond;
+    scpi_reg_val_t oper;
+    scpi_reg_val_t operCond;
+};
+
 /// EEZ PSU specific SCPI parser context data.
 struct scpi_psu_t {
     scpi_reg_val_t *registers;
     uint8_t selected_channel_index;
+    /// Message didn't fit in the input buffer, input is discarded up to the next new line.
+    bool inputOverrun;
+    /// Number of messages discarded because they didn't fit in the input buffer.
+    uint32_t numInputOverruns;
+    /// Status register changes are pushed to the client (STATus:NOTify).
+    bool notify;
+    /// Status registers as reported in the last notification.
+    scpi_psu_status_t notifiedStatus;
+    /// Time (in microseconds) when not yet reported change was detected, 0 if there is none.
+    uint32_t notifyPendingSince;
 };
 
 void init(scpi_t &scpi_context,
@@ -42,15 +62,48 @@ void init(scpi_t &scpi_context,
 
 void tick(uint32_t tickCount);
 
+/// Push "**STATUS: ..." message to the client if status registers changed since the last one.
+/// Changes detected within SCPI_STATUS_NOTIFY_DELAY are coalesced into a single message.
+void notifyTick(scpi_t &scpi_context, uint32_t tick_usec);
+
+/// Enable or disable status notifications for the given SCPI context.
+void setNotify(scpi_t &scpi_context, bool enable);
+
 void input(scpi_t &scpi_context, char ch);
 void input(scpi_t &scpi_context, const char *str, size_t size);
 
+/// Free space at the end of the SCPI input buffer. Transport can receive data
+/// directly there and then call inputCommit, instead of copying it with input.
+/// If buffer is full (message is too long) SCPI_ERROR_INPUT_BUFFER_OVERRUN is reported
+/// and the message is discarded.
+char *getInputBuffer(scpi_t &scpi_context, size_t &size);
+void inputCommit(scpi_t &scpi_context, size_t size);
+
+/// SYSTem:GROup:BEGin, new voltage and current set points are held back
+/// until groupCommit() and then applied to all channels at once.
+/// Only the set points set by the given SCPI context are held.
+void groupBegin(scpi_t &scpi_context, uint32_t tick_usec);
+bool isGroupActive();
+/// Did the given SCPI context begin the active group?
+bool isGroupOwner(scpi_t &scpi_context);
+/// \returns Achieved inter-channel skew in microseconds.
+uint32_t groupCommit();
+/// Inter-channel skew of the last commit in microseconds.
+uint32_t getGroupSkew();
+
 void printError(int_fast16_t err);
 
 void resultChoiceName(scpi_t *context, scpi_choice_def_t *choice, int tag);
 
 bool isIdle();
 
+#if USE_COMMAND_PROFILING
+/// Execution statistics of the command at the given index in the command list.
+/// \returns 0 if index is past the end of the command list.
+const scpi_command_profile_t *getCommandProfile(int index, const char *&pattern);
+void resetCommandProfile();
+#endif
+
 }
 }
 } // namespace eez::psu::scpi
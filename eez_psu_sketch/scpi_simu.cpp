@@ -371,6 +371,22 @@ scpi_result_t scpi_cmd_simulatorPin1Q(scpi_t * context) {
     return SCPI_RES_OK;
 }
 
+scpi_result_t scpi_cmd_simulatorTickFixed(scpi_t *context) {
+    bool value;
+    if (!SCPI_ParamBool(context, &value, TRUE)) {
+        return SCPI_RES_ERR;
+    }
+
+    simulator::enableFixedTickRate(value);
+
+    return SCPI_RES_OK;
+}
+
+scpi_result_t scpi_cmd_simulatorTickFixedQ(scpi_t *context) {
+    SCPI_ResultBool(context, simulator::isFixedTickRateEnabled() ? 1 : 0);
+    return SCPI_RES_OK;
+}
+
 }
 }
 } // namespace eez::psu::scpi
@@ -466,6 +482,16 @@ scpi_result_t scpi_cmd_simulatorPin1Q(scpi_t * context) {
     return SCPI_RES_ERR;
 }
 
+scpi_result_t scpi_cmd_simulatorTickFixed(scpi_t *context) {
+    SCPI_ErrorPush(context, SCPI_ERROR_UNDEFINED_HEADER);
+    return SCPI_RES_ERR;
+}
+
+scpi_result_t scpi_cmd_simulatorTickFixedQ(scpi_t *context) {
+    SCPI_ErrorPush(context, SCPI_ERROR_UNDEFINED_HEADER);
+    return SCPI_RES_ERR;
+}
+
 }
 }
 } // namespace eez::psu::scpi
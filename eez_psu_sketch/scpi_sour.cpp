@@ -1048,7 +1048,7 @@ scpi_result_t scpi_cmd_sourceListCurrentLevelQ(scpi_t *context) {
 
     uint16_t listLength;
     float *list = list::getCurrentList(*channel, &listLength);
-    SCPI_ResultArrayFloat(context, list, listLength, SCPI_FORMAT_ASCII);
+    SCPI_ResultArrayFloat(context, list, listLength, SCPI_GetResultFormat(context));
 
     return SCPI_RES_OK;
 }
@@ -1099,7 +1099,7 @@ scpi_result_t scpi_cmd_sourceListDwellQ(scpi_t *context) {
 
     uint16_t listLength;
     float *list = list::getDwellList(*channel, &listLength);
-    SCPI_ResultArrayFloat(context, list, listLength, SCPI_FORMAT_ASCII);
+    SCPI_ResultArrayFloat(context, list, listLength, SCPI_GetResultFormat(context));
 
     return SCPI_RES_OK;
 }
@@ -1150,7 +1150,7 @@ scpi_result_t scpi_cmd_sourceListVoltageLevelQ(scpi_t *context) {
 
     uint16_t listLength;
     float *list = list::getVoltageList(*channel, &listLength);
-    SCPI_ResultArrayFloat(context, list, listLength, SCPI_FORMAT_ASCII);
+    SCPI_ResultArrayFloat(context, list, listLength, SCPI_GetResultFormat(context));
 
     return SCPI_RES_OK;
 }
@@ -331,6 +331,25 @@ scpi_result_t scpi_cmd_statusPreset(scpi_t * context) {
     return SCPI_RES_OK;
 }
 
+scpi_result_t scpi_cmd_statusNotifyState(scpi_t * context) {
+    bool enable;
+    if (!SCPI_ParamBool(context, &enable, TRUE)) {
+        return SCPI_RES_ERR;
+    }
+
+    setNotify(*context, enable);
+
+    return SCPI_RES_OK;
+}
+
+scpi_result_t scpi_cmd_statusNotifyStateQ(scpi_t * context) {
+    scpi_psu_t *psu_context = (scpi_psu_t *)context->user_context;
+
+    SCPI_ResultBool(context, psu_context->notify);
+
+    return SCPI_RES_OK;
+}
+
 }
 }
 } // namespace eez::psu::scpi
\ No newline at end of file
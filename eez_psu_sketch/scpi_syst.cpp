@@ -23,6 +23,9 @@
 #include "sound.h"
 #include "profile.h"
 #include "channel_dispatcher.h"
+#if OPTION_ETHERNET
+#include "telemetry.h"
+#endif
 #if OPTION_DISPLAY
 #include "gui.h"
 #endif
@@ -708,6 +711,36 @@ scpi_result_t scpi_cmd_systemCommunicateRlstate(scpi_t * context) {
     return SCPI_RES_OK;
 }
 
+scpi_result_t scpi_cmd_systemGroupBegin(scpi_t * context) {
+    if (isGroupActive()) {
+        // one group at a time
+        SCPI_ErrorPush(context, SCPI_ERROR_EXECUTION_ERROR);
+        return SCPI_RES_ERR;
+    }
+
+    groupBegin(*context, micros());
+
+    return SCPI_RES_OK;
+}
+
+scpi_result_t scpi_cmd_systemGroupCommit(scpi_t * context) {
+    if (!isGroupOwner(*context)) {
+        // no group or group began by another session
+        SCPI_ErrorPush(context, SCPI_ERROR_EXECUTION_ERROR);
+        return SCPI_RES_ERR;
+    }
+
+    groupCommit();
+
+    return SCPI_RES_OK;
+}
+
+scpi_result_t scpi_cmd_systemGroupSkewQ(scpi_t * context) {
+    SCPI_ResultUInt32(context, getGroupSkew());
+
+    return SCPI_RES_OK;
+}
+
 scpi_result_t scpi_cmd_systemLocal(scpi_t * context) {
     g_rlState = RL_STATE_LOCAL;
 
@@ -738,6 +771,136 @@ scpi_result_t scpi_cmd_systemRwlock(scpi_t * context) {
     return SCPI_RES_OK;
 }
 
+scpi_result_t scpi_cmd_systemCommunicateLanTelemetryState(scpi_t * context) {
+#if OPTION_ETHERNET
+    bool enable;
+    if (!SCPI_ParamBool(context, &enable, TRUE)) {
+        return SCPI_RES_ERR;
+    }
+
+    if (!telemetry::enable(enable)) {
+        SCPI_ErrorPush(context, SCPI_ERROR_EXECUTION_ERROR);
+        return SCPI_RES_ERR;
+    }
+
+    return SCPI_RES_OK;
+#else
+    SCPI_ErrorPush(context, SCPI_ERROR_OPTION_NOT_INSTALLED);
+    return SCPI_RES_ERR;
+#endif
+}
+
+scpi_result_t scpi_cmd_systemCommunicateLanTelemetryStateQ(scpi_t * context) {
+#if OPTION_ETHERNET
+    SCPI_ResultBool(context, telemetry::isEnabled());
+
+    return SCPI_RES_OK;
+#else
+    SCPI_ErrorPush(context, SCPI_ERROR_OPTION_NOT_INSTALLED);
+    return SCPI_RES_ERR;
+#endif
+}
+
+scpi_result_t scpi_cmd_systemCommunicateLanTelemetryAddress(scpi_t * context) {
+#if OPTION_ETHERNET
+    const char *ipAddressStr;
+    size_t ipAddressStrLength;
+    if (!SCPI_ParamCharacters(context, &ipAddressStr, &ipAddressStrLength, true)) {
+        return SCPI_RES_ERR;
+    }
+
+    uint32_t ipAddress;
+    if (!util::parseIpAddress(ipAddressStr, ipAddressStrLength, ipAddress)) {
+        SCPI_ErrorPush(context, SCPI_ERROR_ILLEGAL_PARAMETER_VALUE);
+        return SCPI_RES_ERR;
+    }
+
+    telemetry::setAddress(ipAddress);
+
+    return SCPI_RES_OK;
+#else
+    SCPI_ErrorPush(context, SCPI_ERROR_OPTION_NOT_INSTALLED);
+    return SCPI_RES_ERR;
+#endif
+}
+
+scpi_result_t scpi_cmd_systemCommunicateLanTelemetryAddressQ(scpi_t * context) {
+#if OPTION_ETHERNET
+    char ipAddressStr[16];
+    util::ipAddressToString(telemetry::getAddress(), ipAddressStr);
+    SCPI_ResultText(context, ipAddressStr);
+
+    return SCPI_RES_OK;
+#else
+    SCPI_ErrorPush(context, SCPI_ERROR_OPTION_NOT_INSTALLED);
+    return SCPI_RES_ERR;
+#endif
+}
+
+scpi_result_t scpi_cmd_systemCommunicateLanTelemetryPort(scpi_t * context) {
+#if OPTION_ETHERNET
+    int32_t port;
+    if (!SCPI_ParamInt(context, &port, TRUE)) {
+        return SCPI_RES_ERR;
+    }
+
+    if (port < 1 || port > 65535) {
+        SCPI_ErrorPush(context, SCPI_ERROR_DATA_OUT_OF_RANGE);
+        return SCPI_RES_ERR;
+    }
+
+    telemetry::setPort((uint16_t)port);
+
+    return SCPI_RES_OK;
+#else
+    SCPI_ErrorPush(context, SCPI_ERROR_OPTION_NOT_INSTALLED);
+    return SCPI_RES_ERR;
+#endif
+}
+
+scpi_result_t scpi_cmd_systemCommunicateLanTelemetryPortQ(scpi_t * context) {
+#if OPTION_ETHERNET
+    SCPI_ResultInt(context, telemetry::getPort());
+
+    return SCPI_RES_OK;
+#else
+    SCPI_ErrorPush(context, SCPI_ERROR_OPTION_NOT_INSTALLED);
+    return SCPI_RES_ERR;
+#endif
+}
+
+scpi_result_t scpi_cmd_systemCommunicateLanTelemetryRate(scpi_t * context) {
+#if OPTION_ETHERNET
+    int32_t rate;
+    if (!SCPI_ParamInt(context, &rate, TRUE)) {
+        return SCPI_RES_ERR;
+    }
+
+    if (rate < 1 || rate > TELEMETRY_MAX_RATE) {
+        SCPI_ErrorPush(context, SCPI_ERROR_DATA_OUT_OF_RANGE);
+        return SCPI_RES_ERR;
+    }
+
+    telemetry::setRate((uint16_t)rate);
+
+    return SCPI_RES_OK;
+#else
+    SCPI_ErrorPush(context, SCPI_ERROR_OPTION_NOT_INSTALLED);
+    return SCPI_RES_ERR;
+#endif
+}
+
+scpi_result_t scpi_cmd_systemCommunicateLanTelemetryRateQ(scpi_t * context) {
+#if OPTION_ETHERNET
+    SCPI_ResultInt(context, telemetry::getRate());
+
+    return SCPI_RES_OK;
+#else
+    SCPI_ErrorPush(context, SCPI_ERROR_OPTION_NOT_INSTALLED);
+    return SCPI_RES_ERR;
+#endif
+}
+
 }
 }
 } // namespace eez::psu::scpi
\ No newline at end of file
@@ -33,6 +33,10 @@ extern "C" {
 #define SCPI_MAX_ERROR_MESSAGE_SIZE 64
 #endif
 
+// Set to 1 to collect call count and execution time of every command (DEBUG:COMMand?).
+// Statistics take about 24 bytes of RAM per command, so don't enable it on AVR.
+#define USE_COMMAND_PROFILING 0
+
 #define USE_USER_ERROR_LIST 1
 #define LIST_OF_USER_ERRORS \
     X(SCPI_ERROR_HEADER_SUFFIX_OUTOFRANGE,                  -114, "Header suffix out of range")                   \
@@ -40,11 +44,14 @@ extern "C" {
     X(SCPI_ERROR_TRIGGER_IGNORED,                           -211, "Trigger ignored")                              \
     X(SCPI_ERROR_DATA_OUT_OF_RANGE,                         -222, "Data out of range")                            \
     X(SCPI_ERROR_TOO_MUCH_DATA,                             -223, "Too much data")                                \
+    X(SCPI_ERROR_OUT_OF_MEMORY_FOR_REQ_OP,                  -225, "Out of memory")                                \
     X(SCPI_ERROR_HARDWARE_ERROR,                            -240, "Hardware error")                               \
     X(SCPI_ERROR_CH1_FAULT_DETECTED,                        -242, "CH1 fault detected")                           \
 	X(SCPI_ERROR_CH2_FAULT_DETECTED,                        -243, "CH2 fault detected")                           \
     X(SCPI_ERROR_CH1_OUTPUT_FAULT_DETECTED,                 -245, "CH1 output fault detected")                    \
 	X(SCPI_ERROR_CH2_OUTPUT_FAULT_DETECTED,                 -246, "CH2 output fault detected")                    \
+    X(SCPI_ERROR_MACRO_RECURSION_ERROR,                     -276, "Macro recursion error")                        \
+    X(SCPI_ERROR_MACRO_HEADER_NOT_FOUND,                    -278, "Macro header not found")                       \
     X(SCPI_ERROR_CHANNEL_NOT_FOUND,                          100, "Channel not found")                            \
     X(SCPI_ERROR_CALIBRATION_STATE_IS_OFF,                   101, "Calibration state is off")                     \
     X(SCPI_ERROR_INVALID_CAL_PASSWORD,                       102, "Invalid cal password")                         \
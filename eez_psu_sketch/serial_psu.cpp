@@ -26,6 +26,16 @@ using namespace scpi;
 
 namespace serial {
 
+/// Number of bytes the receive ring buffer can hold. Ring buffer is filled by the
+/// UART interrupt handler of the Arduino core or, in the simulator, by the input thread.
+#if defined(SERIAL_BUFFER_SIZE)
+static const int RX_BUFFER_CAPACITY = SERIAL_BUFFER_SIZE - 1;
+#else
+static const int RX_BUFFER_CAPACITY = SERIAL_RX_BUFFER_SIZE - 1;
+#endif
+
+static Statistics g_statistics;
+
 size_t SCPI_Write(scpi_t *context, const char * data, size_t len) {
     return Serial.write(data, len);
 }
@@ -106,10 +116,42 @@ void init() {
 }
 
 void tick(uint32_t tick_usec) {
-    while (Serial.available()) {
-        char ch = (char)Serial.read();
-        input(scpi_context, ch);
+    int available = Serial.available();
+    if (available <= 0) {
+        return;
+    }
+
+    if (available > g_statistics.maxRxPending) {
+        g_statistics.maxRxPending = available;
+    }
+
+    if (available >= RX_BUFFER_CAPACITY) {
+        // UART ring buffer drops the bytes received while it is full
+        // (simulator input thread waits instead)
+        ++g_statistics.numRxOverruns;
     }
+
+    // Everything received since the last tick is moved straight
+    // into the SCPI input buffer and parsed in one call.
+    while (available > 0) {
+        size_t freeSize;
+        char *buffer = getInputBuffer(scpi_context, freeSize);
+
+        size_t size = (size_t)available < freeSize ? (size_t)available : freeSize;
+        size = Serial.readBytes(buffer, size);
+        if (size == 0) {
+            break;
+        }
+
+        g_statistics.rxBytes += size;
+        inputCommit(scpi_context, size);
+
+        available -= size;
+    }
+}
+
+const Statistics &getStatistics() {
+    return g_statistics;
 }
 
 }
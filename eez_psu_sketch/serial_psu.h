@@ -26,9 +26,19 @@ namespace serial {
 
 extern scpi_t scpi_context;
 
+struct Statistics {
+    uint32_t rxBytes;
+    /// Number of times the receive ring buffer was found full, i.e. received bytes were probably lost.
+    uint32_t numRxOverruns;
+    /// Largest number of bytes found waiting in the receive ring buffer.
+    uint16_t maxRxPending;
+};
+
 void init();
 void tick(uint32_t tick_usec);
 
+const Statistics &getStatistics();
+
 }
 }
 } // namespace eez::psu::serial
@@ -0,0 +1,193 @@
+/*
+ * EEZ PSU Firmware
+ * Copyright (C) 2018-present, Envox d.o.o.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "psu.h"
+
+#if OPTION_ETHERNET
+
+#if defined(EEZ_PSU_SIMULATOR) || EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R1B9
+#include <UIPEthernet.h>
+#include <UIPUdp.h>
+#elif EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R3B4 || EEZ_PSU_SELECTED_REVISION == EEZ_PSU_REVISION_R5B12
+#include <Ethernet2.h>
+#include <EthernetUdp2.h>
+#endif
+
+#include "ethernet.h"
+#include "channel_dispatcher.h"
+#include "list.h"
+#include "telemetry.h"
+
+namespace eez {
+namespace psu {
+namespace telemetry {
+
+static EthernetUDP g_udp;
+static bool g_udpStarted;
+
+static bool g_enabled;
+static uint32_t g_address;
+static uint16_t g_port = TELEMETRY_DEFAULT_PORT;
+static uint16_t g_rate = TELEMETRY_DEFAULT_RATE;
+
+static uint32_t g_sequence;
+static uint32_t g_lastSendTime;
+
+static Statistics g_statistics;
+
+////////////////////////////////////////////////////////////////////////////////
+
+static void fillDatagram(DatagramHeader &header, DatagramChannel *channels) {
+    header.magic = TELEMETRY_MAGIC;
+    header.version = TELEMETRY_VERSION;
+    header.numChannels = CH_NUM;
+    header.sequence = g_sequence;
+    header.timestamp = millis();
+
+    // all channels from the same measurement cycle
+    noInterrupts();
+
+    for (int i = 0; i < CH_NUM; ++i) {
+        Channel &channel = Channel::get(i);
+        DatagramChannel &datagramChannel = channels[i];
+
+        if (channel.isOk()) {
+            datagramChannel.u = channel_dispatcher::getUMon(channel);
+            datagramChannel.i = channel_dispatcher::getIMon(channel);
+            datagramChannel.p = datagramChannel.u * datagramChannel.i;
+        } else {
+            datagramChannel.u = 0;
+            datagramChannel.i = 0;
+            datagramChannel.p = 0;
+        }
+
+        datagramChannel.flags = channel.getStateFlags();
+        datagramChannel.reserved = 0;
+    }
+
+    interrupts();
+}
+
+static void send() {
+    struct {
+        DatagramHeader header;
+        DatagramChannel channels[CH_NUM];
+    } datagram;
+
+    fillDatagram(datagram.header, datagram.channels);
+
+    uint32_t start = micros();
+
+    SPI_beginTransaction(ETHERNET_SPI);
+    bool result = g_udp.beginPacket(IPAddress(g_address), g_port) &&
+        g_udp.write((const uint8_t *)&datagram, sizeof(datagram)) == sizeof(datagram) &&
+        g_udp.endPacket();
+    SPI_endTransaction();
+
+    uint32_t duration = micros() - start;
+    if (duration > g_statistics.maxSendDuration) {
+        g_statistics.maxSendDuration = duration;
+    }
+
+    ++g_sequence;
+    if (result) {
+        ++g_statistics.numSent;
+    } else {
+        ++g_statistics.numFailed;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+void tick(uint32_t tick_usec) {
+    if (!g_enabled || ethernet::g_testResult != psu::TEST_OK) {
+        return;
+    }
+
+    if (tick_usec - g_lastSendTime < 1000000L / g_rate) {
+        return;
+    }
+
+    // don't delay the next list point
+    if (list::isActive() && list::isPointDue(tick_usec, TELEMETRY_LIST_GUARD_TIME)) {
+        ++g_statistics.numDeferred;
+        return;
+    }
+
+    if (!g_udpStarted) {
+        SPI_beginTransaction(ETHERNET_SPI);
+        g_udpStarted = g_udp.begin(TELEMETRY_DEFAULT_PORT) ? true : false;
+        SPI_endTransaction();
+        if (!g_udpStarted) {
+            ++g_statistics.numFailed;
+            g_lastSendTime = tick_usec;
+            return;
+        }
+    }
+
+    send();
+
+    g_lastSendTime = tick_usec;
+}
+
+bool enable(bool enable) {
+    if (enable && (ethernet::g_testResult != psu::TEST_OK || g_address == 0)) {
+        return false;
+    }
+
+    g_enabled = enable;
+
+    return true;
+}
+
+bool isEnabled() {
+    return g_enabled;
+}
+
+void setAddress(uint32_t ipAddress) {
+    g_address = ipAddress;
+}
+
+uint32_t getAddress() {
+    return g_address;
+}
+
+void setPort(uint16_t port) {
+    g_port = port;
+}
+
+uint16_t getPort() {
+    return g_port;
+}
+
+void setRate(uint16_t rate) {
+    g_rate = rate;
+}
+
+uint16_t getRate() {
+    return g_rate;
+}
+
+const Statistics &getStatistics() {
+    return g_statistics;
+}
+
+}
+}
+} // namespace eez::psu::telemetry
+
+#endif
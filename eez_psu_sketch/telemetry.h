@@ -0,0 +1,79 @@
+/*
+ * EEZ PSU Firmware
+ * Copyright (C) 2018-present, Envox d.o.o.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#pragma once
+
+namespace eez {
+namespace psu {
+/// Periodic push of the measurements to the UDP host:port (SYSTem:COMMunicate:LAN:TELemetry).
+namespace telemetry {
+
+/// Telemetry datagram header. All fields are little endian.
+struct DatagramHeader {
+    /// Always TELEMETRY_MAGIC.
+    uint16_t magic;
+    uint8_t version;
+    uint8_t numChannels;
+    /// Incremented for every datagram, so receiver can detect lost datagrams.
+    uint32_t sequence;
+    /// Milliseconds since power up.
+    uint32_t timestamp;
+};
+
+/// Follows the DatagramHeader, once for every channel.
+struct DatagramChannel {
+    float u;
+    float i;
+    float p;
+    /// Combination of ChannelStateFlags.
+    uint16_t flags;
+    uint16_t reserved;
+};
+
+static const uint16_t TELEMETRY_MAGIC = 0xEE7E;
+static const uint8_t TELEMETRY_VERSION = 1;
+
+struct Statistics {
+    uint32_t numSent;
+    uint32_t numFailed;
+    /// Number of times sending was postponed because of the list execution.
+    uint32_t numDeferred;
+    /// Longest time (in microseconds) spent sending one datagram.
+    uint32_t maxSendDuration;
+};
+
+void tick(uint32_t tick_usec);
+
+bool enable(bool enable);
+bool isEnabled();
+
+/// IPv4 address (as returned by util::parseIpAddress) of the host receiving datagrams.
+void setAddress(uint32_t ipAddress);
+uint32_t getAddress();
+
+void setPort(uint16_t port);
+uint16_t getPort();
+
+/// Number of datagrams per second, from 1 to TELEMETRY_MAX_RATE.
+void setRate(uint16_t rate);
+uint16_t getRate();
+
+const Statistics &getStatistics();
+
+}
+}
+} // namespace eez::psu::telemetry
@@ -22,6 +22,8 @@
 #include "list.h"
 #include "profile.h"
 #include "persist_conf.h"
+#include "scheduler.h"
+#include "job_queue.h"
 
 namespace eez {
 namespace psu {
@@ -236,8 +238,7 @@ int startImmediately() {
                 list::executionStart(channel);
             } else {
                 if (channel.getVoltageTriggerMode() == TRIGGER_MODE_STEP) {
-                    channel_dispatcher::setVoltage(channel, g_levels[i].u);
-                    channel_dispatcher::setCurrent(channel, g_levels[i].i);
+                    channel_dispatcher::setVoltageAndCurrent(channel, g_levels[i].u, g_levels[i].i);
                 }
                 setTriggerFinished(channel);
             }
@@ -248,6 +249,9 @@ int startImmediately() {
 }
 
 int initiate() {
+    // lists loaded by the previously enqueued MMEM:LOAD:LIST are used
+    job_queue::waitChannelListWriters();
+
     if (persist_conf::devConf2.triggerSource == SOURCE_IMMEDIATE) {
         return startImmediately();
     } else {
@@ -286,6 +290,16 @@ void abort() {
     g_state = STATE_IDLE;
 }
 
+uint32_t getIdleTime(uint32_t tick_usec) {
+    if (g_state != STATE_TRIGGERED) {
+        return scheduler::IDLE_FOREVER;
+    }
+    // check() fires in the first millisecond after the delay
+    uint32_t fireTime = (g_triggeredTime + (uint32_t)(persist_conf::devConf2.triggerDelay * 1000L) + 1) * 1000;
+    int32_t diff = fireTime - tick_usec;
+    return diff > 0 ? diff : 0;
+}
+
 void tick(uint32_t tick_usec) {
     if (g_state == STATE_TRIGGERED) {
         check(tick_usec / 1000);
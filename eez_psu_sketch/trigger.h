@@ -63,6 +63,9 @@ int enableInitiateContinuous(bool enable);
 bool isContinuousInitializationEnabled();
 void setTriggerFinished(Channel &channel);
 bool isIdle();
+
+/// Time (in microseconds) until the trigger delay expires, see scheduler::TaskIdleFunction.
+uint32_t getIdleTime(uint32_t tick_usec);
 bool isInitiated();
 void abort();
 
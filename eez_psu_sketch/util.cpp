@@ -236,6 +236,59 @@ void getParentDir(const char *path, char *parentDirPath) {
     parentDirPath[i] = 0;
 }
 
+bool parseIpAddress(const char *ipAddressStr, size_t ipAddressStrLength, uint32_t &ipAddress) {
+    const char *p = ipAddressStr;
+    const char *q = ipAddressStr + ipAddressStrLength;
+
+    uint8_t ipAddressArray[4];
+
+    for (int i = 0; i < 4; ++i) {
+        if (p == q) {
+            return false;
+        }
+
+        uint32_t part = 0;
+        for (int j = 0; j < 3; ++j) {
+            if (p == q) {
+                if (j > 0 && i == 3) {
+                    break;
+                } else {
+                    return false;
+                }
+            } else if (isDigit(*p)) {
+                part = part * 10 + (*p++ - '0');
+            } else if (j > 0 && *p == '.') {
+                break;
+            } else {
+                return false;
+            }
+        }
+
+        if (part > 255) {
+            return false;
+        }
+
+        if (i < 3) {
+            if (p == q || *p++ != '.') {
+                return false;
+            }
+        } else if (p != q) {
+            return false;
+        }
+
+        ipAddressArray[i] = part;
+    }
+
+    memcpy(&ipAddress, ipAddressArray, 4);
+
+    return true;
+}
+
+void ipAddressToString(uint32_t ipAddress, char *ipAddressStr) {
+    uint8_t *bytes = (uint8_t *)&ipAddress;
+    sprintf_P(ipAddressStr, PSTR("%d.%d.%d.%d"), (int)bytes[0], (int)bytes[1], (int)bytes[2], (int)bytes[3]);
+}
+
 
 }
 }
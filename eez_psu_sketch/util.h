@@ -76,6 +76,10 @@ bool pointInsideRect(int xPoint, int yPoint, int xRect, int yRect, int wRect, in
 
 void getParentDir(const char *path, char *parentDirPath);
 
+/// Parse IPv4 address in dotted decimal notation. First octet is stored in the lowest byte.
+bool parseIpAddress(const char *ipAddressStr, size_t ipAddressStrLength, uint32_t &ipAddress);
+void ipAddressToString(uint32_t ipAddress, char *ipAddressStr);
+
 }
 }
 } // namespace eez::psu::util
@@ -122,6 +122,19 @@ static size_t writeSemicolon(scpi_t * context) {
     }
 }
 
+#if USE_COMMAND_PROFILING
+static void updateCommandProfile(scpi_command_profile_t * profile, uint32_t duration) {
+    if (profile->count == 0 || duration < profile->min_duration) {
+        profile->min_duration = duration;
+    }
+    if (duration > profile->max_duration) {
+        profile->max_duration = duration;
+    }
+    profile->total_duration += duration;
+    profile->count++;
+}
+#endif
+
 /**
  * Process command
  * @param context
@@ -130,6 +143,9 @@ static scpi_bool_t processCommand(scpi_t * context) {
     const scpi_command_t * cmd = context->param_list.cmd;
     lex_state_t * state = &context->param_list.lex_state;
     scpi_bool_t result = TRUE;
+#if USE_COMMAND_PROFILING
+    uint32_t start = SCPI_ProfileTime();
+#endif
 
     /* conditionaly write ; */
     writeSemicolon(context);
@@ -153,6 +169,12 @@ static scpi_bool_t processCommand(scpi_t * context) {
         }
     }
 
+#if USE_COMMAND_PROFILING
+    if (context->command_profile != NULL) {
+        updateCommandProfile(&context->command_profile[context->param_list.cmd_index], SCPI_ProfileTime() - start);
+    }
+#endif
+
     /* set error if command callback did not read all parameters */
     if (state->pos < (state->buffer + state->len) && !context->cmd_error) {
         SCPI_ErrorPush(context, SCPI_ERROR_PARAMETER_NOT_ALLOWED);
@@ -165,9 +187,10 @@ static scpi_bool_t processCommand(scpi_t * context) {
 /**
  * Cycle all patterns and search matching pattern. Execute command callback.
  * @param context
+ * @param index - if not NULL, index of the found command in the command list
  * @result TRUE if context->paramlist is filled with correct values
  */
-static scpi_bool_t findCommandHeader(scpi_t * context, const char * header, int len) {
+static scpi_bool_t findCommandHeader(scpi_t * context, const char * header, int len, int32_t * index) {
     int32_t i;
     
 #if USE_64K_PROGMEM_FOR_CMD_LIST
@@ -182,6 +205,9 @@ static scpi_bool_t findCommandHeader(scpi_t * context, const char * header, int
 #if USE_COMMAND_TAGS 
             context->param_list.cmd_s.tag = (int32_t)pgm_read_dword(&context->cmdlist[i].tag);
 #endif
+            if (index) {
+                *index = i;
+            }
             return TRUE;
         }
     }
@@ -204,6 +230,9 @@ static scpi_bool_t findCommandHeader(scpi_t * context, const char * header, int
 #if USE_COMMAND_TAGS 
             context->param_list.cmd_s.tag = (int32_t)pgm_read_dword_far(p_cmd + offsetof(scpi_command_t, tag));
 #endif
+            if (index) {
+                *index = i;
+            }
             return TRUE;
         }
     }
@@ -215,6 +244,9 @@ static scpi_bool_t findCommandHeader(scpi_t * context, const char * header, int
         cmd = &context->cmdlist[i];
         if (matchCommand(cmd->pattern, header, len, NULL, 0, 0)) {
             context->param_list.cmd = cmd;
+            if (index) {
+                *index = i;
+            }
             return TRUE;
         }
     }
@@ -223,6 +255,70 @@ static scpi_bool_t findCommandHeader(scpi_t * context, const char * header, int
     return FALSE;
 }
 
+/**
+ * Select command from the command list by its index (as returned by findCommandHeader)
+ * @param context
+ * @param index
+ * @result TRUE if context->paramlist is filled with correct values
+ */
+static scpi_bool_t selectCommand(scpi_t * context, int32_t index) {
+    int32_t i;
+
+#if USE_64K_PROGMEM_FOR_CMD_LIST
+    PGM_P pattern;
+
+    for (i = 0; i <= index; ++i) {
+        if ((pattern = (PGM_P)pgm_read_word(&context->cmdlist[i].pattern)) == 0) {
+            return FALSE;
+        }
+    }
+
+    strncpy_P(context->param_list.cmd_pattern_s, pattern, SCPI_MAX_CMD_PATTERN_SIZE);
+    context->param_list.cmd_pattern_s[SCPI_MAX_CMD_PATTERN_SIZE] = '\0';
+    context->param_list.cmd_s.callback = (scpi_command_callback_t)pgm_read_word(&context->cmdlist[index].callback);
+#if USE_COMMAND_TAGS 
+    context->param_list.cmd_s.tag = (int32_t)pgm_read_dword(&context->cmdlist[index].tag);
+#endif
+    return TRUE;
+
+#elif USE_FULL_PROGMEM_FOR_CMD_LIST
+    uint_farptr_t p_cmd = context->cmdlist;
+    uint_farptr_t p_pattern = context->cmdpatterns;
+    uint16_t pattern_length;
+
+    for (i = 0;
+         (pattern_length = pgm_read_word_far(p_cmd + offsetof(scpi_command_t, pattern))) != 0;
+         ++i, p_cmd += sizeof(scpi_command_t), p_pattern += pattern_length)
+    {
+        if (i == index) {
+            strncpy_PF(context->param_list.cmd_pattern_s, p_pattern, pattern_length);
+            context->param_list.cmd_pattern_s[pattern_length] = '\0';
+            context->param_list.cmd_s.callback = (scpi_command_callback_t)pgm_read_word_far(p_cmd + offsetof(scpi_command_t, callback));
+#if USE_COMMAND_TAGS 
+            context->param_list.cmd_s.tag = (int32_t)pgm_read_dword_far(p_cmd + offsetof(scpi_command_t, tag));
+#endif
+            return TRUE;
+        }
+    }
+
+    return FALSE;
+
+#else
+    for (i = 0; i < index; i++) {
+        if (context->cmdlist[i].pattern == NULL) {
+            return FALSE;
+        }
+    }
+
+    if (context->cmdlist[index].pattern == NULL) {
+        return FALSE;
+    }
+
+    context->param_list.cmd = &context->cmdlist[index];
+    return TRUE;
+#endif
+}
+
 /**
  * Parse one command line
  * @param context
@@ -235,6 +331,7 @@ scpi_bool_t SCPI_Parse(scpi_t * context, char * data, int len) {
     scpi_parser_state_t * state;
     int r;
     scpi_token_t cmd_prev = {SCPI_TOKEN_UNKNOWN, NULL, 0};
+    int32_t index;
 
     if (context == NULL) {
         return FALSE;
@@ -253,7 +350,10 @@ scpi_bool_t SCPI_Parse(scpi_t * context, char * data, int len) {
 
             composeCompoundCommand(&cmd_prev, &state->programHeader);
 
-            if (findCommandHeader(context, state->programHeader.ptr, state->programHeader.len)) {
+            if (findCommandHeader(context, state->programHeader.ptr, state->programHeader.len, &index)) {
+#if USE_COMMAND_PROFILING
+                context->param_list.cmd_index = index;
+#endif
 
                 context->param_list.lex_state.buffer = state->programData.ptr;
                 context->param_list.lex_state.pos = context->param_list.lex_state.buffer;
@@ -285,6 +385,129 @@ scpi_bool_t SCPI_Parse(scpi_t * context, char * data, int len) {
     return result;
 }
 
+/**
+ * Compile program message into the sequence of resolved program message units,
+ * which can be later executed with SCPI_ExecuteCompiled without parsing
+ * and searching the command list again.
+ *
+ * Each unit is stored as: command index (2 bytes), header length (1 byte),
+ * program data length (1 byte), full (compound) header and program data.
+ *
+ * @param context
+ * @param data - program message, it is modified during compilation
+ * @param len - program message length
+ * @param compiled - output buffer
+ * @param compiled_len - size of the output buffer
+ * @return length of the compiled data or 0 if error is pushed to the error queue
+ */
+size_t SCPI_Compile(scpi_t * context, char * data, int len, char * compiled, size_t compiled_len) {
+    scpi_parser_state_t state;
+    scpi_param_list_t param_list = context->param_list;
+    scpi_token_t cmd_prev = {SCPI_TOKEN_UNKNOWN, NULL, 0};
+    size_t pos = 0;
+    int16_t err = 0;
+    int32_t index;
+    int r;
+
+    while (len > 0) {
+        r = scpiParser_detectProgramMessageUnit(&state, data, len);
+
+        if (state.programHeader.type == SCPI_TOKEN_INVALID) {
+            err = SCPI_ERROR_INVALID_CHARACTER;
+            break;
+        } else if (state.programHeader.len > 0) {
+            composeCompoundCommand(&cmd_prev, &state.programHeader);
+
+            if (!findCommandHeader(context, state.programHeader.ptr, state.programHeader.len, &index)) {
+                err = SCPI_ERROR_UNDEFINED_HEADER;
+                break;
+            }
+
+            if (state.programHeader.len > 255 || state.programData.len > 255 ||
+                pos + 4 + state.programHeader.len + state.programData.len > compiled_len) {
+                err = SCPI_ERROR_TOO_MUCH_DATA;
+                break;
+            }
+
+            compiled[pos++] = (char) (index & 0xFF);
+            compiled[pos++] = (char) ((index >> 8) & 0xFF);
+            compiled[pos++] = (char) state.programHeader.len;
+            compiled[pos++] = (char) state.programData.len;
+            memcpy(compiled + pos, state.programHeader.ptr, state.programHeader.len);
+            pos += state.programHeader.len;
+            memcpy(compiled + pos, state.programData.ptr, state.programData.len);
+            pos += state.programData.len;
+
+            cmd_prev = state.programHeader;
+        }
+
+        if (r <= 0) {
+            break;
+        }
+
+        data += r;
+        len -= r;
+    }
+
+    context->param_list = param_list;
+
+    if (err) {
+        SCPI_ErrorPush(context, err);
+        return 0;
+    }
+
+    return pos;
+}
+
+/**
+ * Execute program message compiled with SCPI_Compile
+ * @param context
+ * @param compiled - compiled program message
+ * @param len - length of the compiled program message
+ * @return FALSE if there was some error during evaluation of commands
+ */
+scpi_bool_t SCPI_ExecuteCompiled(scpi_t * context, const char * compiled, size_t len) {
+    scpi_bool_t result = TRUE;
+    scpi_param_list_t param_list = context->param_list;
+    size_t pos = 0;
+    int32_t index;
+    size_t header_len;
+    size_t data_len;
+
+    while (pos + 4 <= len) {
+        index = (uint8_t) compiled[pos] | ((int32_t) (uint8_t) compiled[pos + 1] << 8);
+        header_len = (uint8_t) compiled[pos + 2];
+        data_len = (uint8_t) compiled[pos + 3];
+        pos += 4;
+
+        if (pos + header_len + data_len > len || !selectCommand(context, index)) {
+            SCPI_ErrorPush(context, SCPI_ERROR_SYSTEM_ERROR);
+            result = FALSE;
+            break;
+        }
+
+#if USE_COMMAND_PROFILING
+        context->param_list.cmd_index = index;
+#endif
+
+        context->param_list.cmd_raw.data = compiled + pos;
+        context->param_list.cmd_raw.position = 0;
+        context->param_list.cmd_raw.length = header_len;
+        pos += header_len;
+
+        context->param_list.lex_state.buffer = (char *) (compiled + pos);
+        context->param_list.lex_state.pos = context->param_list.lex_state.buffer;
+        context->param_list.lex_state.len = data_len;
+        pos += data_len;
+
+        result &= processCommand(context);
+    }
+
+    context->param_list = param_list;
+
+    return result;
+}
+
 /**
  * Initialize SCPI context structure
  * @param context
@@ -310,6 +533,7 @@ void SCPI_Init(scpi_t * context,
     context->buffer.data = input_buffer;
     context->buffer.length = input_buffer_length;
     context->buffer.position = 0;
+    context->result_byte_order = SCPI_FORMAT_NORMAL;
     SCPI_ErrorInit(context, error_queue_data, error_queue_size);
 
 #if USE_64K_PROGMEM_FOR_CMD_LIST || USE_FULL_PROGMEM_FOR_CMD_LIST 
@@ -329,14 +553,12 @@ void SCPI_Init(scpi_t * context,
  * @return
  */
 scpi_bool_t SCPI_Input(scpi_t * context, const char * data, int len) {
-    scpi_bool_t result = TRUE;
-    size_t totcmdlen = 0;
-    int cmdlen = 0;
-
     if (len == 0) {
+        scpi_bool_t result;
         context->buffer.data[context->buffer.position] = 0;
         result = SCPI_Parse(context, context->buffer.data, context->buffer.position);
         context->buffer.position = 0;
+        return result;
     } else {
         int buffer_free;
 
@@ -349,23 +571,52 @@ scpi_bool_t SCPI_Input(scpi_t * context, const char * data, int len) {
             return FALSE;
         }
         memcpy(&context->buffer.data[context->buffer.position], data, len);
-        context->buffer.position += len;
-        context->buffer.data[context->buffer.position] = 0;
 
+        return SCPI_InputCommit(context, len);
+    }
+}
 
-        while (1) {
-            cmdlen = scpiParser_detectProgramMessageUnit(&context->parser_state, context->buffer.data + totcmdlen, context->buffer.position - totcmdlen);
-            totcmdlen += cmdlen;
+/**
+ * Get the free space at the end of the input buffer. Caller can write received
+ * data there directly and then call SCPI_InputCommit, which avoids copying
+ * the data through intermediate buffer.
+ * @param context
+ * @param free_len - number of bytes that can be written
+ * @return pointer to the free space
+ */
+char * SCPI_InputBuffer(scpi_t * context, size_t * free_len) {
+    /* one byte is reserved for the terminating zero */
+    *free_len = context->buffer.length - context->buffer.position - 1;
+    return &context->buffer.data[context->buffer.position];
+}
 
-            if (context->parser_state.termination == SCPI_MESSAGE_TERMINATION_NL) {
-                result = SCPI_Parse(context, context->buffer.data, totcmdlen);
-                memmove(context->buffer.data, context->buffer.data + totcmdlen, context->buffer.position - totcmdlen);
-                context->buffer.position -= totcmdlen;
-                totcmdlen = 0;
-            } else {
-                if (context->parser_state.programHeader.type == SCPI_TOKEN_UNKNOWN) break;
-                if (totcmdlen >= context->buffer.position) break;
-            }
+/**
+ * Interface to the application. Parse data already written by the caller
+ * into the free space of the input buffer (see SCPI_InputBuffer).
+ * @param context
+ * @param len - number of bytes written
+ * @return
+ */
+scpi_bool_t SCPI_InputCommit(scpi_t * context, int len) {
+    scpi_bool_t result = TRUE;
+    size_t totcmdlen = 0;
+    int cmdlen = 0;
+
+    context->buffer.position += len;
+    context->buffer.data[context->buffer.position] = 0;
+
+    while (1) {
+        cmdlen = scpiParser_detectProgramMessageUnit(&context->parser_state, context->buffer.data + totcmdlen, context->buffer.position - totcmdlen);
+        totcmdlen += cmdlen;
+
+        if (context->parser_state.termination == SCPI_MESSAGE_TERMINATION_NL) {
+            result = SCPI_Parse(context, context->buffer.data, totcmdlen);
+            memmove(context->buffer.data, context->buffer.data + totcmdlen, context->buffer.position - totcmdlen);
+            context->buffer.position -= totcmdlen;
+            totcmdlen = 0;
+        } else {
+            if (context->parser_state.programHeader.type == SCPI_TOKEN_UNKNOWN) break;
+            if (totcmdlen >= context->buffer.position) break;
         }
     }
 
@@ -495,13 +746,29 @@ size_t SCPI_ResultUInt64Base(scpi_t * context, uint64_t val, int8_t base) {
     return resultUInt64BaseSign(context, val, base, FALSE);
 }
 
+static size_t parserResultArrayBinary(scpi_t * context, const void * array, size_t count, size_t item_size, scpi_array_format_t format);
+
 /**
- * Write float (32 bit) value to the result
+ * Set format of the float and double results (FORMat[:DATA] and FORMat:BORDer)
  * @param context
- * @param val
- * @return
+ * @param real TRUE for IEEE 754 binary (REAL,32), FALSE for ASCII
+ * @param byte_order SCPI_FORMAT_NORMAL or SCPI_FORMAT_SWAPPED
  */
-size_t SCPI_ResultFloat(scpi_t * context, float val) {
+void SCPI_SetResultFormat(scpi_t * context, scpi_bool_t real, scpi_array_format_t byte_order) {
+    context->result_real = real;
+    context->result_byte_order = byte_order;
+}
+
+/**
+ * Get format of the float and double results
+ * @param context
+ * @return SCPI_FORMAT_ASCII or byte order of the binary format
+ */
+scpi_array_format_t SCPI_GetResultFormat(scpi_t * context) {
+    return context->result_real ? context->result_byte_order : SCPI_FORMAT_ASCII;
+}
+
+static size_t resultFloatAscii(scpi_t * context, float val) {
     char buffer[32];
     size_t result = 0;
     size_t len = SCPI_FloatToStr(val, buffer, sizeof (buffer));
@@ -511,13 +778,7 @@ size_t SCPI_ResultFloat(scpi_t * context, float val) {
     return result;
 }
 
-/**
- * Write double (64bit) value to the result
- * @param context
- * @param val
- * @return
- */
-size_t SCPI_ResultDouble(scpi_t * context, double val) {
+static size_t resultDoubleAscii(scpi_t * context, double val) {
     char buffer[32];
     size_t result = 0;
     size_t len = SCPI_DoubleToStr(val, buffer, sizeof (buffer));
@@ -527,6 +788,35 @@ size_t SCPI_ResultDouble(scpi_t * context, double val) {
     return result;
 }
 
+/**
+ * Write float (32 bit) value to the result
+ * In REAL format value is written as definite length arbitrary block
+ * @param context
+ * @param val
+ * @return
+ */
+size_t SCPI_ResultFloat(scpi_t * context, float val) {
+    if (context->result_real) {
+        return parserResultArrayBinary(context, &val, 1, sizeof (val), context->result_byte_order);
+    }
+    return resultFloatAscii(context, val);
+}
+
+/**
+ * Write double (64bit) value to the result
+ * In REAL format value is written as 32 bit float definite length arbitrary block
+ * @param context
+ * @param val
+ * @return
+ */
+size_t SCPI_ResultDouble(scpi_t * context, double val) {
+    if (context->result_real) {
+        float fval = (float) val;
+        return parserResultArrayBinary(context, &fval, 1, sizeof (fval), context->result_byte_order);
+    }
+    return resultDoubleAscii(context, val);
+}
+
 /**
  * Write string withn " to the result
  * @param context
@@ -560,6 +850,7 @@ size_t SCPI_ResultText(scpi_t * context, const char * data) {
 size_t SCPI_ResultArbitraryBlockHeader(scpi_t * context, size_t len) {
     char block_header[12];
     size_t header_len;
+    size_t result = writeDelimiter(context);
     block_header[0] = '#';
     SCPI_UInt32ToStrBase((uint32_t) len, block_header + 2, 10, 10);
 
@@ -567,7 +858,7 @@ size_t SCPI_ResultArbitraryBlockHeader(scpi_t * context, size_t len) {
     block_header[1] = (char) (header_len + '0');
 
     context->arbitrary_reminding = len;
-    return writeData(context, block_header, header_len + 2);
+    return result + writeData(context, block_header, header_len + 2);
 }
 
 /**
@@ -1675,7 +1966,7 @@ size_t SCPI_ResultArrayUInt64(scpi_t * context, const uint64_t * array, size_t c
  * @return
  */
 size_t SCPI_ResultArrayFloat(scpi_t * context, const float * array, size_t count, scpi_array_format_t format) {
-    RESULT_ARRAY(SCPI_ResultFloat);
+    RESULT_ARRAY(resultFloatAscii);
 }
 
 /**
@@ -1687,5 +1978,5 @@ size_t SCPI_ResultArrayFloat(scpi_t * context, const float * array, size_t count
  * @return
  */
 size_t SCPI_ResultArrayDouble(scpi_t * context, const double * array, size_t count, scpi_array_format_t format) {
-    RESULT_ARRAY(SCPI_ResultDouble);
+    RESULT_ARRAY(resultDoubleAscii);
 }
@@ -96,6 +96,16 @@ extern "C" {
 #define USE_COMMAND_TAGS 1
 #endif
 
+/**
+ * Collect call count and execution time of every command
+ * 0 = No profiling
+ * 1 = Statistics are collected into scpi_t.command_profile (if not NULL),
+ *     time is measured with SCPI_ProfileTime implemented by the application
+ */
+#ifndef USE_COMMAND_PROFILING
+#define USE_COMMAND_PROFILING 0
+#endif
+
 #ifndef USE_64K_PROGMEM_FOR_CMD_LIST
 #define USE_64K_PROGMEM_FOR_CMD_LIST 0
 #endif
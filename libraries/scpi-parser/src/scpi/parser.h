@@ -52,7 +52,11 @@ extern "C" {
             int16_t * error_queue_data, int16_t error_queue_size);
 
     scpi_bool_t SCPI_Input(scpi_t * context, const char * data, int len);
+    char * SCPI_InputBuffer(scpi_t * context, size_t * free_len);
+    scpi_bool_t SCPI_InputCommit(scpi_t * context, int len);
     scpi_bool_t SCPI_Parse(scpi_t * context, char * data, int len);
+    size_t SCPI_Compile(scpi_t * context, char * data, int len, char * compiled, size_t compiled_len);
+    scpi_bool_t SCPI_ExecuteCompiled(scpi_t * context, const char * compiled, size_t len);
 
     size_t SCPI_ResultCharacters(scpi_t * context, const char * data, size_t len);
 #define SCPI_ResultMnemonic(context, data) SCPI_ResultCharacters((context), (data), strlen(data))
@@ -68,6 +72,8 @@ extern "C" {
     size_t SCPI_ResultUInt64Base(scpi_t * context, uint64_t val, int8_t base);
 #define SCPI_ResultUInt64(c, v) SCPI_ResultUInt64Base((c), (v), 10)
     size_t SCPI_ResultInt64(scpi_t * context, int64_t val);
+    void SCPI_SetResultFormat(scpi_t * context, scpi_bool_t real, scpi_array_format_t byte_order);
+    scpi_array_format_t SCPI_GetResultFormat(scpi_t * context);
     size_t SCPI_ResultFloat(scpi_t * context, float val);
     size_t SCPI_ResultDouble(scpi_t * context, double val);
     size_t SCPI_ResultText(scpi_t * context, const char * data);
@@ -117,6 +123,10 @@ extern "C" {
 #if USE_COMMAND_TAGS
     int32_t SCPI_CmdTag(scpi_t * context);
 #endif /* USE_COMMAND_TAGS */
+#if USE_COMMAND_PROFILING
+    /* time in microseconds, implemented by the application */
+    uint32_t SCPI_ProfileTime(void);
+#endif /* USE_COMMAND_PROFILING */
     scpi_bool_t SCPI_Match(const char * pattern, const char * value, size_t len);
     scpi_bool_t SCPI_CommandNumbers(scpi_t * context, int32_t * numbers, size_t len, int32_t default_value);
 
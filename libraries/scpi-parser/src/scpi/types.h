@@ -310,8 +310,21 @@ extern "C" {
 #endif /* USE_COMMAND_TAGS */
     };
 
+#if USE_COMMAND_PROFILING
+    struct _scpi_command_profile_t {
+        uint32_t count;
+        uint32_t min_duration;
+        uint32_t max_duration;
+        uint64_t total_duration;
+    };
+    typedef struct _scpi_command_profile_t scpi_command_profile_t;
+#endif /* USE_COMMAND_PROFILING */
+
     struct _scpi_param_list_t {
         const scpi_command_t * cmd;
+#if USE_COMMAND_PROFILING
+        int32_t cmd_index;
+#endif /* USE_COMMAND_PROFILING */
         lex_state_t lex_state;
         scpi_const_buffer_t cmd_raw;
 #if USE_64K_PROGMEM_FOR_CMD_LIST || USE_FULL_PROGMEM_FOR_CMD_LIST 
@@ -349,6 +362,15 @@ extern "C" {
         scpi_command_callback_t reset;
     };
 
+    enum _scpi_array_format_t {
+        SCPI_FORMAT_ASCII = 0,
+        SCPI_FORMAT_NORMAL = 1,
+        SCPI_FORMAT_SWAPPED = 2,
+        SCPI_FORMAT_BIGENDIAN = SCPI_FORMAT_NORMAL,
+        SCPI_FORMAT_LITTLEENDIAN = SCPI_FORMAT_SWAPPED,
+    };
+    typedef enum _scpi_array_format_t scpi_array_format_t;
+
     struct _scpi_t {
 #if USE_FULL_PROGMEM_FOR_CMD_LIST         
         uint_farptr_t cmdlist;
@@ -369,17 +391,14 @@ extern "C" {
         scpi_parser_state_t parser_state;
         const char * idn[4];
         size_t arbitrary_reminding;
+        scpi_bool_t result_real;
+        scpi_array_format_t result_byte_order;
+#if USE_COMMAND_PROFILING
+        /* one entry per command in the command list */
+        scpi_command_profile_t * command_profile;
+#endif /* USE_COMMAND_PROFILING */
     };
 
-    enum _scpi_array_format_t {
-        SCPI_FORMAT_ASCII = 0,
-        SCPI_FORMAT_NORMAL = 1,
-        SCPI_FORMAT_SWAPPED = 2,
-        SCPI_FORMAT_BIGENDIAN = SCPI_FORMAT_NORMAL,
-        SCPI_FORMAT_LITTLEENDIAN = SCPI_FORMAT_SWAPPED,
-    };
-    typedef enum _scpi_array_format_t scpi_array_format_t;
-
 #ifdef  __cplusplus
 }
 #endif
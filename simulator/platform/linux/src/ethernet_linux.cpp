@@ -25,13 +25,48 @@
 #include <sys/socket.h>
 #include <netinet/in.h>
 #include <fcntl.h>
+#include <sys/epoll.h>
 
 namespace eez {
 namespace psu {
 namespace ethernet_platform {
 
-static int listen_socket = -1;
-static int client_socket = -1;
+/// Size of the per client receive and transmit buffers.
+static const int RX_BUFFER_SIZE = 4096;
+static const int TX_BUFFER_SIZE = 4096;
+
+/// epoll user data of the listening sockets is LISTEN_SOCKET_TAG + server index,
+/// of the client sockets it is the client index.
+static const uint32_t LISTEN_SOCKET_TAG = MAX_CLIENTS;
+
+struct Client {
+    bool open;
+    int socket;
+    int server;
+
+    /// Received data not read yet is rx_buffer[rx_head .. rx_head + rx_size).
+    char rx_buffer[RX_BUFFER_SIZE];
+    int rx_head;
+    int rx_size;
+    /// Receive buffer was filled before the socket was drained.
+    /// Edge-triggered epoll will not report the remaining data again, so it must be read when there is room.
+    bool rx_more;
+    /// Peer closed the connection (or socket failed), client is stopped when all the buffered data is read.
+    bool eof;
+
+    /// Data written, but not sent yet.
+    char tx_buffer[TX_BUFFER_SIZE];
+    int tx_size;
+    /// Socket send buffer was full, waiting for EPOLLOUT.
+    bool tx_blocked;
+};
+
+static int epoll_fd = -1;
+static int listen_sockets[MAX_SERVERS] = { -1, -1 };
+/// There may be connections waiting in the listen queue.
+static bool accept_pending[MAX_SERVERS];
+static Client clients[MAX_CLIENTS];
+static int udp_socket = -1;
 
 bool enable_non_blocking(int fd) {
     int flags = fcntl(fd, F_GETFL, 0);
@@ -45,21 +80,169 @@ bool enable_non_blocking(int fd) {
     return true;
 }
 
-bool bind(int port) {
+static bool epoll_add(int fd, uint32_t events, uint32_t tag) {
+    epoll_event event;
+    event.events = events;
+    event.data.u32 = tag;
+    return epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) == 0;
+}
+
+static void set_tx_blocked(int client, bool tx_blocked) {
+    Client &c = clients[client];
+    if (c.tx_blocked == tx_blocked) {
+        return;
+    }
+
+    epoll_event event;
+    event.events = EPOLLIN | EPOLLRDHUP | EPOLLET | (tx_blocked ? EPOLLOUT : 0);
+    event.data.u32 = client;
+    epoll_ctl(epoll_fd, EPOLL_CTL_MOD, c.socket, &event);
+
+    c.tx_blocked = tx_blocked;
+}
+
+/// Read from the socket into the receive buffer until socket is drained or buffer is full.
+static void receive(int client) {
+    Client &c = clients[client];
+
+    if (c.rx_head > 0) {
+        memmove(c.rx_buffer, c.rx_buffer + c.rx_head, c.rx_size);
+        c.rx_head = 0;
+    }
+
+    while (c.rx_size < RX_BUFFER_SIZE) {
+        int n = ::recv(c.socket, c.rx_buffer + c.rx_size, RX_BUFFER_SIZE - c.rx_size, 0);
+        if (n > 0) {
+            c.rx_size += n;
+        } else if (n < 0 && errno == EINTR) {
+            continue;
+        } else {
+            if (n == 0 || (errno != EAGAIN && errno != EWOULDBLOCK)) {
+                c.eof = true;
+            }
+            c.rx_more = false;
+            return;
+        }
+    }
+
+    c.rx_more = true;
+}
+
+/// Send as much of the transmit buffer as the socket accepts.
+static void send_pending(int client) {
+    Client &c = clients[client];
+
+    int sent = 0;
+    while (sent < c.tx_size) {
+        int n = ::send(c.socket, c.tx_buffer + sent, c.tx_size - sent, MSG_NOSIGNAL);
+        if (n > 0) {
+            sent += n;
+        } else if (n < 0 && errno == EINTR) {
+            continue;
+        } else {
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                set_tx_blocked(client, true);
+            } else {
+                DebugTraceF("ETHERNET: send failed with error %d", errno);
+                c.eof = true;
+                sent = c.tx_size;
+            }
+            break;
+        }
+    }
+
+    if (sent > 0) {
+        c.tx_size -= sent;
+        memmove(c.tx_buffer, c.tx_buffer + sent, c.tx_size);
+    }
+
+    if (c.tx_size == 0) {
+        set_tx_blocked(client, false);
+    }
+}
+
+/// Handle all the socket events since the last poll, without waiting.
+static void poll() {
+    if (epoll_fd == -1) {
+        return;
+    }
+
+    epoll_event events[MAX_SERVERS + MAX_CLIENTS];
+    int n = epoll_wait(epoll_fd, events, MAX_SERVERS + MAX_CLIENTS, 0);
+
+    for (int i = 0; i < n; ++i) {
+        uint32_t tag = events[i].data.u32;
+
+        if (tag >= LISTEN_SOCKET_TAG) {
+            accept_pending[tag - LISTEN_SOCKET_TAG] = true;
+            continue;
+        }
+
+        int client = (int)tag;
+        if (!clients[client].open) {
+            continue;
+        }
+
+        if (events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+            receive(client);
+        }
+
+        if (events[i].events & EPOLLOUT) {
+            send_pending(client);
+        }
+    }
+
+    // data written without the terminating line feed is sent here
+    for (int client = 0; client < MAX_CLIENTS; ++client) {
+        Client &c = clients[client];
+        if (c.open && c.tx_size > 0 && !c.tx_blocked) {
+            send_pending(client);
+        }
+    }
+}
+
+int get_event_fd() {
+    return epoll_fd;
+}
+
+int bind(int port) {
+    int server;
+    for (server = 0; server < MAX_SERVERS; ++server) {
+        if (listen_sockets[server] == -1) {
+            break;
+        }
+    }
+    if (server == MAX_SERVERS) {
+        DebugTrace("EHTERNET: too many servers");
+        return -1;
+    }
+
+    if (epoll_fd == -1) {
+        epoll_fd = epoll_create1(0);
+        if (epoll_fd < 0) {
+            DebugTraceF("EHTERNET: epoll_create1 failed with error %d", errno);
+            epoll_fd = -1;
+            return -1;
+        }
+    }
+
     sockaddr_in serv_addr;
-    listen_socket = socket(AF_INET, SOCK_STREAM, 0);
+    int listen_socket = socket(AF_INET, SOCK_STREAM, 0);
     if (listen_socket < 0) {
         DebugTraceF("EHTERNET: socket failed with error %d", errno);
-        return false;
+        return -1;
     }
 
     if (!enable_non_blocking(listen_socket)) {
         DebugTraceF("EHTERNET: ioctl on listen socket failed with error %d", errno);
         close(listen_socket);
-        listen_socket = -1;
-        return false;
+        return -1;
     }
 
+    // allow immediate restart of the simulator
+    int reuse = 1;
+    setsockopt(listen_socket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
     bzero((char *)&serv_addr, sizeof(serv_addr));
     serv_addr.sin_family = AF_INET;
     serv_addr.sin_addr.s_addr = INADDR_ANY;
@@ -67,109 +250,230 @@ bool bind(int port) {
     if (::bind(listen_socket, (sockaddr *)&serv_addr, sizeof(serv_addr)) < 0) {
         DebugTraceF("EHTERNET: bind failed with error %d", errno);
         close(listen_socket);
-        listen_socket = -1;
-        return false;
+        return -1;
     }
 
-    if (listen(listen_socket, 5) < 0) {
+    if (listen(listen_socket, SOMAXCONN) < 0) {
         DebugTraceF("EHTERNET: listen failed with error %d", errno);
         close(listen_socket);
-        listen_socket = -1;
-        return false;
+        return -1;
     }
 
-    return true;
-}
+    if (!epoll_add(listen_socket, EPOLLIN | EPOLLET, LISTEN_SOCKET_TAG + server)) {
+        DebugTraceF("EHTERNET: epoll_ctl on listen socket failed with error %d", errno);
+        close(listen_socket);
+        return -1;
+    }
+
+    listen_sockets[server] = listen_socket;
+    // connections could be queued before the socket was added to epoll
+    accept_pending[server] = true;
 
-bool client_available() {
-    if (connected()) return true;
+    return server;
+}
 
+int accept_client(int server) {
+    int listen_socket = listen_sockets[server];
     if (listen_socket == -1) {
-        return 0;
+        return -1;
+    }
+
+    poll();
+
+    if (!accept_pending[server]) {
+        return -1;
+    }
+
+    int client;
+    for (client = 0; client < MAX_CLIENTS; ++client) {
+        if (!clients[client].open) {
+            break;
+        }
+    }
+    if (client == MAX_CLIENTS) {
+        // no free slot, leave connection pending
+        return -1;
     }
 
     sockaddr_in cli_addr;
     socklen_t clilen = sizeof(cli_addr);
-    client_socket = accept(listen_socket, (sockaddr *)&cli_addr, &clilen);
+    int client_socket = accept(listen_socket, (sockaddr *)&cli_addr, &clilen);
     if (client_socket < 0) {
-        if (errno == EWOULDBLOCK) {
-            return false;
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            // listen queue is drained, wait for the next epoll event
+            accept_pending[server] = false;
+            return -1;
         }
 
         DebugTraceF("EHTERNET: accept failed with error %d", errno);
         close(listen_socket);
-        listen_socket = -1;
-        return false;
+        listen_sockets[server] = -1;
+        return -1;
     }
 
     if (!enable_non_blocking(client_socket)) {
         DebugTraceF("EHTERNET: ioctl on client socket failed with error %d", errno);
         close(client_socket);
-        listen_socket = -1;
-        return false;
+        return -1;
     }
 
-    return true;
+    if (!epoll_add(client_socket, EPOLLIN | EPOLLRDHUP | EPOLLET, client)) {
+        DebugTraceF("EHTERNET: epoll_ctl on client socket failed with error %d", errno);
+        close(client_socket);
+        return -1;
+    }
+
+    Client &c = clients[client];
+    c.open = true;
+    c.socket = client_socket;
+    c.server = server;
+    c.rx_head = 0;
+    c.rx_size = 0;
+    c.rx_more = false;
+    c.eof = false;
+    c.tx_size = 0;
+    c.tx_blocked = false;
+
+    // data could arrive before the socket was added to epoll
+    receive(client);
+
+    return client;
+}
+
+bool connected(int client) {
+    return clients[client].open;
 }
 
-bool connected() {
-    return client_socket != -1;
+int get_client_server(int client) {
+    return clients[client].server;
 }
 
-int available() {
-    if (client_socket == -1) return 0;
+int available(int client) {
+    Client &c = clients[client];
+    if (!c.open) return 0;
 
-    char x;
-    int iResult = ::recv(client_socket, &x, 1, MSG_PEEK);
-    if (iResult > 0) {
-        return iResult;
+    if (c.rx_size == 0) {
+        poll();
     }
 
-    if (iResult < 0 && errno == EWOULDBLOCK) {
-        return 0;
+    if (c.rx_size > 0) {
+        return c.rx_size;
     }
 
-    stop();
+    if (c.eof) {
+        stop(client);
+    }
 
     return 0;
 }
 
-int read(char *buffer, int buffer_size) {
-    int n = ::read(client_socket, buffer, buffer_size);
-    if (n > 0) {
-        return n;
-    }
+int read(int client, char *buffer, int buffer_size) {
+    Client &c = clients[client];
+    if (!c.open) return 0;
 
-    if (n < 0 && errno == EWOULDBLOCK) {
-        return 0;
+    int n = c.rx_size < buffer_size ? c.rx_size : buffer_size;
+    memcpy(buffer, c.rx_buffer + c.rx_head, n);
+    c.rx_head += n;
+    c.rx_size -= n;
+
+    if (c.rx_size == 0) {
+        c.rx_head = 0;
+        if (c.rx_more) {
+            receive(client);
+        }
     }
 
-    stop();
+    if (n == 0 && c.eof) {
+        stop(client);
+    }
 
-    return 0;
+    return n;
 }
 
-int write(const char *buffer, int buffer_size) {
-    if (client_socket != -1) {
-        int n = ::write(client_socket, buffer, buffer_size);
-        if (n < 0) {
-            close(client_socket);
-            client_socket = -1;
-            return 0;
-        }
-        return n;
+int write(int client, const char *buffer, int buffer_size) {
+    Client &c = clients[client];
+    if (!c.open || c.eof) return 0;
+
+    if (c.tx_size + buffer_size > TX_BUFFER_SIZE) {
+        send_pending(client);
     }
 
-    return 0;
+    int n = TX_BUFFER_SIZE - c.tx_size;
+    if (n > buffer_size) {
+        n = buffer_size;
+    }
+    memcpy(c.tx_buffer + c.tx_size, buffer, n);
+    c.tx_size += n;
+
+    // Writes are combined until the end of the response message,
+    // the rest is sent by the next poll.
+    if (n > 0 && buffer[n - 1] == '\n' && !c.tx_blocked) {
+        send_pending(client);
+    }
+
+    return n;
 }
 
-void stop() {    
-    int result = shutdown(client_socket, SHUT_WR);
+void stop(int client) {
+    Client &c = clients[client];
+    if (!c.open) return;
+
+    if (c.tx_size > 0 && !c.eof) {
+        send_pending(client);
+    }
+
+    int result = shutdown(c.socket, SHUT_WR);
     if (result < 0) {
         DebugTraceF("ETHERNET shutdown failed with error %d\n", errno);
     }
-    close(client_socket);
-    client_socket = -1;
+
+    // closing the socket also removes it from the epoll
+    close(c.socket);
+    c.open = false;
+}
+
+bool udp_begin() {
+    if (udp_socket != -1) {
+        return true;
+    }
+
+    udp_socket = socket(AF_INET, SOCK_DGRAM, 0);
+    if (udp_socket < 0) {
+        DebugTraceF("EHTERNET: UDP socket failed with error %d", errno);
+        udp_socket = -1;
+        return false;
+    }
+
+    if (!enable_non_blocking(udp_socket)) {
+        DebugTraceF("EHTERNET: ioctl on UDP socket failed with error %d", errno);
+        close(udp_socket);
+        udp_socket = -1;
+        return false;
+    }
+
+    return true;
+}
+
+int udp_send(uint32_t ip_address, int port, const char *buffer, int buffer_size) {
+    if (udp_socket == -1) return 0;
+
+    sockaddr_in addr;
+    bzero((char *)&addr, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = ip_address;
+    addr.sin_port = htons(port);
+
+    int n = sendto(udp_socket, buffer, buffer_size, 0, (sockaddr *)&addr, sizeof(addr));
+    if (n < 0) {
+        return 0;
+    }
+    return n;
+}
+
+void udp_stop() {
+    if (udp_socket == -1) return;
+    close(udp_socket);
+    udp_socket = -1;
 }
 
 }
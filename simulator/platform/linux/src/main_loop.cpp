@@ -17,69 +17,161 @@
  */
 
 #include "psu.h"
-#include "serial_psu.h"
 #include "main_loop.h"
+#include "ethernet_platform.h"
 
 #include <errno.h>
-#include "thread_queue.h"
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
 
 using namespace eez::psu;
 
-#define NEW_INPUT_MESSAGE 1
-#define QUIT_MESSAGE      2
+/// epoll user data of the file descriptors main loop waits on.
+#define TIMER_EVENT       0
+#define WAKEUP_EVENT      1
+#define ETHERNET_EVENT    2
 
-threadqueue queue;
+static int epoll_fd = -1;
+/// Expires when the idle time returned by simulator::getIdleTime elapses.
+static int timer_fd = -1;
+/// Signaled by the input thread when new data is put in the Serial receive ring buffer.
+static int wakeup_fd = -1;
+/// Ethernet sockets epoll descriptor, if it is added to epoll_fd.
+static int ethernet_fd = -1;
 
+static volatile bool quit;
+
+static void wakeup() {
+    uint64_t value = 1;
+    ::write(wakeup_fd, &value, sizeof(value));
+}
+
+/// Moves data from the stdin to the Serial receive ring buffer.
 void *input_thread(void *) {
+    char buffer[256];
     while (1) {
-        int ch = getchar();
-        if (ch == EOF) break;
-
-        thread_queue_add(&queue, new char(ch), NEW_INPUT_MESSAGE);
+        int n = ::read(0, buffer, sizeof(buffer));
+        if (n <= 0) break;
+
+        int i = 0;
+        while (i < n) {
+            i += Serial.put(buffer + i, n - i);
+            wakeup();
+            if (i < n) {
+                // ring buffer is full, wait for the main thread to consume some data
+                usleep(1000);
+            }
+        }
     }
 
-    thread_queue_add(&queue, 0, QUIT_MESSAGE);
+    quit = true;
+    wakeup();
 
     return 0;
 }
 
+static bool epoll_add(int fd, uint32_t tag) {
+    epoll_event event;
+    event.events = EPOLLIN;
+    event.data.u32 = tag;
+    return epoll_ctl(epoll_fd, EPOLL_CTL_ADD, fd, &event) == 0;
+}
 
-int main_loop() {
-    timespec timeout = { 0, TICK_TIMEOUT * 1000 * 1000 };
+/// Socket activity wakes up the main loop only if not in the fixed tick rate mode.
+/// Ethernet sockets are created on the first bind, so this is checked before every wait.
+static void update_ethernet_fd() {
+    int fd = simulator::isFixedTickRateEnabled() ? -1 : ethernet_platform::get_event_fd();
+    if (fd == ethernet_fd) {
+        return;
+    }
 
-    if (thread_queue_init(&queue) != 0) return -1;
+    if (ethernet_fd != -1) {
+        epoll_ctl(epoll_fd, EPOLL_CTL_DEL, ethernet_fd, 0);
+    }
 
-    pthread_t thread;
-    pthread_create(&thread, 0, input_thread, 0);
+    if (fd != -1 && !epoll_add(fd, ETHERNET_EVENT)) {
+        fd = -1;
+    }
+
+    ethernet_fd = fd;
+}
+
+/// Wait until the idle time (in microseconds) elapses or,
+/// if not in the fixed tick rate mode, until some input arrives.
+/// Returns false if main loop should quit.
+static bool wait(uint32_t idle_time) {
+    update_ethernet_fd();
+
+    int timeout = 0;
+    if (idle_time > 0) {
+        itimerspec spec;
+        memset(&spec, 0, sizeof(spec));
+        spec.it_value.tv_sec = idle_time / 1000000;
+        spec.it_value.tv_nsec = (idle_time % 1000000) * 1000;
+        if (timerfd_settime(timer_fd, 0, &spec, 0) < 0) {
+            return false;
+        }
+        timeout = -1;
+    }
 
     while (1) {
-        threadmsg msg;
-        char *p_ch;
-        int ret;
-        switch (ret = thread_queue_get(&queue, &timeout, &msg)) {
-        case 0:
-            switch (msg.msgtype) {
-            case NEW_INPUT_MESSAGE:
-                p_ch = (char *)msg.data;
-                scpi::input(serial::scpi_context, *p_ch);
-                delete p_ch;
-                break;
-
-            case QUIT_MESSAGE:
-                return 0;
+        epoll_event events[3];
+        int n = epoll_wait(epoll_fd, events, 3, timeout);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
             }
-            break;
+            return false;
+        }
 
-        case ETIMEDOUT:
-            simulator::tick();
-            break;
+        bool expired = n == 0;
 
-        default:
-            return ret;
+        for (int i = 0; i < n; ++i) {
+            uint64_t value;
+            if (events[i].data.u32 == TIMER_EVENT) {
+                ::read(timer_fd, &value, sizeof(value));
+                expired = true;
+            } else if (events[i].data.u32 == WAKEUP_EVENT) {
+                ::read(wakeup_fd, &value, sizeof(value));
+            }
+            // ethernet events are handled by the ethernet_platform in the next tick
+        }
+
+        if (quit) {
+            return false;
+        }
+
+        if (expired || (n > 0 && !simulator::isFixedTickRateEnabled())) {
+            return true;
         }
     }
 }
 
+int main_loop() {
+    epoll_fd = epoll_create1(0);
+    timer_fd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK);
+    wakeup_fd = eventfd(0, EFD_NONBLOCK);
+    if (epoll_fd < 0 || timer_fd < 0 || wakeup_fd < 0) {
+        return -1;
+    }
+
+    if (!epoll_add(timer_fd, TIMER_EVENT) || !epoll_add(wakeup_fd, WAKEUP_EVENT)) {
+        return -1;
+    }
+
+    pthread_t thread;
+    pthread_create(&thread, 0, input_thread, 0);
+
+    while (wait(simulator::getIdleTime())) {
+        simulator::tick();
+    }
+
+    return 0;
+}
+
 void main_loop_exit() {
     ::exit(0);
 }
\ No newline at end of file
@@ -37,10 +37,28 @@ namespace eez {
 namespace psu {
 namespace ethernet_platform {
 
-static SOCKET listen_socket = INVALID_SOCKET;
-static SOCKET client_socket = INVALID_SOCKET;
+static SOCKET listen_sockets[MAX_SERVERS] = { INVALID_SOCKET, INVALID_SOCKET };
+static SOCKET client_sockets[MAX_CLIENTS] = {
+    INVALID_SOCKET, INVALID_SOCKET, INVALID_SOCKET, INVALID_SOCKET,
+    INVALID_SOCKET, INVALID_SOCKET, INVALID_SOCKET, INVALID_SOCKET,
+    INVALID_SOCKET, INVALID_SOCKET, INVALID_SOCKET, INVALID_SOCKET,
+    INVALID_SOCKET, INVALID_SOCKET, INVALID_SOCKET, INVALID_SOCKET
+};
+static int client_servers[MAX_CLIENTS];
+static SOCKET udp_socket = INVALID_SOCKET;
+
+int bind(int port) {
+    int server;
+    for (server = 0; server < MAX_SERVERS; ++server) {
+        if (listen_sockets[server] == INVALID_SOCKET) {
+            break;
+        }
+    }
+    if (server == MAX_SERVERS) {
+        DebugTrace("EHTERNET: too many servers\n");
+        return -1;
+    }
 
-bool bind(int port) {
     WSADATA wsaData;
     int iResult;
 
@@ -51,7 +69,7 @@ bool bind(int port) {
     iResult = WSAStartup(MAKEWORD(2, 2), &wsaData);
     if (iResult != 0) {
         DebugTraceF("EHTERNET: WSAStartup failed with error %d\n", iResult);
-        return false;
+        return -1;
     }
 
     ZeroMemory(&hints, sizeof(hints));
@@ -66,15 +84,15 @@ bool bind(int port) {
     iResult = getaddrinfo(NULL, port_str, &hints, &result);
     if (iResult != 0) {
         DebugTraceF("EHTERNET: getaddrinfo failed with error %d\n", iResult);
-        return false;
+        return -1;
     }
 
     // Create a SOCKET for connecting to server
-    listen_socket = socket(result->ai_family, result->ai_socktype, result->ai_protocol);
+    SOCKET listen_socket = socket(result->ai_family, result->ai_socktype, result->ai_protocol);
     if (listen_socket == INVALID_SOCKET) {
         DebugTraceF("EHTERNET: socket failed with error %ld\n", WSAGetLastError());
         freeaddrinfo(result);
-        return false;
+        return -1;
     }
 
     u_long iMode = 1;
@@ -83,8 +101,7 @@ bool bind(int port) {
         DebugTraceF("EHTERNET: ioctlsocket failed with error %ld\n", iResult);
         freeaddrinfo(result);
         closesocket(listen_socket);
-        listen_socket = INVALID_SOCKET;
-        return false;
+        return -1;
     }
 
     // Setup the TCP listening socket
@@ -93,8 +110,7 @@ bool bind(int port) {
         DebugTraceF("EHTERNET: bind failed with error %d\n", WSAGetLastError());
         freeaddrinfo(result);
         closesocket(listen_socket);
-        listen_socket = INVALID_SOCKET;
-        return false;
+        return -1;
     }
 
     freeaddrinfo(result);
@@ -103,45 +119,69 @@ bool bind(int port) {
     if (iResult == SOCKET_ERROR) {
         DebugTraceF("EHTERNET listen failed with error %d\n", WSAGetLastError());
         closesocket(listen_socket);
-        listen_socket = INVALID_SOCKET;
-        return false;
+        return -1;
     }
 
-    return true;
-}
+    listen_sockets[server] = listen_socket;
 
-bool client_available() {
-    if (connected()) return true;
+    return server;
+}
 
+int accept_client(int server) {
+    SOCKET listen_socket = listen_sockets[server];
     if (listen_socket == INVALID_SOCKET) {
-        return false;
+        return -1;
+    }
+
+    int client;
+    for (client = 0; client < MAX_CLIENTS; ++client) {
+        if (client_sockets[client] == INVALID_SOCKET) {
+            break;
+        }
+    }
+    if (client == MAX_CLIENTS) {
+        // no free slot, leave connection pending
+        return -1;
     }
 
     // Accept a client socket
-    client_socket = accept(listen_socket, NULL, NULL);
+    SOCKET client_socket = accept(listen_socket, NULL, NULL);
     if (client_socket == INVALID_SOCKET) {
         if (WSAGetLastError() == WSAEWOULDBLOCK) {
-            return false;
+            return -1;
         }
 
         DebugTraceF("EHTERNET accept failed with error %d\n", WSAGetLastError());
         closesocket(listen_socket);
-        listen_socket = INVALID_SOCKET;
-        return false;
+        listen_sockets[server] = INVALID_SOCKET;
+        return -1;
     }
 
-    return true;
+    client_sockets[client] = client_socket;
+    client_servers[client] = server;
+
+    return client;
+}
+
+bool connected(int client) {
+    return client_sockets[client] != INVALID_SOCKET;
 }
 
-bool connected() {
-    return client_socket != INVALID_SOCKET;
+int get_client_server(int client) {
+    return client_servers[client];
 }
 
-int available() {
-    if (client_socket == INVALID_SOCKET) return 0;
+int available(int client) {
+    if (client_sockets[client] == INVALID_SOCKET) return 0;
+
+    // report all the pending bytes, so they can be read at once
+    u_long count;
+    if (ioctlsocket(client_sockets[client], FIONREAD, &count) == 0 && count > 0) {
+        return (int)count;
+    }
 
     char x;
-    int iResult = ::recv(client_socket, &x, 1, MSG_PEEK);
+    int iResult = ::recv(client_sockets[client], &x, 1, MSG_PEEK);
     if (iResult > 0) {
         return iResult;
     }
@@ -150,13 +190,15 @@ int available() {
         return 0;
     }
 
-    stop();
+    stop(client);
 
     return 0;
 }
 
-int read(char *buffer, int buffer_size) {
-    int iResult = ::recv(client_socket, buffer, buffer_size, 0);
+int read(int client, char *buffer, int buffer_size) {
+    if (client_sockets[client] == INVALID_SOCKET) return 0;
+
+    int iResult = ::recv(client_sockets[client], buffer, buffer_size, 0);
     if (iResult > 0) {
         return iResult;
     }
@@ -165,21 +207,20 @@ int read(char *buffer, int buffer_size) {
         return 0;
     }
 
-    stop();
+    stop(client);
 
     return 0;
 }
 
-int write(const char *buffer, int buffer_size) {
+int write(int client, const char *buffer, int buffer_size) {
     int iSendResult;
 
-    if (client_socket != INVALID_SOCKET) {
-        // Echo the buffer back to the sender
-        iSendResult = ::send(client_socket, buffer, buffer_size, 0);
+    if (client_sockets[client] != INVALID_SOCKET) {
+        iSendResult = ::send(client_sockets[client], buffer, buffer_size, 0);
         if (iSendResult == SOCKET_ERROR) {
             DebugTraceF("send failed with error: %d\n", WSAGetLastError());
-            closesocket(client_socket);
-            client_socket = INVALID_SOCKET;
+            closesocket(client_sockets[client]);
+            client_sockets[client] = INVALID_SOCKET;
             return 0;
         }
         return iSendResult;
@@ -188,14 +229,60 @@ int write(const char *buffer, int buffer_size) {
     return 0;
 }
 
-void stop() {
-    if (client_socket != INVALID_SOCKET) {
-        int iResult = shutdown(client_socket, SD_SEND);
+void stop(int client) {
+    if (client_sockets[client] != INVALID_SOCKET) {
+        int iResult = shutdown(client_sockets[client], SD_SEND);
         if (iResult == SOCKET_ERROR) {
             DebugTraceF("EHTERNET shutdown failed with error %d\n", WSAGetLastError());
         }
-        closesocket(client_socket);
-        client_socket = INVALID_SOCKET;
+        closesocket(client_sockets[client]);
+        client_sockets[client] = INVALID_SOCKET;
+    }
+}
+
+bool udp_begin() {
+    if (udp_socket != INVALID_SOCKET) {
+        return true;
+    }
+
+    udp_socket = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (udp_socket == INVALID_SOCKET) {
+        DebugTraceF("EHTERNET: UDP socket failed with error %ld\n", WSAGetLastError());
+        return false;
+    }
+
+    u_long iMode = 1;
+    int iResult = ioctlsocket(udp_socket, FIONBIO, &iMode);
+    if (iResult != NO_ERROR) {
+        DebugTraceF("EHTERNET: ioctlsocket failed with error %ld\n", iResult);
+        closesocket(udp_socket);
+        udp_socket = INVALID_SOCKET;
+        return false;
+    }
+
+    return true;
+}
+
+int udp_send(uint32_t ip_address, int port, const char *buffer, int buffer_size) {
+    if (udp_socket == INVALID_SOCKET) return 0;
+
+    sockaddr_in addr;
+    ZeroMemory(&addr, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = ip_address;
+    addr.sin_port = htons(port);
+
+    int iResult = sendto(udp_socket, buffer, buffer_size, 0, (sockaddr *)&addr, sizeof(addr));
+    if (iResult == SOCKET_ERROR) {
+        return 0;
+    }
+    return iResult;
+}
+
+void udp_stop() {
+    if (udp_socket != INVALID_SOCKET) {
+        closesocket(udp_socket);
+        udp_socket = INVALID_SOCKET;
     }
 }
 
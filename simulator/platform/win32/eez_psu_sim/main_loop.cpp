@@ -27,16 +27,28 @@
 
 using namespace eez::psu;
 
-#define NEW_INPUT_MESSAGE WM_USER
-
 static DWORD main_thread_id;
 
+/// Posted by the input thread when new data is put in the Serial receive ring buffer.
+#define WM_SERIAL_DATA (WM_APP + 1)
+
+/// Moves data from the stdin to the Serial receive ring buffer.
 DWORD WINAPI input_thread_proc(_In_ LPVOID lpParameter) {
+    HANDLE stdin_handle = GetStdHandle(STD_INPUT_HANDLE);
+    char buffer[256];
     while (1) {
-        int ch = getchar();
-        if (ch == EOF) break;
-
-        PostThreadMessage(main_thread_id, NEW_INPUT_MESSAGE, ch, 0);
+        DWORD n;
+        if (!ReadFile(stdin_handle, buffer, sizeof(buffer), &n, 0) || n == 0) break;
+
+        DWORD i = 0;
+        while (i < n) {
+            i += Serial.put(buffer + i, n - i);
+            PostThreadMessage(main_thread_id, WM_SERIAL_DATA, 0, 0);
+            if (i < n) {
+                // ring buffer is full, wait for the main thread to consume some data
+                Sleep(1);
+            }
+        }
     }
 
     PostThreadMessage(main_thread_id, WM_QUIT, 0, 0);
@@ -51,7 +63,8 @@ int main_loop() {
     CreateThread(0, 0, input_thread_proc, 0, 0, 0);
 
     while (1) {
-        switch (MsgWaitForMultipleObjects(0, 0, FALSE, 0, QS_POSTMESSAGE)) {
+        DWORD timeout = simulator::getIdleTime() / 1000;
+        switch (MsgWaitForMultipleObjects(0, 0, FALSE, timeout, QS_POSTMESSAGE)) {
         case WAIT_OBJECT_0:
             while (PeekMessage(&msg, 0, 0, 0, PM_REMOVE))
             {
@@ -59,14 +72,14 @@ int main_loop() {
                     break;
                 }
 
-                switch (msg.message) {
-                case NEW_INPUT_MESSAGE:
-                    Serial.put(msg.wParam);
-                    break;
-                case WM_QUIT:
+                if (msg.message == WM_QUIT) {
                     return 0;
                 }
             }
+            // in the fixed tick rate mode only the timeout runs the tick
+            if (!simulator::isFixedTickRateEnabled()) {
+                simulator::tick();
+            }
             break;
 
         case WAIT_TIMEOUT:
@@ -19,7 +19,8 @@
 #pragma once
 
 #include <stdint.h>
-#include <queue>
+#include <stddef.h>
+#include <atomic>
 
 typedef uint8_t byte;
 
@@ -79,12 +80,20 @@ private:
     } _address;
 
 public:
+    IPAddress() { _address.dword = 0; }
+    IPAddress(uint32_t address) { _address.dword = address; }
+
     operator uint32_t() const { return _address.dword; };
 };
 
+/// Size of the serial receive ring buffer (same name as in the Arduino Due core).
+#define SERIAL_BUFFER_SIZE 1024
+
 /// Bare minimum implementation of the Arduino Serial object
 class SimulatorSerial {
 public:
+    SimulatorSerial();
+
     void begin(unsigned long baud);
     int write(const char *buffer, int size);
     int print(const char *data);
@@ -94,12 +103,18 @@ public:
     operator bool() { return true; }
     int available(void);
     int read(void);
+    size_t readBytes(char *buffer, size_t length);
     void flush(void);
 
-    void put(int ch);
+    /// Add received data to the ring buffer, called from the input thread.
+    /// Returns number of bytes stored, less than size if ring buffer is full.
+    int put(const char *data, int size);
 
 private:
-    std::queue<int> input;
+    /// Single producer (input thread), single consumer (main thread) ring buffer.
+    char rxBuffer[SERIAL_BUFFER_SIZE];
+    std::atomic<int> rxHead;
+    std::atomic<int> rxTail;
 };
 
 extern SimulatorSerial Serial;
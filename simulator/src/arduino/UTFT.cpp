@@ -20,6 +20,8 @@
 #include "UTFT.h"
 #include "arduino_util.h"
 
+#include <algorithm>
+
 namespace eez {
 namespace psu {
 namespace simulator {
@@ -85,9 +87,11 @@ void UTFT::setBrightness(byte br) {
 }
 
 void UTFT::setPixel(word color) {
+    // called for every streamed pixel, so display size is not taken from getDisplayXSize/getDisplayYSize
+    // (x and y are unsigned, so negative coordinates are also outside)
     if (orient == PORTRAIT) {
-        if (x >= 0 && x < getDisplayXSize() && y >= 0 && y < getDisplayYSize()) {
-            *(buffer + y * getDisplayXSize() + x) = color;
+        if (x <= disp_x_size && y <= disp_y_size) {
+            buffer[y * (disp_x_size + 1) + x] = color;
         }
         if (++x > x2) {
             x = x1;
@@ -96,12 +100,17 @@ void UTFT::setPixel(word color) {
             }
         }
     } else {
-        if (x >= 0 && x < getDisplayXSize() && y >= 0 && y < getDisplayYSize()) {
-            *(buffer + y * getDisplayXSize() + x) = color;
+        if (x <= disp_y_size && y <= disp_x_size) {
+            buffer[y * (disp_y_size + 1) + x] = color;
         }
 
-        if (--x < x1) {
-            x = x2;
+        // in landscape orientation window is filled column by column,
+        // from right to left and from top to bottom
+        if (++y > y2) {
+            y = y1;
+            if (--x < x1) {
+                x = x2;
+            }
         }
     }
 }
@@ -146,6 +155,23 @@ void UTFT::drawRect(int x1, int y1, int x2, int y2) {
 }
 
 void UTFT::fillRect(int x1, int y1, int x2, int y2) {
+    if (isWindowInside(x1, y1, x2, y2)) {
+        // fast path: fill row by row directly in the buffer,
+        // window is left as if it was filled pixel by pixel
+        word color = (fch << 8) | fcl;
+        int displayXSize = getDisplayXSize();
+        for (int iy = y1; iy <= y2; ++iy) {
+            word *row = buffer + iy * displayXSize;
+            std::fill(row + x1, row + x2 + 1, color);
+        }
+        if (orient == PORTRAIT) {
+            setXY(x1, y1, x2, y2);
+        } else {
+            setXY(x1, y2, x2, y2);
+        }
+        return;
+    }
+
     if (orient == PORTRAIT) {
         setXY(x1, y1, x2, y2);
         for (int i = 0; i < (x2 - x1 + 1) * (y2 - y1 + 1); ++i) {
@@ -162,6 +188,13 @@ void UTFT::fillRect(int x1, int y1, int x2, int y2) {
 }
 
 void UTFT::drawHLine(int x, int y, int l) {
+    if (isWindowInside(x, y, x + l, y)) {
+        word *row = buffer + y * getDisplayXSize();
+        std::fill(row + x, row + x + l + 1, (word)((fch << 8) | fcl));
+        setXY(x, y, x + l, y);
+        return;
+    }
+
     setXY(x, y, x + l, y);
     for (int i = 0; i < l + 1; ++i) {
         setPixel((fch << 8) | fcl);
@@ -169,6 +202,21 @@ void UTFT::drawHLine(int x, int y, int l) {
 }
 
 void UTFT::drawVLine(int x, int y, int l) {
+    if (isWindowInside(x, y, x, y + l)) {
+        word color = (fch << 8) | fcl;
+        int displayXSize = getDisplayXSize();
+        word *p = buffer + y * displayXSize + x;
+        for (int i = 0; i < l + 1; ++i, p += displayXSize) {
+            *p = color;
+        }
+        if (orient == PORTRAIT) {
+            setXY(x, y, x, y + l);
+        } else {
+            setXY(x, y + l, x, y + l);
+        }
+        return;
+    }
+
     if (orient == PORTRAIT) {
         setXY(x, y, x, y + l);
         for (int i = 0; i < l + 1; ++i) {
@@ -183,6 +231,25 @@ void UTFT::drawVLine(int x, int y, int l) {
 }
 
 void UTFT::drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int scale) {
+    if (sx > 0 && sy > 0 && isWindowInside(x, y, x + sx - 1, y + sy - 1)) {
+        // fast path: copy row by row directly to the buffer,
+        // bitmap pixel is stored as low byte followed by high byte
+        int displayXSize = getDisplayXSize();
+        for (int iy = 0; iy < sy; ++iy) {
+            const uint8_t *src = (const uint8_t *)data + 2 * iy * sx;
+            word *dst = buffer + (y + iy) * displayXSize + x;
+            for (int ix = 0; ix < sx; ++ix) {
+                dst[ix] = (src[2 * ix + 1] << 8) | src[2 * ix];
+            }
+        }
+        if (orient == PORTRAIT) {
+            setXY(x, y, x + sx - 1, y + sy - 1);
+        } else {
+            setXY(x, y + sy - 1, x + sx - 1, y + sy - 1);
+        }
+        return;
+    }
+
     if (orient == PORTRAIT) {
         setXY(x, y, x + sx - 1, y + sy - 1);
         for (int i = 0; i < sx * sy; ++i) {
@@ -202,6 +269,12 @@ void UTFT::drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int sca
     }
 }
 
+/// Is the window non empty and completely inside the display?
+/// Only then drawing can skip setPixel, which also handles wrapping and clipping.
+bool UTFT::isWindowInside(int x1, int y1, int x2, int y2) {
+    return x1 >= 0 && x1 <= x2 && x2 < getDisplayXSize() && y1 >= 0 && y1 <= y2 && y2 < getDisplayYSize();
+}
+
 void UTFT::drawPixel(int x, int y) {
     setXY(x, y, x, y);
     setPixel((fch << 8) | fcl);
@@ -100,6 +100,7 @@ public:
     void drawHLine(int x, int y, int l);
     void drawVLine(int x, int y, int l);
     void drawPixel(int x, int y);
+    bool isWindowInside(int x1, int y1, int x2, int y2);
 };
 
 }
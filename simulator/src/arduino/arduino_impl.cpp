@@ -83,6 +83,9 @@ void detachInterrupt(uint8_t interrupt_no) {
 
 SimulatorSerial Serial;
 
+SimulatorSerial::SimulatorSerial() : rxHead(0), rxTail(0) {
+}
+
 void SimulatorSerial::begin(unsigned long baud) {
 }
 
@@ -111,17 +114,56 @@ int SimulatorSerial::println(IPAddress ipAddress) {
 }
 
 int SimulatorSerial::available(void) {
-    return input.size();
+    return (rxHead - rxTail + SERIAL_BUFFER_SIZE) % SERIAL_BUFFER_SIZE;
 }
 
 int SimulatorSerial::read(void) {
-    int ch = input.front();
-    input.pop();
-    return ch;
+    char ch;
+    if (readBytes(&ch, 1) == 0) {
+        return -1;
+    }
+    return (uint8_t)ch;
 }
 
-void SimulatorSerial::put(int ch) {
-    input.push(ch);
+size_t SimulatorSerial::readBytes(char *buffer, size_t length) {
+    int head = rxHead;
+    int tail = rxTail;
+
+    size_t n = 0;
+    while (n < length && tail != head) {
+        // copy contiguous run up to the head or the end of the buffer
+        int run = (head > tail ? head : SERIAL_BUFFER_SIZE) - tail;
+        if ((size_t)run > length - n) {
+            run = length - n;
+        }
+        memcpy(buffer + n, rxBuffer + tail, run);
+        n += run;
+        tail = (tail + run) % SERIAL_BUFFER_SIZE;
+    }
+
+    rxTail = tail;
+
+    return n;
+}
+
+int SimulatorSerial::put(const char *data, int size) {
+    int head = rxHead;
+    int tail = rxTail;
+
+    int n = 0;
+    while (n < size) {
+        int next = (head + 1) % SERIAL_BUFFER_SIZE;
+        if (next == tail) {
+            // full
+            break;
+        }
+        rxBuffer[head] = data[n++];
+        head = next;
+    }
+
+    rxHead = head;
+
+    return n;
 }
 
 void SimulatorSerial::flush() {
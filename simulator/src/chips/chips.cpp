@@ -35,10 +35,10 @@ RtcChip rtc_chip;
 BPChip bp_chip;
 
 // Instance of IOEXP chip for the CH1 (selected with IO_EXPANDER1 LOW)
-IOExpanderChip ioexp_chip1;
+IOExpanderChip ioexp_chip1(IOEXP_INT1);
 
 // Instance of IOEXP chip for the CH2 (selected with IO_EXPANDER2 LOW)
-IOExpanderChip ioexp_chip2;
+IOExpanderChip ioexp_chip2(IOEXP_INT2);
 
 // Instance of ADC chip for the CH1 (selected with ADC1_SELECT LOW)
 AnalogDigitalConverterChip adc_chip1(ioexp_chip1, CONVEND1);
@@ -492,10 +492,13 @@ uint8_t BPChip::transfer(uint8_t data) {
 
 ////////////////////////////////////////////////////////////////////////////////
 
-IOExpanderChip::IOExpanderChip()
-    : state(IDLE)
+IOExpanderChip::IOExpanderChip(int int_pin_)
+    : int_pin(int_pin_)
+    , state(IDLE)
     , pwrgood(true)
     , rpol(false)
+    , interrupt(false)
+    , interrupt_gpio(0)
 {
 }
 
@@ -504,8 +507,9 @@ bool IOExpanderChip::getPwrgood(int pin) {
 }
 
 void IOExpanderChip::setPwrgood(int pin, bool on) {
-    if (pin == IO_EXPANDER1) ioexp_chip1.pwrgood = on;
-    else ioexp_chip2.pwrgood = on;
+    IOExpanderChip &chip = pin == IO_EXPANDER1 ? ioexp_chip1 : ioexp_chip2;
+    chip.pwrgood = on;
+    chip.updateInterrupt();
 }
 
 bool IOExpanderChip::getRPol(int pin) {
@@ -513,8 +517,9 @@ bool IOExpanderChip::getRPol(int pin) {
 }
 
 void IOExpanderChip::setRPol(int pin, bool on) {
-    if (pin == IO_EXPANDER1) ioexp_chip1.rpol = on;
-    else ioexp_chip2.rpol = on;
+    IOExpanderChip &chip = pin == IO_EXPANDER1 ? ioexp_chip1 : ioexp_chip2;
+    chip.rpol = on;
+    chip.updateInterrupt();
 }
 
 void IOExpanderChip::select() {
@@ -542,33 +547,9 @@ uint8_t IOExpanderChip::transfer(uint8_t data) {
         if (channel.boardRevision == CH_BOARD_REVISION_R5B12 && register_index == IOExpander::REG_GPIOA ||
             channel.boardRevision != CH_BOARD_REVISION_R5B12 && register_index == IOExpander::REG_GPIO) 
         {
-            result = register_values[register_index];
-
-            if (pwrgood) {
-                result |= 1 << IOExpander::IO_BIT_IN_PWRGOOD;
-            } else {
-                result &= ~(1 << IOExpander::IO_BIT_IN_PWRGOOD);
-            }
-
-            if (channel.getFeatures() & CH_FEATURE_RPOL) {
-                if (!rpol) {
-                    result |= 1 << IOExpander::IO_BIT_IN_RPOL;
-                } else {
-                    result &= ~(1 << IOExpander::IO_BIT_IN_RPOL);
-                }
-            }
-
-            if (cv) {
-                result |= 1 << IOExpander::IO_BIT_IN_CV_ACTIVE;
-            } else {
-                result &= ~(1 << IOExpander::IO_BIT_IN_CV_ACTIVE);
-            }
-
-            if (cc) {
-                result |= 1 << IOExpander::IO_BIT_IN_CC_ACTIVE;
-            } else {
-                result &= ~(1 << IOExpander::IO_BIT_IN_CC_ACTIVE);
-            }
+            result = getGpio();
+            interrupt_gpio = result;
+            interrupt = false;
         }
         else {
             result = register_values[register_index];
@@ -585,6 +566,58 @@ uint8_t IOExpanderChip::transfer(uint8_t data) {
     return result;
 }
 
+uint8_t IOExpanderChip::getGpio() {
+    Channel &channel = Channel::get(this == &ioexp_chip1 ? 0 : 1);
+
+    uint8_t result = register_values[channel.boardRevision == CH_BOARD_REVISION_R5B12 ? IOExpander::REG_GPIOA : IOExpander::REG_GPIO];
+
+    if (pwrgood) {
+        result |= 1 << IOExpander::IO_BIT_IN_PWRGOOD;
+    } else {
+        result &= ~(1 << IOExpander::IO_BIT_IN_PWRGOOD);
+    }
+
+    if (channel.getFeatures() & CH_FEATURE_RPOL) {
+        if (!rpol) {
+            result |= 1 << IOExpander::IO_BIT_IN_RPOL;
+        } else {
+            result &= ~(1 << IOExpander::IO_BIT_IN_RPOL);
+        }
+    }
+
+    if (cv) {
+        result |= 1 << IOExpander::IO_BIT_IN_CV_ACTIVE;
+    } else {
+        result &= ~(1 << IOExpander::IO_BIT_IN_CV_ACTIVE);
+    }
+
+    if (cc) {
+        result |= 1 << IOExpander::IO_BIT_IN_CC_ACTIVE;
+    } else {
+        result &= ~(1 << IOExpander::IO_BIT_IN_CC_ACTIVE);
+    }
+
+    return result;
+}
+
+void IOExpanderChip::updateInterrupt() {
+    if (interrupt) {
+        return;
+    }
+
+    Channel &channel = Channel::get(this == &ioexp_chip1 ? 0 : 1);
+    uint8_t gpinten = register_values[channel.boardRevision == CH_BOARD_REVISION_R5B12 ? IOExpander::REG_GPINTENA : IOExpander::REG_GPINTEN];
+
+    if ((getGpio() ^ interrupt_gpio) & gpinten) {
+        interrupt = true;
+
+        InterruptCallback callback = interrupt_callbacks[int_pin];
+        if (callback) {
+            callback();
+        }
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 
 AnalogDigitalConverterChip::AnalogDigitalConverterChip(IOExpanderChip &ioexp_chip_, int convend_pin_)
@@ -668,6 +701,7 @@ void AnalogDigitalConverterChip::tick() {
 
 uint16_t AnalogDigitalConverterChip::getValue() {
     updateValues();
+    ioexp_chip.updateInterrupt();
 
     if (register_values[0] == AnalogDigitalConverter::ADC_REG0_READ_U_MON) {
         return u_mon;
@@ -699,6 +733,7 @@ void AnalogDigitalConverterChip::setDacValue(uint8_t data_buffer, uint16_t dac_v
             AnalogDigitalConverter::ADC_MIN, AnalogDigitalConverter::ADC_MAX);
     }
     updateValues();
+    ioexp_chip.updateInterrupt();
     tick();
 }
 
@@ -759,6 +794,7 @@ DigitalAnalogConverterChip::DigitalAnalogConverterChip(AnalogDigitalConverterChi
     : adc_chip(adc_chip_)
     , state(IDLE)
 {
+    input_buffers[0] = input_buffers[1] = 0;
 }
 
 void DigitalAnalogConverterChip::select() {
@@ -769,10 +805,8 @@ uint8_t DigitalAnalogConverterChip::transfer(uint8_t data) {
     uint8_t result = 0;
 
     if (state == IDLE) {
-        if (data == DigitalAnalogConverter::DATA_BUFFER_A || data == DigitalAnalogConverter::DATA_BUFFER_B) {
-            data_buffer = data;
-            state = DATA_BUFFER_MSB;
-        }
+        control = data;
+        state = DATA_BUFFER_MSB;
     }
     else if (state == DATA_BUFFER_MSB) {
         value = ((uint16_t)data) << 8;
@@ -780,7 +814,15 @@ uint8_t DigitalAnalogConverterChip::transfer(uint8_t data) {
     }
     else if (state == DATA_BUFFER_LSB) {
         value |= data;
-        adc_chip.setDacValue(data_buffer, value);
+
+        input_buffers[control & DigitalAnalogConverter::BUFFER_SELECT_B ? 1 : 0] = value;
+
+        if (control & DigitalAnalogConverter::LOAD_A) {
+            adc_chip.setDacValue(DigitalAnalogConverter::DATA_BUFFER_A, input_buffers[0]);
+        }
+        if (control & DigitalAnalogConverter::LOAD_B) {
+            adc_chip.setDacValue(DigitalAnalogConverter::DATA_BUFFER_B, input_buffers[1]);
+        }
     }
 
     return result;
@@ -202,7 +202,7 @@ class IOExpanderChip : public Chip {
     };
 
 public:
-    IOExpanderChip();
+    IOExpanderChip(int int_pin_);
 
     static bool getPwrgood(int pin);
     static void setPwrgood(int pin, bool on);
@@ -213,7 +213,12 @@ public:
     void select();
     uint8_t transfer(uint8_t data);
 
+    /// Activate INT output if some input enabled in GPINTEN register
+    /// has changed since the last read of the GPIO register.
+    void updateInterrupt();
+
 private:
+    int int_pin;
     State state;
     uint8_t register_index;
     uint8_t register_values[IOExpander::NUM_REGISTERS];
@@ -221,6 +226,12 @@ private:
     bool rpol;
     bool cc;
     bool cv;
+    /// INT output is active, it is deactivated by reading GPIO register.
+    bool interrupt;
+    /// GPIO value at the last read.
+    uint8_t interrupt_gpio;
+
+    uint8_t getGpio();
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -283,8 +294,9 @@ public:
 private:
     AnalogDigitalConverterChip &adc_chip;
     State state;
-    uint8_t data_buffer;
+    uint8_t control;
     uint16_t value;
+    uint16_t input_buffers[2];
 };
 
 ////////////////////////////////////////////////////////////////////////////////
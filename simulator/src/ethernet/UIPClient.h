@@ -27,10 +27,10 @@ namespace arduino {
 class EthernetClient {
 public:
     EthernetClient();
-    EthernetClient(bool valid);
+    EthernetClient(int client);
 
     operator bool();
-    bool operator==(EthernetClient &other) { return true; }
+    bool operator==(EthernetClient &other) { return client == other.client; }
 
     bool connected();
 
@@ -42,7 +42,7 @@ public:
     void stop();
 
 private:
-    bool valid;
+    int client;
 };
 
 }
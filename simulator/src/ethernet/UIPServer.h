@@ -34,9 +34,8 @@ public:
     EthernetClient available();
 
 private:
-    bool bind_result;
+    int server;
     int port;
-    EthernetClient client;
 };
 
 }
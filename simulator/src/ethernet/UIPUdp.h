@@ -0,0 +1,53 @@
+/*
+ * EEZ PSU Firmware
+ * Copyright (C) 2015-present, Envox d.o.o.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+namespace eez {
+namespace psu {
+namespace simulator {
+namespace arduino {
+
+/// Bare minimum implementation of the Arduino EthernetUDP class (send only)
+class EthernetUDP {
+public:
+    EthernetUDP();
+
+    uint8_t begin(uint16_t port);
+    void stop();
+
+    int beginPacket(IPAddress ip, uint16_t port);
+    size_t write(const uint8_t *buffer, size_t size);
+    int endPacket();
+
+private:
+    static const int MAX_PACKET_SIZE = 512;
+
+    bool started;
+    uint32_t remoteIp;
+    uint16_t remotePort;
+    char packet[MAX_PACKET_SIZE];
+    int packetSize;
+};
+
+}
+}
+}
+} // namespace eez::psu::simulator::arduino;
+
+using namespace eez::psu::simulator::arduino;
@@ -22,16 +22,42 @@ namespace eez {
 namespace psu {
 namespace ethernet_platform {
 
-bool bind(int port);
-bool client_available();
+/// Maximum number of simultaneously connected clients.
+static const int MAX_CLIENTS = 16;
 
-bool connected();
+/// Maximum number of listening ports (SCPI and HTTP server).
+static const int MAX_SERVERS = 2;
 
-int available();
-int read(char *buffer, int buffer_size);
-int write(const char *buffer, int buffer_size);
+/// Start listening on the given port.
+/// Returns server index or -1 on failure.
+int bind(int port);
 
-void stop();
+/// Accept pending client connection on the given server.
+/// Returns client index or -1 if there is no pending connection.
+int accept_client(int server);
+
+bool connected(int client);
+
+/// Returns index of the server which accepted the client.
+int get_client_server(int client);
+
+int available(int client);
+int read(int client, char *buffer, int buffer_size);
+int write(int client, const char *buffer, int buffer_size);
+
+void stop(int client);
+
+/// Open UDP socket used for sending datagrams.
+bool udp_begin();
+/// Send one datagram to the IPv4 address (in network byte order) and port.
+int udp_send(uint32_t ip_address, int port, const char *buffer, int buffer_size);
+void udp_stop();
+
+#ifndef _WIN32
+/// Returns file descriptor which is readable when there is some socket activity,
+/// or -1 if no server is listening yet. Main loop waits on it while idle.
+int get_event_fd();
+#endif
 
 }
 }
@@ -20,6 +20,7 @@
 #include "UIPEthernet.h"
 #include "UIPServer.h"
 #include "UIPClient.h"
+#include "UIPUdp.h"
 #include "ethernet_platform.h"
 
 namespace eez {
@@ -59,51 +60,106 @@ IPAddress SimulatorEthernet::dnsServerIP() {
 
 ////////////////////////////////////////////////////////////////////////////////
 
-EthernetServer::EthernetServer(int port_) : port(port_), client(true) {
+EthernetServer::EthernetServer(int port_) : server(-1), port(port_) {
 }
 
 void EthernetServer::begin() {
-    bind_result = ethernet_platform::bind(port);
+    server = ethernet_platform::bind(port);
 }
 
 EthernetClient EthernetServer::available() {
-    if (!bind_result) return EthernetClient();
-    return client;
+    if (server == -1) return EthernetClient();
+
+    int client = ethernet_platform::accept_client(server);
+    if (client != -1) {
+        return EthernetClient(client);
+    }
+
+    for (client = 0; client < ethernet_platform::MAX_CLIENTS; ++client) {
+        if (ethernet_platform::connected(client) && ethernet_platform::get_client_server(client) == server && ethernet_platform::available(client) > 0) {
+            return EthernetClient(client);
+        }
+    }
+
+    return EthernetClient();
 }
 
 ////////////////////////////////////////////////////////////////////////////////
 
-EthernetClient::EthernetClient() : valid(false) {
+EthernetClient::EthernetClient() : client(-1) {
 }
 
-EthernetClient::EthernetClient(bool valid_) : valid(valid_) {
+EthernetClient::EthernetClient(int client_) : client(client_) {
 }
 
 bool EthernetClient::connected() {
-    return ethernet_platform::connected();
+    return client != -1 && ethernet_platform::connected(client);
 }
 
 EthernetClient::operator bool() {
-    return valid && ethernet_platform::client_available();
+    return connected();
 }
 
 size_t EthernetClient::available() {
-    return ethernet_platform::available();
+    if (client == -1) return 0;
+    return ethernet_platform::available(client);
 }
 
 size_t EthernetClient::read(uint8_t* buffer, size_t buffer_size) {
-    return ethernet_platform::read((char *)buffer, (int)buffer_size);
+    if (client == -1) return 0;
+    return ethernet_platform::read(client, (char *)buffer, (int)buffer_size);
 }
 
 size_t EthernetClient::write(const char *buffer, size_t buffer_size) {
-    return ethernet_platform::write(buffer, (int)buffer_size);
+    if (client == -1) return 0;
+    return ethernet_platform::write(client, buffer, (int)buffer_size);
 }
 
 void EthernetClient::flush() {
 }
 
 void EthernetClient::stop() {
-    ethernet_platform::stop();
+    if (client == -1) return;
+    ethernet_platform::stop(client);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+EthernetUDP::EthernetUDP() : started(false), remoteIp(0), remotePort(0), packetSize(0) {
+}
+
+uint8_t EthernetUDP::begin(uint16_t port) {
+    started = ethernet_platform::udp_begin();
+    return started ? 1 : 0;
+}
+
+void EthernetUDP::stop() {
+    if (started) {
+        ethernet_platform::udp_stop();
+        started = false;
+    }
+}
+
+int EthernetUDP::beginPacket(IPAddress ip, uint16_t port) {
+    if (!started) return 0;
+    remoteIp = ip;
+    remotePort = port;
+    packetSize = 0;
+    return 1;
+}
+
+size_t EthernetUDP::write(const uint8_t *buffer, size_t size) {
+    if (packetSize + (int)size > MAX_PACKET_SIZE) {
+        size = MAX_PACKET_SIZE - packetSize;
+    }
+    memcpy(packet + packetSize, buffer, size);
+    packetSize += size;
+    return size;
+}
+
+int EthernetUDP::endPacket() {
+    if (!started) return 0;
+    return ethernet_platform::udp_send(remoteIp, remotePort, packet, packetSize) == packetSize ? 1 : 0;
 }
 
 }
@@ -118,24 +118,56 @@ void fillChannelData(ChannelData *data, int ch) {
 }
 
 void fillLocalControlBuffer(Data *data) {
-    if (!data->local_control_widget.pixels) {
-        data->local_control_widget.pixels_w = gui::lcd::lcd.getDisplayXSize();
-        data->local_control_widget.pixels_h = gui::lcd::lcd.getDisplayYSize();
-        data->local_control_widget.pixels = new unsigned char[data->local_control_widget.pixels_w * data->local_control_widget.pixels_h * 4];
+    imgui::UserWidget &widget = data->local_control_widget;
+
+    gui::lcd::DirtyRect rects[gui::lcd::MAX_DIRTY_RECTS];
+    int numRects = gui::lcd::lcd.takeDirtyRects(rects);
+
+    if (!widget.pixels) {
+        widget.pixels_w = gui::lcd::lcd.getDisplayXSize();
+        widget.pixels_h = gui::lcd::lcd.getDisplayYSize();
+        widget.pixels = new unsigned char[widget.pixels_w * widget.pixels_h * 4];
+
+        // convert whole display first time
+        rects[0].x1 = 0;
+        rects[0].y1 = 0;
+        rects[0].x2 = widget.pixels_w - 1;
+        rects[0].y2 = widget.pixels_h - 1;
+        numRects = 1;
     }
 
-    word *src = gui::lcd::lcd.buffer;
-    unsigned char *dst = data->local_control_widget.pixels;
+    for (int i = 0; i < numRects; ++i) {
+        gui::lcd::DirtyRect &rect = rects[i];
+
+        for (int y = rect.y1; y <= rect.y2; ++y) {
+            word *src = gui::lcd::lcd.buffer + y * widget.pixels_w + rect.x1;
+            unsigned char *dst = widget.pixels + (y * widget.pixels_w + rect.x1) * 4;
 
-    for (int x = 0; x < data->local_control_widget.pixels_w; ++x) {
-        for (int y = 0; y < data->local_control_widget.pixels_h; ++y) {
-            word color = *src++; // rrrrrggggggbbbbb
+            for (int x = rect.x1; x <= rect.x2; ++x) {
+                word color = *src++; // rrrrrggggggbbbbb
 
-            *dst++ = (unsigned char)((color << 3) & 0xFF);        // blue
-            *dst++ = (unsigned char)(((color >> 5) << 2) & 0xFF); // green
-            *dst++ = (unsigned char)((color >> 11) << 3);         // red
+                *dst++ = (unsigned char)((color << 3) & 0xFF);        // blue
+                *dst++ = (unsigned char)(((color >> 5) << 2) & 0xFF); // green
+                *dst++ = (unsigned char)((color >> 11) << 3);         // red
+
+                *dst++ = 255;
+            }
+        }
 
-            *dst++ = 255;
+        // tell the window which part of the texture has to be updated,
+        // if there are too many rectangles update the whole texture
+        if (widget.num_dirty_rects < USER_WIDGET_MAX_DIRTY_RECTS) {
+            imgui::UserWidgetRect &dirtyRect = widget.dirty_rects[widget.num_dirty_rects++];
+            dirtyRect.x = rect.x1;
+            dirtyRect.y = rect.y1;
+            dirtyRect.w = rect.x2 - rect.x1 + 1;
+            dirtyRect.h = rect.y2 - rect.y1 + 1;
+        } else {
+            widget.num_dirty_rects = 1;
+            widget.dirty_rects[0].x = 0;
+            widget.dirty_rects[0].y = 0;
+            widget.dirty_rects[0].w = widget.pixels_w;
+            widget.dirty_rects[0].h = widget.pixels_h;
         }
     }
 }
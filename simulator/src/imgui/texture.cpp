@@ -135,6 +135,29 @@ bool Texture::loadFromImageBuffer(unsigned char *image_buffer, int width, int he
     return mTexture != NULL;
 }
 
+bool Texture::createStreaming(int width, int height, SDL_Renderer *renderer) {
+    //Get rid of preexisting texture
+    free();
+
+    //Same pixel format as the surface created in loadFromImageBuffer
+    mTexture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGB888, SDL_TEXTUREACCESS_STREAMING, width, height);
+    if (mTexture == NULL) {
+        printf("Unable to create streaming texture! SDL Error: %s\n", SDL_GetError());
+    }
+    else {
+        mWidth = width;
+        mHeight = height;
+    }
+
+    //Return success
+    return mTexture != NULL;
+}
+
+void Texture::updateFromImageBuffer(unsigned char *image_buffer, int x, int y, int w, int h) {
+    SDL_Rect rect = { x, y, w, h };
+    SDL_UpdateTexture(mTexture, &rect, image_buffer + 4 * (y * mWidth + x), 4 * mWidth);
+}
+
 void Texture::free() {
     //Free texture if it exists
     if (mTexture != NULL)
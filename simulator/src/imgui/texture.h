@@ -47,6 +47,12 @@ public:
     //Creates image from image buffer
     bool loadFromImageBuffer(unsigned char *image_buffer, int width, int height, SDL_Renderer *renderer);
 
+    //Creates empty streaming texture, updated with updateFromImageBuffer
+    bool createStreaming(int width, int height, SDL_Renderer *renderer);
+
+    //Updates the area of streaming texture from image buffer of the same size as texture
+    void updateFromImageBuffer(unsigned char *image_buffer, int x, int y, int w, int h);
+
     //Deallocates texture
     void free();
 
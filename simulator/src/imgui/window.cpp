@@ -113,6 +113,10 @@ WindowImpl::~WindowImpl() {
         delete it->second;
     }
 
+    for (UserWidgetTextureMap::iterator it = user_widget_textures.begin(); it != user_widget_textures.end(); ++it) {
+        delete it->second;
+    }
+
     if (font) {
         TTF_CloseFont(font);
     }
@@ -341,16 +345,50 @@ bool WindowImpl::pointInRect(int px, int py, int x, int y, int w, int h) {
     return px >= x && px < x + w && py >= y && py <= y + h;
 }
 
+/// Texture of the user widget is kept between the updates, so only the dirty rectangles are uploaded.
+Texture *WindowImpl::getUserWidgetTexture(UserWidget *user_widget, bool &created) {
+    created = false;
+
+    Texture *texture;
+    UserWidgetTextureMap::iterator it = user_widget_textures.find(user_widget);
+    if (it != user_widget_textures.end()) {
+        texture = it->second;
+        if (texture->getWidth() == user_widget->pixels_w && texture->getHeight() == user_widget->pixels_h) {
+            return texture;
+        }
+    } else {
+        texture = new Texture();
+        user_widget_textures[user_widget] = texture;
+    }
+
+    if (!texture->createStreaming(user_widget->pixels_w, user_widget->pixels_h, renderer)) {
+        return 0;
+    }
+
+    created = true;
+    return texture;
+}
+
 void WindowImpl::addUserWidget(UserWidget *user_widget) {
     int x = user_widget->x + window_definition->content_padding;
     int y = user_widget->y + window_definition->content_padding;
 
     if (user_widget->pixels) {
-        Texture tex;
-        if (tex.loadFromImageBuffer(user_widget->pixels, user_widget->pixels_w, user_widget->pixels_h, renderer)) {
-            tex.render(renderer, x, y, user_widget->w, user_widget->h);
+        bool created;
+        Texture *texture = getUserWidgetTexture(user_widget, created);
+        if (texture) {
+            if (created) {
+                texture->updateFromImageBuffer(user_widget->pixels, 0, 0, user_widget->pixels_w, user_widget->pixels_h);
+            } else {
+                for (int i = 0; i < user_widget->num_dirty_rects; ++i) {
+                    UserWidgetRect &rect = user_widget->dirty_rects[i];
+                    texture->updateFromImageBuffer(user_widget->pixels, rect.x, rect.y, rect.w, rect.h);
+                }
+            }
+            texture->render(renderer, x, y, user_widget->w, user_widget->h);
         }
     }
+    user_widget->num_dirty_rects = 0;
 
     memcpy(&user_widget->mouseData, &mouseData, sizeof(MouseData));
     
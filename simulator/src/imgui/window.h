@@ -45,6 +45,16 @@ struct MouseData {
     bool button2IsUp;
 };
 
+/// Maximum number of changed areas of the UserWidget pixels reported in one update.
+#define USER_WIDGET_MAX_DIRTY_RECTS 8
+
+struct UserWidgetRect {
+    int x;
+    int y;
+    int w;
+    int h;
+};
+
 struct UserWidget {
     int x;
     int y;
@@ -55,6 +65,11 @@ struct UserWidget {
     int pixels_h;
     unsigned char *pixels;
 
+    /// Areas of pixels changed since the last update, only these are uploaded to the texture.
+    /// Cleared by the Window::addUserWidget.
+    int num_dirty_rects;
+    UserWidgetRect dirty_rects[USER_WIDGET_MAX_DIRTY_RECTS];
+
     MouseData mouseData;
 };
 
@@ -56,6 +56,7 @@ public:
 
 private:
     Texture *getTexture(const char *path);
+    Texture *getUserWidgetTexture(UserWidget *user_widget, bool &created);
 
     WindowDefinition *window_definition;
     SDL_Window *sdl_window;
@@ -63,6 +64,8 @@ private:
     TTF_Font *font;
     typedef std::map<std::string, Texture *> TextureMap;
     TextureMap textures;
+    typedef std::map<UserWidget *, Texture *> UserWidgetTextureMap;
+    UserWidgetTextureMap user_widget_textures;
 
     MouseData mouseData;
 
@@ -32,3 +32,6 @@
 
 #define SIM_FRONT_PANEL_LARGE_MODE_MIN_WIDTH 2560
 
+// Longest time (in microseconds) main loop sleeps between two ticks when not in the fixed tick rate mode.
+#define SIM_MAX_IDLE_TIME 10000
+
@@ -23,6 +23,7 @@
 #endif
 
 #include "main_loop.h"
+#include "scheduler.h"
 
 // for home directory (see getConfFilePath)
 #ifdef _WIN32
@@ -47,6 +48,8 @@ namespace simulator {
 
 float temperature[temp_sensor::NUM_TEMP_SENSORS];
 
+static bool g_fixedTickRate;
+
 void init() {
     for (int i = 0; i < temp_sensor::NUM_TEMP_SENSORS; ++i) {
         temperature[i] = 25.0f;
@@ -61,6 +64,21 @@ void tick() {
 #endif
 }
 
+void enableFixedTickRate(bool enable) {
+    g_fixedTickRate = enable;
+}
+
+bool isFixedTickRateEnabled() {
+    return g_fixedTickRate;
+}
+
+uint32_t getIdleTime() {
+    if (g_fixedTickRate) {
+        return TICK_TIMEOUT * 1000;
+    }
+    return scheduler::getIdleTime(SIM_MAX_IDLE_TIME);
+}
+
 void setTemperature(int sensor, float value) {
     temperature[sensor] = value;
 }
@@ -32,6 +32,7 @@
 #include <string.h>
 #include <math.h>
 #include <stdarg.h>
+#include <stdint.h>
 
 #define PSTR(U) U
 #define strcpy_P strcpy
@@ -56,6 +57,14 @@ namespace simulator {
 void init();
 void tick();
 
+/// In the fixed tick rate mode main loop ticks every TICK_TIMEOUT milliseconds,
+/// otherwise it sleeps until some task has something to do or until input arrives.
+void enableFixedTickRate(bool enable);
+bool isFixedTickRateEnabled();
+
+/// How long (in microseconds) main loop should wait before the next tick.
+uint32_t getIdleTime();
+
 void setTemperature(int sensor, float value);
 float getTemperature(int sensor);
 